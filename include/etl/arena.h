@@ -0,0 +1,610 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ARENA_INCLUDED
+#define ETL_ARENA_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "largest.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "nullptr.h"
+#include "vector.h"
+#include "basic_string.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include <utility>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "58"
+
+#define ETL_ARENA_CPP03_CODE 0
+
+//*****************************************************************************
+///\defgroup arena arena
+/// A monotonic arena. Allocation bumps a pointer through a fixed buffer and
+/// memory is only reclaimed by rewinding to a marker or resetting the arena.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for arena exceptions.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_exception : public exception
+  {
+  public:
+
+    arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {}
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the arena does not have room for an allocation.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_full : public arena_exception
+  {
+  public:
+
+    arena_full(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:full", ETL_FILE"A"), file_name_, line_number_)
+    {}
+  };
+
+  //***************************************************************************
+  /// The exception thrown when rewinding to a marker beyond the allocated memory.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_invalid_marker : public arena_exception
+  {
+  public:
+
+    arena_invalid_marker(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:invalid marker", ETL_FILE"B"), file_name_, line_number_)
+    {}
+  };
+
+  //***************************************************************************
+  /// The base class for arenas.
+  /// Objects created in the arena are not destroyed by rewind or reset, so
+  /// either create trivially destructible types or destroy them beforehand.
+  ///\ingroup arena
+  //***************************************************************************
+  class iarena
+  {
+  public:
+
+    /// Records the allocation position of the arena.
+    typedef size_t marker_t;
+
+    //*************************************************************************
+    /// Allocate raw memory from the arena.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    ///\param size      The number of bytes.
+    ///\param alignment The alignment of the memory. Must be a power of two.
+    //*************************************************************************
+    void* allocate(size_t size, size_t alignment)
+    {
+      uintptr_t address = reinterpret_cast<uintptr_t>(p_buffer + used);
+      size_t    padding = size_t((alignment - (address & (alignment - 1))) & (alignment - 1));
+
+      if ((padding <= available()) && (size <= (available() - padding)))
+      {
+        char* p = p_buffer + used + padding;
+        used += padding + size;
+
+        return p;
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(arena_full));
+        return nullptr;
+      }
+    }
+
+    //*************************************************************************
+    /// Allocate uninitialised storage for 'n' objects of type 'T'.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate(size_t n = 1)
+    {
+      if (n <= (max_size() / sizeof(T)))
+      {
+        return static_cast<T*>(allocate(n * sizeof(T), etl::alignment_of<T>::value));
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(arena_full));
+        return nullptr;
+      }
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_ARENA_CPP03_CODE
+    //*************************************************************************
+    /// Create a default constructed object in the arena.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Create an object in the arena with 1 parameter.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Create an object in the arena with 2 parameters.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Create an object in the arena with 3 parameters.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Create an object in the arena with 4 parameters.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Create an object in the arena with variadic parameters.
+    /// If asserts or exceptions are enabled and there is not enough room an
+    /// etl::arena_full is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(std::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets a marker for the current allocation position.
+    //*************************************************************************
+    marker_t get_marker() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Frees everything allocated since the marker was taken.
+    /// If asserts or exceptions are enabled and the marker is beyond the
+    /// allocated memory an etl::arena_invalid_marker is thrown.
+    //*************************************************************************
+    void rewind(marker_t marker)
+    {
+      if (marker <= used)
+      {
+        used = marker;
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(arena_invalid_marker));
+      }
+    }
+
+    //*************************************************************************
+    /// Frees everything in the arena.
+    //*************************************************************************
+    void reset()
+    {
+      used = 0;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the arena in bytes.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes allocated, including alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free bytes.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - used;
+    }
+
+    //*************************************************************************
+    /// Checks to see if nothing is allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return used == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free bytes.
+    //*************************************************************************
+    bool full() const
+    {
+      return used == MAX_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    iarena(char* p_buffer_, size_t max_size_)
+      : p_buffer(p_buffer_),
+        used(0),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    iarena(const iarena&);
+    iarena& operator =(const iarena&);
+
+    char*        p_buffer; ///< The memory for the arena.
+    size_t       used;     ///< The number of bytes allocated.
+    const size_t MAX_SIZE; ///< The size of the buffer.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_ARENA) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iarena()
+    {
+    }
+#else
+  protected:
+    ~iarena()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// An arena with a fixed size buffer.
+  ///\tparam SIZE_ The size of the buffer in bytes.
+  ///\ingroup arena
+  //***************************************************************************
+  template <const size_t SIZE_>
+  class arena : public etl::iarena
+  {
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    arena()
+      : etl::iarena(reinterpret_cast<char*>(&buffer), SIZE)
+    {
+    }
+
+  private:
+
+    // Should not be copied.
+    arena(const arena&);
+    arena& operator =(const arena&);
+
+    ///< The memory for the arena.
+    typename etl::aligned_storage<SIZE, etl::largest_alignment<int64_t, double, void*>::value>::type buffer;
+  };
+
+  //***************************************************************************
+  /// Frees everything allocated in the arena during its lifetime.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_scope
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor. Takes a marker from the arena.
+    //*************************************************************************
+    explicit arena_scope(etl::iarena& arena_)
+      : arena(arena_),
+        marker(arena_.get_marker())
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Rewinds the arena to the marker.
+    //*************************************************************************
+    ~arena_scope()
+    {
+      arena.rewind(marker);
+    }
+
+  private:
+
+    // Should not be copied.
+    arena_scope(const arena_scope&);
+    arena_scope& operator =(const arena_scope&);
+
+    etl::iarena&          arena;
+    etl::iarena::marker_t marker;
+  };
+
+  namespace private_arena
+  {
+    //*************************************************************************
+    /// Allocates a container's storage from the arena before the container
+    /// base class is constructed.
+    //*************************************************************************
+    template <typename T>
+    struct buffer
+    {
+      buffer(etl::iarena& arena, size_t n)
+        : p_buffer(arena.allocate<T>(n)),
+          buffer_size((p_buffer != nullptr) ? n : 0)
+      {
+      }
+
+      T*     p_buffer;
+      size_t buffer_size;
+    };
+  }
+
+  //***************************************************************************
+  /// A vector that takes its storage from an arena.
+  /// The storage is freed when the arena is rewound or reset, which must not
+  /// happen while the vector is in use.
+  /// If asserts or exceptions are enabled and the arena does not have room an
+  /// etl::arena_full is thrown, otherwise the vector has zero capacity.
+  ///\tparam T The element type.
+  ///\ingroup arena
+  //***************************************************************************
+  template <typename T>
+  class arena_vector : private etl::private_arena::buffer<T>, public etl::ivector<T>
+  {
+  public:
+
+    typedef etl::private_arena::buffer<T> buffer_t;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param arena_    The arena to take the storage from.
+    ///\param max_size_ The maximum number of elements.
+    //*************************************************************************
+    arena_vector(etl::iarena& arena_, size_t max_size_)
+      : buffer_t(arena_, max_size_),
+        etl::ivector<T>(buffer_t::p_buffer, buffer_t::buffer_size)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~arena_vector()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    arena_vector& operator = (const arena_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The storage is in the arena, so does not move with the vector.
+    //*************************************************************************
+    void repair()
+    {
+    }
+
+  private:
+
+    // Should not be copy constructed.
+    arena_vector(const arena_vector&);
+  };
+
+  //***************************************************************************
+  /// A string that takes its storage from an arena.
+  /// The storage is freed when the arena is rewound or reset, which must not
+  /// happen while the string is in use.
+  /// If asserts or exceptions are enabled and the arena does not have room an
+  /// etl::arena_full is thrown, otherwise the string has zero capacity.
+  ///\tparam T The character type.
+  ///\ingroup arena
+  //***************************************************************************
+  template <typename T>
+  class arena_basic_string : private etl::private_arena::buffer<T>, public etl::ibasic_string<T>
+  {
+  public:
+
+    typedef etl::private_arena::buffer<T> buffer_t;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param arena_    The arena to take the storage from.
+    ///\param max_size_ The maximum number of characters, excluding the terminator.
+    //*************************************************************************
+    arena_basic_string(etl::iarena& arena_, size_t max_size_)
+      : buffer_t(arena_, max_size_ + 1),
+        etl::ibasic_string<T>(buffer_t::p_buffer != nullptr ? buffer_t::p_buffer : &empty_buffer,
+                              buffer_t::p_buffer != nullptr ? max_size_ : 0)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, from null terminated text.
+    ///\param arena_    The arena to take the storage from.
+    ///\param max_size_ The maximum number of characters, excluding the terminator.
+    ///\param text      The initial text of the string.
+    //*************************************************************************
+    arena_basic_string(etl::iarena& arena_, size_t max_size_, const T* text)
+      : buffer_t(arena_, max_size_ + 1),
+        etl::ibasic_string<T>(buffer_t::p_buffer != nullptr ? buffer_t::p_buffer : &empty_buffer,
+                              buffer_t::p_buffer != nullptr ? max_size_ : 0)
+    {
+      this->initialise();
+      this->assign(text, text + etl::char_traits<T>::length(text));
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    arena_basic_string& operator = (const arena_basic_string& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// The storage is in the arena, so does not move with the string.
+    //*************************************************************************
+    void repair()
+    {
+    }
+
+  private:
+
+    // Should not be copy constructed.
+    arena_basic_string(const arena_basic_string&);
+
+    T empty_buffer; ///< The terminator for a string with no storage.
+  };
+
+  typedef etl::arena_basic_string<char> arena_string;
+}
+
+#undef ETL_FILE
+
+#endif
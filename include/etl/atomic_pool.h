@@ -0,0 +1,862 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_POOL_INCLUDED
+#define ETL_ATOMIC_POOL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "pool.h"
+
+#undef ETL_FILE
+#define ETL_FILE "55"
+
+//*****************************************************************************
+///\defgroup atomic_pool atomic_pool
+/// A fixed capacity pool that may be shared between threads without a lock.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for atomic pools.
+  /// The free items form a lock free stack of item indexes.
+  /// The head of the stack is tagged with a count that changes on every
+  /// update, so that a thread that was preempted between reading the head and
+  /// exchanging it cannot succeed with a stale link (the ABA problem).
+  /// The head is 64 bits; it is lock free where the target has a 64 bit
+  /// compare and exchange.
+  /// The count of allocated items is reserved before items are taken from the
+  /// stack and given back after they are returned to it, so size() never
+  /// exceeds max_size() and available() never wraps.
+  ///\ingroup atomic_pool
+  //***************************************************************************
+  class iatomic_pool
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+    //*************************************************************************
+    /// Allocate storage for 'n' objects from the pool.
+    /// Either all or none are allocated, with one exchange of the free stack.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    ///\param o_begin The output iterator for the pointers to the storage.
+    ///\param n       The number of objects.
+    ///\return An iterator to one past the last pointer written.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    TOutputIterator allocate_n(TOutputIterator o_begin, size_t n)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      if (n == 0)
+      {
+        return o_begin;
+      }
+
+      uint32_t index = allocate_chain(n);
+
+      if (index == NO_ITEM)
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        return o_begin;
+      }
+
+      // The chain now belongs to this thread.
+      while (n-- != 0)
+      {
+        *o_begin++ = reinterpret_cast<T*>(p_buffer + (index * ITEM_SIZE));
+        index = next_of(index);
+      }
+
+      return o_begin;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// Takes as many as are free, up to 'n', with one exchange of the free stack.
+    /// Taking fewer is not an error.
+    ///\param o_begin The output iterator for the pointers to the storage.
+    ///\param n       The maximum number of objects.
+    ///\return An iterator to one past the last pointer written.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    TOutputIterator allocate_up_to(TOutputIterator o_begin, size_t n)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      // Reserve as many as are free, up to 'n'.
+      n = reserve(1, n);
+
+      if (n == 0)
+      {
+        return o_begin;
+      }
+
+      uint32_t index = take_chain(n);
+
+      if (index == NO_ITEM)
+      {
+        return o_begin;
+      }
+
+      // The chain now belongs to this thread.
+      while (n-- != 0)
+      {
+        *o_begin++ = reinterpret_cast<T*>(p_buffer + (index * ITEM_SIZE));
+        index = next_of(index);
+      }
+
+      return o_begin;
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(std::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const void* const p_object)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      reinterpret_cast<T*>((const_cast<void*>(p_object)))->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      release_item((char*)p_object);
+    }
+
+    //*************************************************************************
+    /// Release a range of objects in the pool.
+    /// Either all or none are released, with one exchange of the free stack.
+    /// If asserts or exceptions are enabled and any object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    ///\param first The iterator to the first pointer to an object.
+    ///\param last  The iterator to one past the last pointer to an object.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_n(TIterator first, TIterator last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        if (!is_item_in_pool((const char*)(*itr)))
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+          return;
+        }
+      }
+
+      // Link the items in to a chain.
+      uint32_t chain_first = index_of((const char*)(*first));
+      uint32_t chain_last  = chain_first;
+      uint32_t n           = 1;
+
+      while (++first != last)
+      {
+        uint32_t index = index_of((const char*)(*first));
+        next_of(chain_last) = index;
+        chain_last = index;
+        ++n;
+      }
+
+      release_chain(chain_first, chain_last, n);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    /// Not thread safe. No other thread may use the pool during the call.
+    //*************************************************************************
+    void release_all()
+    {
+      for (uint32_t i = 0; i < MAX_SIZE; ++i)
+      {
+        next_of(i) = i + 1;
+      }
+
+      if (MAX_SIZE > 0)
+      {
+        next_of(MAX_SIZE - 1) = NO_ITEM;
+      }
+
+      uint64_t head = free_head.load(etl::memory_order_relaxed);
+
+      free_head.store(make_head(MAX_SIZE > 0 ? 0 : NO_ITEM, get_tag(head) + 1), etl::memory_order_release);
+      items_allocated.store(0, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* p_object) const
+    {
+      return is_item_in_pool((const char*)p_object);
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess, but it is never more than max_size().
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess, but it is never more than max_size().
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return get_index(free_head.load(etl::memory_order_acquire)) == NO_ITEM;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    iatomic_pool(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_),
+        free_head(0),
+        items_allocated(0),
+        ITEM_SIZE(item_size_),
+        MAX_SIZE(max_size_)
+    {
+      release_all();
+    }
+
+  private:
+
+    static const uint32_t NO_ITEM = 0xFFFFFFFFUL; ///< The index that terminates the free stack.
+
+    //*************************************************************************
+    /// Packs a free item index and a tag into a stack head.
+    //*************************************************************************
+    static uint64_t make_head(uint32_t index, uint32_t tag)
+    {
+      return (uint64_t(tag) << 32) | index;
+    }
+
+    //*************************************************************************
+    /// Gets the item index from a stack head.
+    //*************************************************************************
+    static uint32_t get_index(uint64_t head)
+    {
+      return uint32_t(head);
+    }
+
+    //*************************************************************************
+    /// Gets the tag from a stack head.
+    //*************************************************************************
+    static uint32_t get_tag(uint64_t head)
+    {
+      return uint32_t(head >> 32);
+    }
+
+    //*************************************************************************
+    /// The link to the next free item, stored in a free item.
+    //*************************************************************************
+    uint32_t& next_of(uint32_t index)
+    {
+      return *reinterpret_cast<uint32_t*>(p_buffer + (index * ITEM_SIZE));
+    }
+
+    //*************************************************************************
+    /// The index of an item in the pool.
+    //*************************************************************************
+    uint32_t index_of(const char* p_value) const
+    {
+      return uint32_t((p_value - p_buffer) / ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      uint32_t index = allocate_chain(1);
+
+      // Any free items left?
+      if (index == NO_ITEM)
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        return nullptr;
+      }
+
+      return p_buffer + (index * ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Takes a chain of 'n' items from the top of the free stack.
+    /// Returns the index of the first, or NO_ITEM if there are not enough.
+    //*************************************************************************
+    uint32_t allocate_chain(size_t n)
+    {
+      if (reserve(n, n) == 0)
+      {
+        return NO_ITEM;
+      }
+
+      return take_chain(n);
+    }
+
+    //*************************************************************************
+    /// Takes a chain of 'n' items, already reserved, from the top of the free stack.
+    /// Returns the index of the first, or NO_ITEM, giving back the reservation,
+    /// if there are not enough.
+    //*************************************************************************
+    uint32_t take_chain(size_t n)
+    {
+      uint64_t head = free_head.load(etl::memory_order_acquire);
+      uint64_t new_head;
+      uint32_t first;
+
+      while (true)
+      {
+        first = get_index(head);
+
+        // Walk to the last item of the chain.
+        // If another thread takes an item first, the links may be stale, but
+        // the tag will have changed and the exchange will fail.
+        uint32_t last = first;
+        size_t   i    = 1;
+
+        while ((i < n) && (last < MAX_SIZE))
+        {
+          last = next_of(last);
+          ++i;
+        }
+
+        if (last < MAX_SIZE)
+        {
+          new_head = make_head(next_of(last), get_tag(head) + 1);
+
+          if (free_head.compare_exchange_weak(head, new_head, etl::memory_order_acquire, etl::memory_order_acquire))
+          {
+            break;
+          }
+        }
+        else
+        {
+          // Not enough items, unless the walk followed a stale link.
+          uint64_t current = free_head.load(etl::memory_order_acquire);
+
+          if (current == head)
+          {
+            items_allocated.fetch_sub(uint32_t(n), etl::memory_order_relaxed);
+            return NO_ITEM;
+          }
+
+          head = current;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Reserves items in the allocated count, before they are taken.
+    /// Reserves as many as are free, up to 'n'.
+    /// Returns the number reserved, or 0, reserving nothing, if fewer than
+    /// 'minimum' are free.
+    //*************************************************************************
+    size_t reserve(size_t minimum, size_t n)
+    {
+      uint32_t allocated = items_allocated.load(etl::memory_order_relaxed);
+      size_t   reserved;
+
+      do
+      {
+        const size_t n_free = MAX_SIZE - allocated;
+
+        if ((n_free == 0) || (n_free < minimum))
+        {
+          return 0;
+        }
+
+        reserved = (n < n_free) ? n : n_free;
+      } while (!items_allocated.compare_exchange_weak(allocated, uint32_t(allocated + reserved), etl::memory_order_relaxed, etl::memory_order_relaxed));
+
+      return reserved;
+    }
+
+    //*************************************************************************
+    /// Release an item back to the pool.
+    //*************************************************************************
+    void release_item(char* p_value)
+    {
+      // Does it belong to us?
+      if (is_item_in_pool(p_value))
+      {
+        uint32_t index = index_of(p_value);
+        release_chain(index, index, 1);
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes a linked chain of 'n' items on to the free stack.
+    /// The items are only taken off the allocated count once they are on the
+    /// stack, so the count is never less than the number in use.
+    //*************************************************************************
+    void release_chain(uint32_t first, uint32_t last, uint32_t n)
+    {
+      uint64_t head = free_head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        // Point the chain to the current free item.
+        next_of(last) = get_index(head);
+      } while (!free_head.compare_exchange_weak(head, make_head(first, get_tag(head) + 1), etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(n, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((ITEM_SIZE * MAX_SIZE) - ITEM_SIZE));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if defined(ETL_DEBUG)
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % ITEM_SIZE) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    iatomic_pool(const iatomic_pool&);
+    iatomic_pool& operator =(const iatomic_pool&);
+
+    char* p_buffer;
+
+    mutable etl::atomic_uint64_t free_head;       ///< The index of the first free item, tagged.
+    mutable etl::atomic_uint32_t items_allocated; ///< The number of items allocated.
+
+    const uint32_t ITEM_SIZE; ///< The size of allocated items.
+    const uint32_t MAX_SIZE;  ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iatomic_pool()
+    {
+    }
+#else
+  protected:
+    ~iatomic_pool()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated atomic pool implementation that uses a fixed size pool.
+  ///\ingroup atomic_pool
+  //*************************************************************************
+  template <typename T, const size_t SIZE_>
+  class atomic_pool : public etl::iatomic_pool
+  {
+  public:
+
+    static const size_t SIZE      = SIZE_;
+    static const size_t ALIGNMENT = etl::alignment_of<T>::value;
+    static const size_t TYPE_SIZE = sizeof(T);
+
+    STATIC_ASSERT(SIZE_ < 0xFFFFFFFFUL, "Too many items for atomic_pool");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    atomic_pool()
+      : etl::iatomic_pool(reinterpret_cast<char*>(&buffer[0]), ELEMENT_SIZE, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::allocate<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for 'n' objects from the pool.
+    /// Either all or none are allocated.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_n(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::allocate_n<U>(o_begin, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// Takes as many as are free, up to 'n'.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_up_to(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::allocate_up_to<U>(o_begin, n);
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return iatomic_pool::create<U>(std::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      iatomic_pool::release(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      uint32_t next;              ///< Index of the next free element.
+      char     value[sizeof(T)];  ///< Storage for value type.
+      typename etl::type_with_alignment<etl::alignment_of<T>::value>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[SIZE];
+
+    static const uint32_t ELEMENT_SIZE = sizeof(Element);
+
+    // Should not be copied.
+    atomic_pool(const atomic_pool&);
+    atomic_pool& operator =(const atomic_pool&);
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -48,6 +48,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "integral_limits.h"
 #include "exception.h"
+#include "hash.h"
 
 #define ETL_FILE "27"
 
@@ -581,14 +582,17 @@ namespace etl
       ETL_ASSERT(d >= 0, ETL_ERROR(string_iterator));
 #endif
 
-      initialise();
+      // Work on local copies, as stores to the buffer may alias the members.
+      T*     p      = p_buffer;
+      size_t length = 0;
 
-      while ((first != last) && (current_size != CAPACITY))
+      while ((first != last) && (length != CAPACITY))
       {
-        p_buffer[current_size++] = *first++;
+        p[length++] = *first++;
       }
 
-      p_buffer[current_size] = 0;
+      p[length]    = 0;
+      current_size = length;
     }
 
     //*********************************************************************
@@ -2226,6 +2230,19 @@ namespace etl
   {
     return !(lhs < rhs);
   }
+
+  //***************************************************************************
+  /// Hash function.
+  /// Gives the same value for all strings and string views with the same
+  /// characters, and for null terminated strings.
+  ///\ingroup string
+  //***************************************************************************
+#if ETL_8BIT_SUPPORT
+  template <typename T>
+  struct hash<etl::ibasic_string<T> > : public etl::private_hash::text_hash<T>
+  {
+  };
+#endif
 }
 
 #include "private/minmax_pop.h"
@@ -0,0 +1,674 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BITMAP_POOL_INCLUDED
+#define ETL_BITMAP_POOL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+
+#include "platform.h"
+#include "alignment.h"
+#include "bitset.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "pool.h"
+
+#undef ETL_FILE
+#define ETL_FILE "57"
+
+//*****************************************************************************
+///\defgroup bitmap_pool bitmap_pool
+/// A fixed capacity pool that tracks its items with a bitmap.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for bitmap pools of a particular type.
+  /// Each item has an occupancy bit in an etl::bitset. Allocation takes the
+  /// free item with the lowest address, so live objects stay packed at the
+  /// start of the buffer. is_in_pool tests the item's bit, and the live
+  /// objects may be iterated in address order.
+  ///\ingroup bitmap_pool
+  //***************************************************************************
+  template <typename T>
+  class ibitmap_pool
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef size_t   size_type;
+
+    //*************************************************************************
+    /// Iterator over the allocated items.
+    //*************************************************************************
+    class iterator : public std::iterator<std::forward_iterator_tag, T>
+    {
+    public:
+
+      friend class ibitmap_pool;
+
+      iterator()
+        : p_pool(nullptr),
+          index(ibitset::npos)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        index = p_pool->next_allocated(index);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        index = p_pool->next_allocated(index);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_pool->p_buffer[index];
+      }
+
+      pointer operator &() const
+      {
+        return &p_pool->p_buffer[index];
+      }
+
+      pointer operator ->() const
+      {
+        return &p_pool->p_buffer[index];
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(ibitmap_pool& pool, size_t index_)
+        : p_pool(&pool),
+          index(index_)
+      {
+      }
+
+      ibitmap_pool* p_pool;
+      size_t        index;
+    };
+
+    //*************************************************************************
+    /// Const iterator over the allocated items.
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::forward_iterator_tag, const T>
+    {
+    public:
+
+      friend class ibitmap_pool;
+
+      const_iterator()
+        : p_pool(nullptr),
+          index(ibitset::npos)
+      {
+      }
+
+      const_iterator(const typename ibitmap_pool::iterator& other)
+        : p_pool(other.p_pool),
+          index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        index = p_pool->next_allocated(index);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        index = p_pool->next_allocated(index);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_pool->p_buffer[index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &p_pool->p_buffer[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_pool->p_buffer[index];
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const ibitmap_pool& pool, size_t index_)
+        : p_pool(&pool),
+          index(index_)
+      {
+      }
+
+      const ibitmap_pool* p_pool;
+      size_t              index;
+    };
+
+    friend class iterator;
+    friend class const_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the allocated items.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, occupancy.find_first(true));
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the allocated items.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, occupancy.find_first(true));
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the allocated items.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, occupancy.find_first(true));
+    }
+
+    //*************************************************************************
+    /// Gets the end of the allocated items.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, ibitset::npos);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the allocated items.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, ibitset::npos);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the allocated items.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, ibitset::npos);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= etl::alignment_of<T>::value, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= sizeof(T), "Type too large for pool");
+
+      if (items_allocated < MAX_SIZE)
+      {
+        return reinterpret_cast<U*>(allocate_item());
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        return nullptr;
+      }
+    }
+
+    //*************************************************************************
+    /// Allocate storage for 'n' objects from the pool.
+    /// Either all or none are allocated.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    ///\param o_begin The output iterator for the pointers to the storage.
+    ///\param n       The number of objects.
+    ///\return An iterator to one past the last pointer written.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_n(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= etl::alignment_of<T>::value, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= sizeof(T), "Type too large for pool");
+
+      if (n <= available())
+      {
+        while (n-- != 0)
+        {
+          *o_begin++ = reinterpret_cast<U*>(allocate_item());
+        }
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
+
+      return o_begin;
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(std::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= etl::alignment_of<T>::value, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= sizeof(T), "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object is not allocated from
+    /// this pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      if (is_in_pool(p_object))
+      {
+        release_index(index_of(p_object));
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+      }
+    }
+
+    //*************************************************************************
+    /// Release a range of objects in the pool.
+    /// Either all or none are released.
+    /// If asserts or exceptions are enabled and any object is not allocated from
+    /// this pool then an etl::pool_object_not_in_pool is thrown.
+    ///\param first The iterator to the first pointer to an object.
+    ///\param last  The iterator to one past the last pointer to an object.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_n(TIterator first, TIterator last)
+    {
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        if (!is_in_pool(*itr))
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+          return;
+        }
+      }
+
+      while (first != last)
+      {
+        release_index(index_of(*first));
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    //*************************************************************************
+    void release_all()
+    {
+      occupancy.reset();
+      first_free      = 0;
+      items_allocated = 0;
+    }
+
+    //*************************************************************************
+    /// Check to see if the object is allocated from the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it is, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* p_object) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = static_cast<const char*>(p_object) - reinterpret_cast<const char*>(p_buffer);
+
+      bool is_valid_address = (distance >= 0) &&
+                              (distance < intptr_t(MAX_SIZE * sizeof(T))) &&
+                              ((distance % sizeof(T)) == 0);
+
+      return is_valid_address && occupancy.test(size_t(distance) / sizeof(T));
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - items_allocated;
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return items_allocated == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return items_allocated == MAX_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ibitmap_pool(T* p_buffer_, etl::ibitset& occupancy_, size_t max_size_)
+      : p_buffer(p_buffer_),
+        occupancy(occupancy_),
+        first_free(0),
+        items_allocated(0),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate the free item with the lowest address.
+    /// There must be a free item.
+    //*************************************************************************
+    T* allocate_item()
+    {
+      // No item below first_free is free.
+      size_t index = occupancy.find_next(false, first_free);
+
+      occupancy.set(index);
+      first_free = index + 1;
+      ++items_allocated;
+
+      return p_buffer + index;
+    }
+
+    //*************************************************************************
+    /// Release the item at the index.
+    //*************************************************************************
+    void release_index(size_t index)
+    {
+      occupancy.reset(index);
+      first_free = (index < first_free) ? index : first_free;
+      --items_allocated;
+    }
+
+    //*************************************************************************
+    /// The index of an item in the pool.
+    //*************************************************************************
+    size_t index_of(const void* p_object) const
+    {
+      return size_t(static_cast<const T*>(p_object) - p_buffer);
+    }
+
+    //*************************************************************************
+    /// The index of the next allocated item after 'index'.
+    //*************************************************************************
+    size_t next_allocated(size_t index) const
+    {
+      return (index + 1 < MAX_SIZE) ? occupancy.find_next(true, index + 1) : size_t(ibitset::npos);
+    }
+
+    // Disable copy construction and assignment.
+    ibitmap_pool(const ibitmap_pool&);
+    ibitmap_pool& operator =(const ibitmap_pool&);
+
+    T*            p_buffer;        ///< The storage for the items.
+    etl::ibitset& occupancy;       ///< One bit per item, set if allocated.
+    size_t        first_free;      ///< No item below this index is free.
+    size_t        items_allocated; ///< The number of items allocated.
+    const size_t  MAX_SIZE;        ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibitmap_pool()
+    {
+    }
+#else
+  protected:
+    ~ibitmap_pool()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated bitmap pool implementation that uses a fixed size pool.
+  ///\ingroup bitmap_pool
+  //*************************************************************************
+  template <typename T, const size_t SIZE_>
+  class bitmap_pool : public etl::ibitmap_pool<T>
+  {
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    bitmap_pool()
+      : etl::ibitmap_pool<T>(reinterpret_cast<T*>(&buffer[0]), occupancy_bits, SIZE)
+    {
+    }
+
+  private:
+
+    etl::bitset<SIZE> occupancy_bits; ///< One bit per item, set if allocated.
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[SIZE];
+
+    // Should not be copied.
+    bitmap_pool(const bitmap_pool&);
+    bitmap_pool& operator =(const bitmap_pool&);
+  };
+}
+
+#undef ETL_FILE
+
+#endif
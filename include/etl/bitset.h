@@ -461,40 +461,22 @@ namespace etl
         bit = position & (BITS_PER_ELEMENT - 1);
       }
 
-      element_t mask = 1 << bit;
-
       // For each element in the bitset...
       while (index < SIZE)
       {
-        element_t value = pdata[index];
+        // The bits in the required state, from the start bit.
+        element_t candidates = element_t((state ? pdata[index] : element_t(~pdata[index])) & element_t(ALL_SET << bit));
 
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-          (!state && (value != ALL_SET)))
+        if (candidates != 0)
         {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
-        {
-          position += BITS_PER_ELEMENT;
+          position = (index * BITS_PER_ELEMENT) + etl::count_trailing_zeros(candidates);
+
+          // The unused bits at the end of the last element are clear.
+          return (position < NBITS) ? position : size_t(ibitset::npos);
         }
 
         // Start at the beginning for all other elements.
         bit = 0;
-        mask = 1;
 
         ++index;
       }
@@ -0,0 +1,387 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BLOCKED_BLOOM_FILTER_INCLUDED
+#define ETL_BLOCKED_BLOOM_FILTER_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "binary.h"
+#include "static_assert.h"
+#include "private/prefetch.h"
+#include "private/hash_mix.h"
+
+#if defined(ETL_BLOOM_FILTER_HARDWARE_X86)
+  #include "private/blocked_bloom_filter_x86.h"
+#endif
+
+#if !defined(ETL_BLOOM_FILTER_BATCH_SIZE)
+  #define ETL_BLOOM_FILTER_BATCH_SIZE 16
+#endif
+
+///\defgroup blocked_bloom_filter blocked_bloom_filter
+/// A cache line blocked Bloom filter
+///\ingroup containers
+
+namespace etl
+{
+  namespace private_blocked_bloom_filter
+  {
+    //*************************************************************************
+    /// The multipliers that select one bit in each 64 bit word of a block.
+    //*************************************************************************
+    template <typename T = void>
+    struct salt
+    {
+      static const uint32_t value[8];
+    };
+
+    template <typename T>
+    const uint32_t salt<T>::value[8] =
+    {
+      0x47B6137BUL, 0x44974D91UL, 0x8824AD5BUL, 0xA2B7289DUL,
+      0x705495C7UL, 0x2DF1424BUL, 0x9EFC4947UL, 0x5C6BFB31UL
+    };
+
+    //*************************************************************************
+    /// Sets the key's bits in a block, one word at a time.
+    //*************************************************************************
+    inline void set_block_scalar(uint64_t* block, uint32_t key)
+    {
+      for (size_t i = 0; i < 8; ++i)
+      {
+        block[i] |= uint64_t(1) << ((key * salt<>::value[i]) >> 26);
+      }
+    }
+
+    //*************************************************************************
+    /// Tests the key's bits in a block, one word at a time.
+    //*************************************************************************
+    inline bool test_block_scalar(const uint64_t* block, uint32_t key)
+    {
+      // Absent keys usually fail within the first few words.
+      for (size_t i = 0; i < 8; ++i)
+      {
+        if ((block[i] & (uint64_t(1) << ((key * salt<>::value[i]) >> 26))) == 0)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Sets the key's bits in a block.
+    /// If the compiler targets AVX2 the AVX2 code is inlined, otherwise it is
+    /// selected at run time by a CPUID check.
+    //*************************************************************************
+    inline void set_block(uint64_t* block, uint32_t key)
+    {
+#if defined(ETL_BLOOM_FILTER_HARDWARE_X86) && defined(__AVX2__)
+      set_block_avx2(block, key);
+#elif defined(ETL_BLOOM_FILTER_HARDWARE_X86)
+      set_block_x86(block, key);
+#else
+      set_block_scalar(block, key);
+#endif
+    }
+
+    //*************************************************************************
+    /// Tests the key's bits in a block.
+    /// If the compiler targets AVX2 the AVX2 code is inlined, otherwise it is
+    /// selected at run time by a CPUID check.
+    //*************************************************************************
+    inline bool test_block(const uint64_t* block, uint32_t key)
+    {
+#if defined(ETL_BLOOM_FILTER_HARDWARE_X86) && defined(__AVX2__)
+      return test_block_avx2(block, key);
+#elif defined(ETL_BLOOM_FILTER_HARDWARE_X86)
+      return test_block_x86(block, key);
+#else
+      return test_block_scalar(block, key);
+#endif
+    }
+  }
+
+  //***************************************************************************
+  /// A Bloom filter where all of the probes for a key fall inside a single
+  /// 64 byte block, so a query costs at most one cache miss.
+  /// One hash selects the block and sets one bit in each of its eight 64 bit words.
+  /// The hash must support the () operator and define 'argument_type'.
+  ///\tparam DESIRED_WIDTH The desired number of bits. Rounded up to a whole number of blocks.
+  ///\tparam THash         The hash generator class.
+  ///\ingroup blocked_bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH, typename THash>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+    static const size_t BLOCK_WORDS = 8;
+    static const size_t BLOCK_BYTES = BLOCK_WORDS * sizeof(uint64_t);
+
+  public:
+
+    static const size_t BLOCK_BITS       = BLOCK_BYTES * 8;
+    static const size_t NUMBER_OF_BLOCKS = (DESIRED_WIDTH == 0) ? 1 : (DESIRED_WIDTH + BLOCK_BITS - 1) / BLOCK_BITS;
+    static const size_t WIDTH            = NUMBER_OF_BLOCKS * BLOCK_BITS;
+    static const size_t BATCH_SIZE       = ETL_BLOOM_FILTER_BATCH_SIZE;
+
+    STATIC_ASSERT(BATCH_SIZE > 0, "Batch size must be greater than zero");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    blocked_bloom_filter(const blocked_bloom_filter& other)
+    {
+      *this = other;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The blocks may be at a different offset in each object's storage.
+    //*************************************************************************
+    blocked_bloom_filter& operator =(const blocked_bloom_filter& rhs)
+    {
+      if (&rhs != this)
+      {
+        const uint64_t* source      = rhs.get_block(0);
+        uint64_t*       destination = get_block(0);
+
+        for (size_t i = 0; i < (NUMBER_OF_BLOCKS * BLOCK_WORDS); ++i)
+        {
+          destination[i] = source[i];
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Clears the bloom filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0; i < ((NUMBER_OF_BLOCKS + 1) * BLOCK_WORDS); ++i)
+      {
+        storage[i] = 0;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //*************************************************************************
+    void add(parameter_t key)
+    {
+      size_t   block;
+      uint32_t block_key;
+
+      get_probe(key, block, block_key);
+
+      private_blocked_bloom_filter::set_block(get_block(block), block_key);
+    }
+
+    //*************************************************************************
+    /// Adds a range of keys to the filter.
+    /// The keys are hashed BATCH_SIZE at a time and their blocks prefetched
+    /// before any are written, so the cache misses overlap.
+    ///\param first The first key.
+    ///\param last  One past the last key.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_batch(TIterator first, TIterator last)
+    {
+      size_t   block[BATCH_SIZE];
+      uint32_t block_key[BATCH_SIZE];
+
+      while (first != last)
+      {
+        size_t n = 0;
+
+        while ((first != last) && (n < BATCH_SIZE))
+        {
+          get_probe(*first, block[n], block_key[n]);
+          etl::private_prefetch::prefetch_write(get_block(block[n]));
+          ++first;
+          ++n;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          private_blocked_bloom_filter::set_block(get_block(block[i]), block_key[i]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      size_t   block;
+      uint32_t block_key;
+
+      get_probe(key, block, block_key);
+
+      return private_blocked_bloom_filter::test_block(get_block(block), block_key);
+    }
+
+    //*************************************************************************
+    /// Tests a range of keys to see if they exist in the filter.
+    /// The keys are hashed BATCH_SIZE at a time and their blocks prefetched
+    /// before any are tested, so the cache misses overlap.
+    ///\param first  The first key.
+    ///\param last   One past the last key.
+    ///\param result Receives a <b>bool</b> for each key; <b>true</b> if it exists in the filter.
+    ///\return The number of keys that exist in the filter.
+    //*************************************************************************
+    template <typename TIterator, typename TOutputIterator>
+    size_t exists_batch(TIterator first, TIterator last, TOutputIterator result) const
+    {
+      size_t   block[BATCH_SIZE];
+      uint32_t block_key[BATCH_SIZE];
+      size_t   found = 0;
+
+      while (first != last)
+      {
+        size_t n = 0;
+
+        while ((first != last) && (n < BATCH_SIZE))
+        {
+          get_probe(*first, block[n], block_key[n]);
+          etl::private_prefetch::prefetch_read(get_block(block[n]));
+          ++first;
+          ++n;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          const bool exists = private_blocked_bloom_filter::test_block(get_block(block[i]), block_key[i]);
+
+          found += exists ? 1 : 0;
+          *result++ = exists;
+        }
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Returns the width of the Bloom filter.
+    //*************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //*************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //*************************************************************************
+    size_t usage() const
+    {
+      return size_t((100 * uint64_t(count())) / WIDTH);
+    }
+
+    //*************************************************************************
+    /// Returns the number of filter flags set.
+    //*************************************************************************
+    size_t count() const
+    {
+      const uint64_t* words = get_block(0);
+      size_t total = 0;
+
+      for (size_t i = 0; i < (NUMBER_OF_BLOCKS * BLOCK_WORDS); ++i)
+      {
+        total += etl::count_bits(words[i]);
+      }
+
+      return total;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the block index and the in-block key for a key.
+    /// The high half of the mixed hash selects the block and the low half
+    /// selects the bits.
+    //*************************************************************************
+    static void get_probe(parameter_t key, size_t& block, uint32_t& block_key)
+    {
+      const uint64_t hash = etl::private_hash::fmix_64(uint64_t(THash()(key)));
+
+      // Map the high half onto the blocks without a division.
+      block     = size_t((uint64_t(uint32_t(hash >> 32)) * NUMBER_OF_BLOCKS) >> 32);
+      block_key = uint32_t(hash);
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to a block.
+    /// The storage has one spare block so that the blocks can start on a 64 byte boundary.
+    //*************************************************************************
+    uint64_t* get_block(size_t index)
+    {
+      uintptr_t address = (reinterpret_cast<uintptr_t>(storage) + (BLOCK_BYTES - 1)) & ~uintptr_t(BLOCK_BYTES - 1);
+
+      return reinterpret_cast<uint64_t*>(address) + (index * BLOCK_WORDS);
+    }
+
+    //*************************************************************************
+    /// Gets a const pointer to a block.
+    //*************************************************************************
+    const uint64_t* get_block(size_t index) const
+    {
+      uintptr_t address = (reinterpret_cast<uintptr_t>(storage) + (BLOCK_BYTES - 1)) & ~uintptr_t(BLOCK_BYTES - 1);
+
+      return reinterpret_cast<const uint64_t*>(address) + (index * BLOCK_WORDS);
+    }
+
+    /// The Bloom filter blocks, plus one spare block for alignment.
+    uint64_t storage[(NUMBER_OF_BLOCKS + 1) * BLOCK_WORDS];
+  };
+}
+
+#endif
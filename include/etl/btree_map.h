@@ -0,0 +1,389 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+#include "platform.h"
+#include "pool.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "private/btree_base.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "52"
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map with the capacity defined at compile time, stored as a B+ tree.
+/// Each node holds many elements, sized by ETL_BTREE_NODE_SIZE, so lookups
+/// touch far fewer cache lines than the one element per node etl::map, and
+/// iteration walks the elements in place.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized btree_maps.
+  /// Can be used as a reference type for all btree_maps containing a specific type.
+  /// Insertion and erasure invalidate iterators, as elements move between nodes.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey> >
+  class ibtree_map : public etl::private_btree::ibtree<TKey, std::pair<const TKey, TMapped>, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_btree::ibtree<TKey, std::pair<const TKey, TMapped>, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::key_type        key_type;
+    typedef typename base::value_type      value_type;
+    typedef TMapped                        mapped_type;
+    typedef typename base::key_compare     key_compare;
+    typedef typename base::reference       reference;
+    typedef typename base::const_reference const_reference;
+    typedef typename base::pointer         pointer;
+    typedef typename base::const_pointer   const_pointer;
+    typedef typename base::size_type       size_type;
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+  protected:
+
+    typedef typename base::key_parameter_t key_parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    struct value_comp
+    {
+      bool operator ()(const value_type& value1, const value_type& value2) const
+      {
+        return key_compare()(value1.first, value2.first);
+      }
+    };
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        // Doesn't exist, so create a new one.
+        i_element = this->insert_unique(value_type(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_full if the btree_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_full if the btree_map is already full.
+    ///\param value The value to insert.
+    ///\return A pair of the iterator to the element and <b>true</b> if it was inserted.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+      return this->insert_unique(value);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_full if the btree_map is already full.
+    ///\param position The position that would precede the value to insert. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const value_type& value)
+    {
+      (void)position;
+
+      return this->insert_unique(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_full if the btree_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        this->insert_unique(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_map(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_type max_size_)
+      : base(leaf_pool_, internal_pool_, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the btree_maps are equal, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the btree_maps are not equal, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically less than the second.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// A btree_map implementation that uses fixed size pools of nodes.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  ///\tparam TCompare The key comparison functor.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare>                                   base;
+    typedef etl::private_btree::ibtree<TKey, std::pair<const TKey, TValue>, TCompare> tree;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base::value_type> init)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    typedef typename tree::template node_count<MAX_SIZE> node_count;
+
+    /// The pools of leaf and internal nodes.
+    etl::pool<typename tree::leaf_node, node_count::LEAVES>       leaf_pool;
+    etl::pool<typename tree::internal_node, node_count::INTERNAL> internal_pool;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
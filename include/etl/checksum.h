@@ -28,16 +28,109 @@ SOFTWARE.
 #define ETL_CHECKSUM_INCLUDED
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "platform.h"
 #include "binary.h"
+#include "integral_limits.h"
 #include "frame_check_sequence.h"
 
+#if defined(ETL_CHECKSUM_HARDWARE_X86)
+  #include "private/checksum_x86.h"
+#endif
+
 ///\defgroup checksum Checksum calculation
 ///\ingroup maths
 
 namespace etl
 {
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// Reads eight bytes in native order.
+    //*************************************************************************
+    inline uint64_t read_64(const uint8_t* data)
+    {
+      uint64_t value;
+      memcpy(&value, data, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// The sum of the bytes, eight at a time.
+    /// The bytes are added to four 16 bit lanes, which are folded before they
+    /// can overflow.
+    //*************************************************************************
+    inline uint64_t sum_block(const uint8_t* data, size_t length)
+    {
+      const uint64_t MASK      = 0x00FF00FF00FF00FFULL;
+      const size_t   MAX_WORDS = 128U; // 128 * 2 * 255 < 65536
+
+      uint64_t sum = 0U;
+
+      while (length >= 8U)
+      {
+        size_t words = length / 8U;
+
+        if (words > MAX_WORDS)
+        {
+          words = MAX_WORDS;
+        }
+
+        length -= words * 8U;
+
+        uint64_t lanes = 0U;
+
+        while (words-- != 0U)
+        {
+          const uint64_t value = read_64(data);
+          lanes += (value & MASK) + ((value >> 8U) & MASK);
+          data  += 8U;
+        }
+
+        lanes = (lanes & 0x0000FFFF0000FFFFULL) + ((lanes >> 16U) & 0x0000FFFF0000FFFFULL);
+        sum  += (lanes & 0xFFFFFFFFULL) + (lanes >> 32U);
+      }
+
+      while (length-- != 0U)
+      {
+        sum += *data++;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// The xor of the bytes, eight at a time.
+    //*************************************************************************
+    inline uint8_t xor_block(const uint8_t* data, size_t length)
+    {
+      uint64_t lanes = 0U;
+
+      while (length >= 8U)
+      {
+        lanes  ^= read_64(data);
+        data   += 8U;
+        length -= 8U;
+      }
+
+      lanes ^= lanes >> 32U;
+      lanes ^= lanes >> 16U;
+      lanes ^= lanes >> 8U;
+
+      uint8_t result = uint8_t(lanes);
+
+      while (length-- != 0U)
+      {
+        result ^= *data++;
+      }
+
+      return result;
+    }
+  }
+
   //***************************************************************************
   /// Standard addition checksum policy.
   //***************************************************************************
@@ -56,6 +149,15 @@ namespace etl
       return sum + value;
     }
 
+    inline T add_block(T sum, const uint8_t* data, size_t length) const
+    {
+#if defined(ETL_CHECKSUM_HARDWARE_X86)
+      return T(sum + private_checksum::sum_x86(data, length));
+#else
+      return T(sum + private_checksum::sum_block(data, length));
+#endif
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -104,6 +206,15 @@ namespace etl
       return sum ^ value;
     }
 
+    inline T add_block(T sum, const uint8_t* data, size_t length) const
+    {
+#if defined(ETL_CHECKSUM_HARDWARE_X86)
+      return T(sum ^ private_checksum::xor_x86(data, length));
+#else
+      return T(sum ^ private_checksum::xor_block(data, length));
+#endif
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -128,6 +239,52 @@ namespace etl
       return etl::rotate_left(sum) ^ value;
     }
 
+    //*************************************************************************
+    /// Over a whole number of blocks of BITS bytes the sum rotates back to
+    /// where it started, and every byte at the same offset in a block is
+    /// rotated by the same amount. So the blocks are xored together first,
+    /// eight bytes at a time, and each offset rotated once.
+    //*************************************************************************
+    inline T add_block(T sum, const uint8_t* data, size_t length) const
+    {
+      const size_t BITS  = etl::integral_limits<T>::bits;
+      const size_t WORDS = BITS / 8U;
+
+      if (length >= BITS)
+      {
+        uint64_t lanes[WORDS] = { 0 };
+
+        while (length >= BITS)
+        {
+          for (size_t i = 0U; i < WORDS; ++i)
+          {
+            lanes[i] ^= private_checksum::read_64(data + (i * 8U));
+          }
+
+          data   += BITS;
+          length -= BITS;
+        }
+
+        uint8_t bytes[BITS];
+        memcpy(bytes, lanes, BITS);
+
+        // The last offset is not rotated.
+        for (size_t i = 0U; i < (BITS - 1U); ++i)
+        {
+          sum ^= etl::rotate_left(T(bytes[i]), BITS - 1U - i);
+        }
+
+        sum ^= T(bytes[BITS - 1U]);
+      }
+
+      while (length-- != 0U)
+      {
+        sum = add(sum, *data++);
+      }
+
+      return sum;
+    }
+
     inline T final(T sum) const
     {
       return sum;
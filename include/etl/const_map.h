@@ -0,0 +1,494 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_MAP_INCLUDED
+#define ETL_CONST_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "string_view.h"
+#include "fnv_1.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#undef ETL_FILE
+#define ETL_FILE "54"
+
+//*****************************************************************************
+///\defgroup const_map const_map
+/// A read only map with a set of keys that is known at compile time.
+/// The table is built by a constexpr constructor, so a constexpr const_map
+/// needs no startup code and may be placed in read only memory.
+/// The keys are placed with a minimal perfect hash, so a lookup costs one
+/// hash of the key and one key comparison.
+/// Requires C++14.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_CPP14_SUPPORTED
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for const_map.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_exception : public etl::exception
+  {
+  public:
+
+    const_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The keys could not be placed, most likely because one is repeated.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_invalid_keys : public etl::const_map_exception
+  {
+  public:
+
+    const_map_invalid_keys(string_type file_name_, numeric_type line_number_)
+      : etl::const_map_exception(ETL_ERROR_TEXT("const_map:keys", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The key is not in the const_map.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_out_of_bounds : public etl::const_map_exception
+  {
+  public:
+
+    const_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::const_map_exception(ETL_ERROR_TEXT("const_map:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_const_map
+  {
+    //*************************************************************************
+    /// The splitmix64 finaliser.
+    //*************************************************************************
+    constexpr uint64_t mix(uint64_t value)
+    {
+      value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+      return value ^ (value >> 31);
+    }
+
+    //*************************************************************************
+    /// Called when the keys cannot be placed.
+    /// As it is not constexpr, a constexpr const_map fails to compile.
+    //*************************************************************************
+    inline void keys_failed()
+    {
+      ETL_ASSERT(false, ETL_ERROR(const_map_invalid_keys));
+    }
+  }
+
+  //***************************************************************************
+  /// The hash used by const_map, which may be calculated at compile time.
+  /// Integral and enum keys are mixed with the splitmix64 finaliser.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey>
+  struct const_map_hash
+  {
+    STATIC_ASSERT(etl::is_integral<TKey>::value || etl::is_enum<TKey>::value, "No const_map_hash for this key type");
+
+    constexpr uint64_t operator ()(const TKey& key) const
+    {
+      return etl::private_const_map::mix(static_cast<uint64_t>(key));
+    }
+  };
+
+  //***************************************************************************
+  /// The hash used by const_map for string views.
+  /// Uses FNV-1a 64 over the bytes of each character.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  struct const_map_hash<etl::basic_string_view<T, TTraits> >
+  {
+    constexpr uint64_t operator ()(const etl::basic_string_view<T, TTraits>& key) const
+    {
+      etl::fnv_1a_policy_64 policy;
+      uint64_t hash = policy.initial();
+
+      for (size_t i = 0; i < key.size(); ++i)
+      {
+        for (size_t byte = 0; byte < sizeof(T); ++byte)
+        {
+          hash = policy.add(hash, uint8_t(uint64_t(key[i]) >> (byte * 8)));
+        }
+      }
+
+      return policy.final(hash);
+    }
+  };
+
+  //***************************************************************************
+  /// A read only map, built at compile time with a minimal perfect hash.
+  /// Each key selects a bucket, and each bucket has a displacement that is
+  /// mixed with the key's hash to give the element's slot. The builder
+  /// chooses the displacements, largest bucket first, so that no two keys
+  /// share a slot and every slot is used. A bucket with one key stores its
+  /// slot directly, so the last free slots need no search.
+  /// The build is linear in the number of elements. A constexpr const_map
+  /// of 1000 elements takes GCC about 600000 constexpr operations, inside the
+  /// default limits of GCC and Clang. Larger maps may need the compiler's
+  /// limit raised, with -fconstexpr-ops-limit or -fconstexpr-steps.
+  /// The key and mapped types must be literal types with constexpr default
+  /// constructors and assignment.
+  ///\tparam TKey      The key type.
+  ///\tparam TMapped   The mapped type.
+  ///\tparam SIZE_     The number of elements.
+  ///\tparam THash     The hash functor. Must be constexpr.
+  ///\tparam TKeyEqual The key equality functor. Must be constexpr.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t SIZE_, typename THash = etl::const_map_hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class const_map
+  {
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    STATIC_ASSERT(SIZE > 0, "const_map must not be empty");
+
+    //*************************************************************************
+    /// The element type.
+    //*************************************************************************
+    struct value_type
+    {
+      TKey    first  = TKey();
+      TMapped second = TMapped();
+    };
+
+    typedef TKey              key_type;
+    typedef TMapped           mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef const value_type* iterator;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Builds the table from an array of elements.
+    /// If the keys cannot be placed, which happens if a key is repeated, a
+    /// constexpr const_map will not compile.
+    //*************************************************************************
+    constexpr explicit const_map(const value_type (&values)[SIZE])
+      : elements()
+      , displacements()
+    {
+      build(values);
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*************************************************************************
+    constexpr const_iterator find(const key_type& key) const
+    {
+      const uint64_t hash = hasher()(key);
+      const value_type* p_element = &elements[slot(hash, displacements[bucket(hash)])];
+
+      return key_equal()(p_element->first, key) ? p_element : end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with a key.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    constexpr size_type count(const key_type& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*************************************************************************
+    /// Gets the mapped value for a key.
+    /// If asserts or exceptions are enabled, emits const_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(const_map_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the elements.
+    /// The elements are in hash order.
+    //*************************************************************************
+    constexpr const_iterator begin() const
+    {
+      return elements;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the elements.
+    //*************************************************************************
+    constexpr const_iterator cbegin() const
+    {
+      return elements;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the elements.
+    //*************************************************************************
+    constexpr const_iterator end() const
+    {
+      return elements + SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the elements.
+    //*************************************************************************
+    constexpr const_iterator cend() const
+    {
+      return elements + SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    constexpr size_type size() const
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    constexpr size_type max_size() const
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// Always false.
+    //*************************************************************************
+    constexpr bool empty() const
+    {
+      return false;
+    }
+
+  private:
+
+    /// One bucket per element keeps most buckets to one or two keys.
+    static const size_t BUCKETS = SIZE;
+
+    /// The number of displacements tried for a bucket before giving up.
+    /// Buckets of more than one key are placed while at least a third of
+    /// the slots are free, so few attempts are needed.
+    static const uint64_t MAX_ATTEMPTS = 0x400;
+
+    /// A displacement with this bit set is the slot of the bucket's only key.
+    static const uint64_t DIRECT = UINT64_C(1) << 63;
+
+    //*************************************************************************
+    /// Gets the bucket for a hash, from its upper bits.
+    //*************************************************************************
+    static constexpr size_t bucket(uint64_t hash)
+    {
+      return size_t((hash >> 32) % BUCKETS);
+    }
+
+    //*************************************************************************
+    /// Gets the slot for a hash, with a bucket's displacement.
+    /// The result is re-mixed, as XOR alone cannot separate hashes that are
+    /// equal modulo SIZE.
+    //*************************************************************************
+    static constexpr size_t slot(uint64_t hash, uint64_t displacement)
+    {
+      return ((displacement & DIRECT) != 0) ? size_t(displacement & ~DIRECT)
+                                            : size_t(etl::private_const_map::mix(hash ^ displacement) % SIZE);
+    }
+
+    //*************************************************************************
+    /// Places the elements.
+    //*************************************************************************
+    constexpr void build(const value_type (&values)[SIZE])
+    {
+      uint64_t hashes[SIZE]  = {};
+      size_t   start[BUCKETS + 1] = {};
+      size_t   order[SIZE]   = {};
+      bool     used[SIZE]    = {};
+      size_t   largest = 0;
+
+      // Group the elements by bucket.
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        hashes[i] = hasher()(values[i].first);
+        ++start[bucket(hashes[i]) + 1];
+      }
+
+      for (size_t b = 0; b < BUCKETS; ++b)
+      {
+        largest = (start[b + 1] > largest) ? start[b + 1] : largest;
+        start[b + 1] += start[b];
+      }
+
+      {
+        size_t next[BUCKETS] = {};
+
+        for (size_t i = 0; i < SIZE; ++i)
+        {
+          const size_t b = bucket(hashes[i]);
+          order[start[b] + next[b]] = i;
+          ++next[b];
+        }
+      }
+
+      // Place the largest buckets first, while the table is emptiest.
+      for (size_t bucket_size = largest; bucket_size > 1; --bucket_size)
+      {
+        for (size_t b = 0; b < BUCKETS; ++b)
+        {
+          if ((start[b + 1] - start[b]) == bucket_size)
+          {
+            place_bucket(values, hashes, order + start[b], bucket_size, used, b);
+          }
+        }
+      }
+
+      // Give each single key bucket the next free slot.
+      size_t free_slot = 0;
+
+      for (size_t b = 0; b < BUCKETS; ++b)
+      {
+        if ((start[b + 1] - start[b]) == 1)
+        {
+          while (used[free_slot])
+          {
+            ++free_slot;
+          }
+
+          used[free_slot] = true;
+          displacements[b] = DIRECT | free_slot;
+          set_element(free_slot, values[order[start[b]]]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds a displacement that puts every element of a bucket in a free slot.
+    //*************************************************************************
+    constexpr void place_bucket(const value_type (&values)[SIZE],
+                                const uint64_t* hashes,
+                                const size_t*   members,
+                                size_t          n,
+                                bool*           used,
+                                size_t          b)
+    {
+      // A repeated key would collide with itself for every displacement.
+      for (size_t i = 1; i < n; ++i)
+      {
+        for (size_t j = 0; j < i; ++j)
+        {
+          if ((hashes[members[i]] == hashes[members[j]]) && key_equal()(values[members[i]].first, values[members[j]].first))
+          {
+            etl::private_const_map::keys_failed();
+            return;
+          }
+        }
+      }
+
+      for (uint64_t attempt = 0; attempt < MAX_ATTEMPTS; ++attempt)
+      {
+        const uint64_t displacement = etl::private_const_map::mix(attempt) & ~DIRECT;
+        size_t placed = 0;
+
+        while ((placed < n) && !used[slot(hashes[members[placed]], displacement)])
+        {
+          used[slot(hashes[members[placed]], displacement)] = true;
+          ++placed;
+        }
+
+        if (placed == n)
+        {
+          displacements[b] = displacement;
+
+          for (size_t i = 0; i < n; ++i)
+          {
+            set_element(slot(hashes[members[i]], displacement), values[members[i]]);
+          }
+
+          return;
+        }
+
+        // Release the slots taken by this attempt.
+        while (placed > 0)
+        {
+          --placed;
+          used[slot(hashes[members[placed]], displacement)] = false;
+        }
+      }
+
+      etl::private_const_map::keys_failed();
+    }
+
+    //*************************************************************************
+    /// Copies an element to its slot.
+    //*************************************************************************
+    constexpr void set_element(size_t index, const value_type& value)
+    {
+      elements[index].first  = value.first;
+      elements[index].second = value.second;
+    }
+
+    value_type elements[SIZE];         ///< The elements, in slot order.
+    uint64_t   displacements[BUCKETS]; ///< The displacement for each bucket.
+  };
+}
+
+#endif
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,644 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_INCLUDED
+#define ETL_CRC_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+#include <iterator>
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+#include "smallest.h"
+#include "static_assert.h"
+
+///\defgroup crc Generic CRC calculation
+/// The tables are generated at compile time and placed in read only storage.
+///\ingroup maths
+
+//*****************************************************************************
+/// The table size used by the predefined CRCs.
+/// 16   : Nibble table.
+/// 256  : Byte table.
+/// 1024 : Slice-by-4 tables.
+/// 2048 : Slice-by-8 tables.
+//*****************************************************************************
+#if !defined(ETL_CRC_TABLE_SIZE)
+  #if defined(ETL_CRC_SLICE_BY_8)
+    #define ETL_CRC_TABLE_SIZE 2048
+  #else
+    #define ETL_CRC_TABLE_SIZE 256
+  #endif
+#endif
+
+//*****************************************************************************
+// Table initialiser lists.
+// 'entry' is a member template of the table class.
+//*****************************************************************************
+#define ETL_CRC_ENTRIES_4(N)   entry<(N)>::value, entry<(N) + 1>::value, entry<(N) + 2>::value, entry<(N) + 3>::value
+#define ETL_CRC_ENTRIES_16(N)  ETL_CRC_ENTRIES_4(N),  ETL_CRC_ENTRIES_4((N) + 4),   ETL_CRC_ENTRIES_4((N) + 8),   ETL_CRC_ENTRIES_4((N) + 12)
+#define ETL_CRC_ENTRIES_64(N)  ETL_CRC_ENTRIES_16(N), ETL_CRC_ENTRIES_16((N) + 16), ETL_CRC_ENTRIES_16((N) + 32), ETL_CRC_ENTRIES_16((N) + 48)
+#define ETL_CRC_ENTRIES_256(N) ETL_CRC_ENTRIES_64(N), ETL_CRC_ENTRIES_64((N) + 64), ETL_CRC_ENTRIES_64((N) + 128), ETL_CRC_ENTRIES_64((N) + 192)
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Reflects the lowest BITS bits of VALUE.
+    //*************************************************************************
+    template <typename T, const T VALUE, const size_t BITS>
+    struct reflect_bits
+    {
+      static const T value = T(((VALUE & 1U) << (BITS - 1U)) | reflect_bits<T, T(VALUE >> 1U), BITS - 1U>::value);
+    };
+
+    template <typename T, const T VALUE>
+    struct reflect_bits<T, VALUE, 0U>
+    {
+      static const T value = 0U;
+    };
+
+    //*************************************************************************
+    /// A mask for the lowest WIDTH bits.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH>
+    struct crc_mask
+    {
+      static const T value = T((T(1U) << (WIDTH - 1U)) | ((T(1U) << (WIDTH - 1U)) - 1U));
+    };
+
+    //*************************************************************************
+    /// Shifts a zero bit in to the CRC register.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const T VALUE>
+    struct crc_step;
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const T VALUE>
+    struct crc_step<T, WIDTH, POLYNOMIAL, true, VALUE>
+    {
+      static const T value = T((VALUE & 1U) ? ((VALUE >> 1U) ^ reflect_bits<T, POLYNOMIAL, WIDTH>::value) : (VALUE >> 1U));
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const T VALUE>
+    struct crc_step<T, WIDTH, POLYNOMIAL, false, VALUE>
+    {
+      static const T value = T(((VALUE & (T(1U) << (WIDTH - 1U))) ? ((VALUE << 1U) ^ POLYNOMIAL) : (VALUE << 1U)) & crc_mask<T, WIDTH>::value);
+    };
+
+    //*************************************************************************
+    /// Shifts COUNT zero bits in to the CRC register.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const T VALUE, const size_t COUNT>
+    struct crc_steps
+    {
+      static const T value = crc_steps<T, WIDTH, POLYNOMIAL, REFLECT, crc_step<T, WIDTH, POLYNOMIAL, REFLECT, VALUE>::value, COUNT - 1U>::value;
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const T VALUE>
+    struct crc_steps<T, WIDTH, POLYNOMIAL, REFLECT, VALUE, 0U>
+    {
+      static const T value = VALUE;
+    };
+
+    //*************************************************************************
+    /// A table entry for a chunk of CHUNK_BITS bits.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t CHUNK_BITS, const size_t INDEX>
+    struct crc_table_entry
+    {
+      static const T value = crc_steps<T, WIDTH, POLYNOMIAL, REFLECT, (REFLECT ? T(INDEX) : T(T(INDEX) << (WIDTH - CHUNK_BITS))), CHUNK_BITS>::value;
+    };
+
+    //*************************************************************************
+    /// The nibble and byte tables.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t CHUNK_BITS>
+    struct crc_table;
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 4U>
+    {
+      template <const size_t INDEX>
+      struct entry : public crc_table_entry<T, WIDTH, POLYNOMIAL, REFLECT, 4U, INDEX>
+      {
+      };
+
+      static const T table[16];
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    const T crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 4U>::table[16] =
+    {
+      ETL_CRC_ENTRIES_16(0)
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 8U>
+    {
+      template <const size_t INDEX>
+      struct entry : public crc_table_entry<T, WIDTH, POLYNOMIAL, REFLECT, 8U, INDEX>
+      {
+      };
+
+      static const T table[256];
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    const T crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 8U>::table[256] =
+    {
+      ETL_CRC_ENTRIES_256(0)
+    };
+
+    //*************************************************************************
+    /// Shifts a zero byte in to the CRC register.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const T VALUE>
+    struct crc_zero_byte;
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const T VALUE>
+    struct crc_zero_byte<T, WIDTH, POLYNOMIAL, true, VALUE>
+    {
+      static const T value = T((VALUE >> 8U) ^ crc_table_entry<T, WIDTH, POLYNOMIAL, true, 8U, (VALUE & 0xFFU)>::value);
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const T VALUE>
+    struct crc_zero_byte<T, WIDTH, POLYNOMIAL, false, VALUE>
+    {
+      static const T value = T(((VALUE << 8U) & crc_mask<T, WIDTH>::value) ^ crc_table_entry<T, WIDTH, POLYNOMIAL, false, 8U, ((VALUE >> (WIDTH - 8U)) & 0xFFU)>::value);
+    };
+
+    //*************************************************************************
+    /// A slice table entry.
+    /// The CRC of the byte INDEX followed by SLICE zero bytes.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t SLICE, const size_t INDEX>
+    struct crc_slice_entry
+    {
+      static const T value = crc_zero_byte<T, WIDTH, POLYNOMIAL, REFLECT, crc_slice_entry<T, WIDTH, POLYNOMIAL, REFLECT, SLICE - 1U, INDEX>::value>::value;
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t INDEX>
+    struct crc_slice_entry<T, WIDTH, POLYNOMIAL, REFLECT, 0U, INDEX>
+    {
+      static const T value = crc_table_entry<T, WIDTH, POLYNOMIAL, REFLECT, 8U, INDEX>::value;
+    };
+
+    //*************************************************************************
+    /// The slice tables.
+    /// Slice 0 is the byte table.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t SLICE>
+    struct crc_slice_table
+    {
+      template <const size_t INDEX>
+      struct entry : public crc_slice_entry<T, WIDTH, POLYNOMIAL, REFLECT, SLICE, INDEX>
+      {
+      };
+
+      static const T table[256];
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t SLICE>
+    const T crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, SLICE>::table[256] =
+    {
+      ETL_CRC_ENTRIES_256(0)
+    };
+
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 0U> : public crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 8U>
+    {
+    };
+
+    //*************************************************************************
+    /// Reads bytes in little and big endian order.
+    //*************************************************************************
+    inline uint32_t read_le_32(const uint8_t* data)
+    {
+      return uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+    }
+
+    inline uint32_t read_be_32(const uint8_t* data)
+    {
+      return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | uint32_t(data[3]);
+    }
+
+    inline uint64_t read_le_64(const uint8_t* data)
+    {
+      return uint64_t(read_le_32(data)) | (uint64_t(read_le_32(data + 4)) << 32);
+    }
+
+    inline uint64_t read_be_64(const uint8_t* data)
+    {
+      return (uint64_t(read_be_32(data)) << 32) | uint64_t(read_be_32(data + 4));
+    }
+
+    //*************************************************************************
+    /// The CRC calculation for each table size.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT, const size_t TABLE_SIZE>
+    struct crc_engine;
+
+    //*************************************************************************
+    /// Nibble table.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_engine<T, WIDTH, POLYNOMIAL, REFLECT, 16U>
+    {
+      typedef crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 4U> table_t;
+
+      static T add(T crc, uint8_t value)
+      {
+        if ETL_IF_CONSTEXPR(REFLECT)
+        {
+          crc = T((crc >> 4U) ^ table_t::table[(crc ^ value) & 0x0FU]);
+          crc = T((crc >> 4U) ^ table_t::table[(crc ^ (value >> 4U)) & 0x0FU]);
+        }
+        else
+        {
+          crc = T(((crc << 4U) ^ table_t::table[((crc >> (WIDTH - 4U)) ^ (value >> 4U)) & 0x0FU]) & crc_mask<T, WIDTH>::value);
+          crc = T(((crc << 4U) ^ table_t::table[((crc >> (WIDTH - 4U)) ^ value) & 0x0FU]) & crc_mask<T, WIDTH>::value);
+        }
+
+        return crc;
+      }
+
+      static T add_block(T crc, const uint8_t* data, size_t length)
+      {
+        while (length-- != 0)
+        {
+          crc = add(crc, *data++);
+        }
+
+        return crc;
+      }
+    };
+
+    //*************************************************************************
+    /// Byte table.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_engine<T, WIDTH, POLYNOMIAL, REFLECT, 256U>
+    {
+      typedef crc_table<T, WIDTH, POLYNOMIAL, REFLECT, 8U> table_t;
+
+      static T add(T crc, uint8_t value)
+      {
+        if ETL_IF_CONSTEXPR(REFLECT)
+        {
+          return T((crc >> 8U) ^ table_t::table[(crc ^ value) & 0xFFU]);
+        }
+        else
+        {
+          return T(((crc << 8U) ^ table_t::table[((crc >> (WIDTH - 8U)) ^ value) & 0xFFU]) & crc_mask<T, WIDTH>::value);
+        }
+      }
+
+      static T add_block(T crc, const uint8_t* data, size_t length)
+      {
+        while (length-- != 0)
+        {
+          crc = add(crc, *data++);
+        }
+
+        return crc;
+      }
+    };
+
+    //*************************************************************************
+    /// Slice-by-4 tables.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_engine<T, WIDTH, POLYNOMIAL, REFLECT, 1024U>
+    {
+      typedef crc_engine<T, WIDTH, POLYNOMIAL, REFLECT, 256U> byte_engine_t;
+
+      static T add(T crc, uint8_t value)
+      {
+        return byte_engine_t::add(crc, value);
+      }
+
+      static T add_block(T crc, const uint8_t* data, size_t length)
+      {
+        const T* s0 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 0U>::table;
+        const T* s1 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 1U>::table;
+        const T* s2 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 2U>::table;
+        const T* s3 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 3U>::table;
+
+        while (length >= 4U)
+        {
+          if ETL_IF_CONSTEXPR(REFLECT)
+          {
+            // The register bits above the first 32 move down.
+            uint32_t v    = uint32_t(crc) ^ read_le_32(data);
+            uint64_t rest = (uint64_t(crc) >> 16U) >> 16U;
+
+            crc = T(rest ^ s3[v & 0xFFU] ^ s2[(v >> 8U) & 0xFFU] ^ s1[(v >> 16U) & 0xFFU] ^ s0[v >> 24U]);
+          }
+          else
+          {
+            // The top 32 bits of the register are combined with the data and the rest move up.
+            const size_t DOWN = (WIDTH > 32U) ? WIDTH - 32U : 0U;
+            const size_t UP   = (WIDTH > 32U) ? 0U : 32U - WIDTH;
+
+            uint32_t v    = uint32_t((uint64_t(crc) >> DOWN) << UP) ^ read_be_32(data);
+            uint64_t rest = ((uint64_t(crc) << 16U) << 16U) & ((WIDTH > 32U) ? uint64_t(crc_mask<T, WIDTH>::value) : 0U);
+
+            crc = T(rest ^ s3[v >> 24U] ^ s2[(v >> 16U) & 0xFFU] ^ s1[(v >> 8U) & 0xFFU] ^ s0[v & 0xFFU]);
+          }
+
+          data   += 4U;
+          length -= 4U;
+        }
+
+        return byte_engine_t::add_block(crc, data, length);
+      }
+    };
+
+    //*************************************************************************
+    /// Slice-by-8 tables.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_engine<T, WIDTH, POLYNOMIAL, REFLECT, 2048U>
+    {
+      typedef crc_engine<T, WIDTH, POLYNOMIAL, REFLECT, 256U> byte_engine_t;
+
+      static T add(T crc, uint8_t value)
+      {
+        return byte_engine_t::add(crc, value);
+      }
+
+      static T add_block(T crc, const uint8_t* data, size_t length)
+      {
+        const T* s0 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 0U>::table;
+        const T* s1 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 1U>::table;
+        const T* s2 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 2U>::table;
+        const T* s3 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 3U>::table;
+        const T* s4 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 4U>::table;
+        const T* s5 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 5U>::table;
+        const T* s6 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 6U>::table;
+        const T* s7 = crc_slice_table<T, WIDTH, POLYNOMIAL, REFLECT, 7U>::table;
+
+        // The whole register is combined with the data.
+        while (length >= 8U)
+        {
+          if ETL_IF_CONSTEXPR(REFLECT)
+          {
+            uint64_t v = uint64_t(crc) ^ read_le_64(data);
+
+            crc = T(s7[v & 0xFFU]          ^ s6[(v >> 8U) & 0xFFU]  ^ s5[(v >> 16U) & 0xFFU] ^ s4[(v >> 24U) & 0xFFU] ^
+                    s3[(v >> 32U) & 0xFFU] ^ s2[(v >> 40U) & 0xFFU] ^ s1[(v >> 48U) & 0xFFU] ^ s0[v >> 56U]);
+          }
+          else
+          {
+            uint64_t v = (uint64_t(crc) << (64U - WIDTH)) ^ read_be_64(data);
+
+            crc = T(s7[v >> 56U]           ^ s6[(v >> 48U) & 0xFFU] ^ s5[(v >> 40U) & 0xFFU] ^ s4[(v >> 32U) & 0xFFU] ^
+                    s3[(v >> 24U) & 0xFFU] ^ s2[(v >> 16U) & 0xFFU] ^ s1[(v >> 8U) & 0xFFU]  ^ s0[v & 0xFFU]);
+          }
+
+          data   += 8U;
+          length -= 8U;
+        }
+
+        return byte_engine_t::add_block(crc, data, length);
+      }
+    };
+
+    //*************************************************************************
+    /// Run time arithmetic modulo the polynomial.
+    /// Values are in the same bit order as the CRC register, so multiplying
+    /// a register by x^(8n) is the same as adding n zero bytes to it.
+    //*************************************************************************
+    template <typename T, const size_t WIDTH, const T POLYNOMIAL, const bool REFLECT>
+    struct crc_modulo
+    {
+      //***********************************************************************
+      /// x^0
+      //***********************************************************************
+      static T one()
+      {
+        return REFLECT ? T(T(1U) << (WIDTH - 1U)) : T(1U);
+      }
+
+      //***********************************************************************
+      /// value * x
+      //***********************************************************************
+      static T multiply_x(T value)
+      {
+        if ETL_IF_CONSTEXPR(REFLECT)
+        {
+          return T((value & 1U) ? ((value >> 1U) ^ reflect_bits<T, POLYNOMIAL, WIDTH>::value) : (value >> 1U));
+        }
+        else
+        {
+          return T(((value & (T(1U) << (WIDTH - 1U))) ? ((value << 1U) ^ POLYNOMIAL) : (value << 1U)) & crc_mask<T, WIDTH>::value);
+        }
+      }
+
+      //***********************************************************************
+      /// a * b
+      //***********************************************************************
+      static T multiply(T a, T b)
+      {
+        T product     = 0U;
+        T coefficient = one();
+
+        for (size_t i = 0U; i < WIDTH; ++i)
+        {
+          if ((a & coefficient) != 0U)
+          {
+            product ^= b;
+          }
+
+          b           = multiply_x(b);
+          coefficient = REFLECT ? T(coefficient >> 1U) : T(coefficient << 1U);
+        }
+
+        return product;
+      }
+
+      //***********************************************************************
+      /// x^(8 * length), by repeated squaring.
+      //***********************************************************************
+      static T x_to_bytes(size_t length)
+      {
+        T result = one();
+        T power  = one();
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          power = multiply_x(power);
+        }
+
+        while (length != 0U)
+        {
+          if ((length & 1U) != 0U)
+          {
+            result = multiply(result, power);
+          }
+
+          power    = multiply(power, power);
+          length >>= 1U;
+        }
+
+        return result;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Generic CRC policy.
+  ///\tparam WIDTH      The number of bits in the CRC. 8 to 64.
+  ///\tparam POLYNOMIAL The polynomial, without the top bit.
+  ///\tparam INITIAL    The initial value.
+  ///\tparam XOR_OUT    The value xored with the final result.
+  ///\tparam REFLECT    Whether the input and output are reflected.
+  ///\tparam TABLE_SIZE The number of table entries. 16, 256, 1024 (slice-by-4) or 2048 (slice-by-8).
+  ///\ingroup crc
+  //***************************************************************************
+  template <const size_t WIDTH,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type POLYNOMIAL,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type INITIAL,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type XOR_OUT,
+            const bool REFLECT,
+            const size_t TABLE_SIZE = 256U>
+  struct crc_policy
+  {
+    typedef typename etl::smallest_uint_for_bits<WIDTH>::type value_type;
+
+    STATIC_ASSERT((WIDTH >= 8U) && (WIDTH <= 64U), "CRC width not supported");
+    STATIC_ASSERT((TABLE_SIZE == 16U) || (TABLE_SIZE == 256U) || (TABLE_SIZE == 1024U) || (TABLE_SIZE == 2048U), "CRC table size not supported");
+
+    inline value_type initial() const
+    {
+      return REFLECT ? private_crc::reflect_bits<value_type, INITIAL, WIDTH>::value : INITIAL;
+    }
+
+    inline value_type add(value_type crc, uint8_t value) const
+    {
+      return engine_t::add(crc, value);
+    }
+
+    inline value_type add_block(value_type crc, const uint8_t* data, size_t length) const
+    {
+      return engine_t::add_block(crc, data, length);
+    }
+
+    inline value_type final(value_type crc) const
+    {
+      return value_type(crc ^ XOR_OUT);
+    }
+
+    //*************************************************************************
+    /// Combines the CRCs of two adjacent blocks in O(log(length2)).
+    ///\param crc1    The CRC of the first block.
+    ///\param crc2    The CRC of the second block.
+    ///\param length2 The length of the second block in bytes.
+    ///\return The CRC of the first block followed by the second.
+    //*************************************************************************
+    inline value_type combine(value_type crc1, value_type crc2, size_t length2) const
+    {
+      typedef private_crc::crc_modulo<value_type, WIDTH, POLYNOMIAL, REFLECT> modulo_t;
+
+      // The register after the first block, less the initial value that is
+      // already accounted for in crc2, shifted over the second block.
+      value_type shifted = value_type(crc1 ^ XOR_OUT ^ initial());
+
+      return value_type(modulo_t::multiply(shifted, modulo_t::x_to_bytes(length2)) ^ crc2);
+    }
+
+  private:
+
+    typedef private_crc::crc_engine<value_type, WIDTH, POLYNOMIAL, REFLECT, TABLE_SIZE> engine_t;
+  };
+
+  //***************************************************************************
+  /// Generic CRC.
+  /// See etl::crc_policy for the template parameters.
+  ///\ingroup crc
+  //***************************************************************************
+  template <const size_t WIDTH,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type POLYNOMIAL,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type INITIAL,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type XOR_OUT,
+            const bool REFLECT,
+            const size_t TABLE_SIZE = 256U>
+  class crc_type : public etl::frame_check_sequence<etl::crc_policy<WIDTH, POLYNOMIAL, INITIAL, XOR_OUT, REFLECT, TABLE_SIZE> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc_type()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc_type(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Combines the CRCs of two adjacent blocks.
+  /// TCrc is any frame_check_sequence whose policy supplies 'combine', such as
+  /// etl::crc_type or the predefined CRCs.
+  ///\param crc1    The CRC of the first block.
+  ///\param crc2    The CRC of the second block.
+  ///\param length2 The length of the second block in bytes.
+  ///\return The CRC of the first block followed by the second.
+  ///\ingroup crc
+  //***************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc1, typename TCrc::value_type crc2, size_t length2)
+  {
+    typename TCrc::policy_type policy;
+
+    return policy.combine(crc1, crc2, length2);
+  }
+}
+
+#undef ETL_CRC_ENTRIES_4
+#undef ETL_CRC_ENTRIES_16
+#undef ETL_CRC_ENTRIES_64
+#undef ETL_CRC_ENTRIES_256
+
+#endif
@@ -35,7 +35,7 @@ SOFTWARE.
 #include <iterator>
 
 #include "platform.h"
-#include "frame_check_sequence.h"
+#include "crc.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,34 +46,12 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC16 table
-  /// \ingroup crc16
-  //***************************************************************************
-  extern const uint16_t CRC16[];
-
   //***************************************************************************
   /// CRC16 policy.
   /// Calculates CRC16 using polynomial 0x8005.
   //***************************************************************************
-  struct crc_policy_16
+  struct crc_policy_16 : public etl::crc_policy<16, 0x8005, 0x0000, 0x0000, true, ETL_CRC_TABLE_SIZE>
   {
-    typedef uint16_t value_type;
-
-    inline uint16_t initial() const
-    {
-      return 0;
-    }
-
-    inline uint16_t add(uint16_t crc, uint8_t value) const
-    {
-      return  (crc >> 8) ^ CRC16[(crc ^ value) & 0xFF];
-    }
-
-    inline uint16_t final(uint16_t crc) const
-    {
-      return crc;
-    }
   };
 
   //*************************************************************************
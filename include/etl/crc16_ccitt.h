@@ -35,7 +35,7 @@ SOFTWARE.
 #include <iterator>
 
 #include "platform.h"
-#include "frame_check_sequence.h"
+#include "crc.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,34 +46,12 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC-CCITT table
-  /// \ingroup crc16_ccitt
-  //***************************************************************************
-  extern const uint16_t CRC_CCITT[];
-
   //***************************************************************************
   /// CRC16 CCITT policy.
   /// Calculates CRC16 CCITT using polynomial 0x1021
   //***************************************************************************
-  struct crc_policy_16_ccitt
+  struct crc_policy_16_ccitt : public etl::crc_policy<16, 0x1021, 0xFFFF, 0x0000, false, ETL_CRC_TABLE_SIZE>
   {
-    typedef uint16_t value_type;
-
-    inline uint16_t initial() const
-    {
-      return 0xFFFF;
-    }
-
-    inline uint16_t add(uint16_t crc, uint8_t value) const
-    {
-      return  (crc << 8) ^ CRC_CCITT[((crc >> 8) ^ value) & 0xFF];
-    }
-
-    inline uint16_t final(uint16_t crc) const
-    {
-      return crc;
-    }
   };
 
   //*************************************************************************
@@ -35,7 +35,7 @@ SOFTWARE.
 #include <iterator>
 
 #include "platform.h"
-#include "frame_check_sequence.h"
+#include "crc.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,34 +46,12 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC Kermit table
-  /// \ingroup crc
-  //***************************************************************************
-  extern const uint16_t CRC_KERMIT[];
-
   //***************************************************************************
   /// CRC16 Kermit policy.
   /// Calculates CRC16 Kermit using polynomial 0x1021
   //***************************************************************************
-  struct crc_policy_16_kermit
+  struct crc_policy_16_kermit : public etl::crc_policy<16, 0x1021, 0x0000, 0x0000, true, ETL_CRC_TABLE_SIZE>
   {
-    typedef uint16_t value_type;
-
-    inline uint16_t initial() const
-    {
-      return 0;
-    }
-
-    inline uint16_t add(uint16_t crc, uint8_t value) const
-    {
-      return (crc >> 8) ^ CRC_KERMIT[(crc ^ value) & 0xFF];
-    }
-
-    inline uint16_t final(uint16_t crc) const
-    {
-      return crc;
-    }
   };
 
   //*************************************************************************
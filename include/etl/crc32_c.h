@@ -35,7 +35,11 @@ SOFTWARE.
 #include <iterator>
 
 #include "platform.h"
-#include "frame_check_sequence.h"
+#include "crc.h"
+
+#if defined(ETL_CRC_HARDWARE_X86)
+  #include "private/crc_x86.h"
+#endif
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,34 +50,18 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC32_C table
-  /// \ingroup crc32_c
-  //***************************************************************************
-  extern const uint32_t CRC32_C[];
-
   //***************************************************************************
   /// CRC32_C policy.
   /// Calculates CRC32_C using polynomial 0x1EDC6F41.
   //***************************************************************************
-  struct crc_policy_32_c
+  struct crc_policy_32_c : public etl::crc_policy<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, ETL_CRC_TABLE_SIZE>
   {
-    typedef uint32_t value_type;
-
-    inline uint32_t initial() const
+#if defined(ETL_CRC_HARDWARE_X86)
+    inline uint32_t add_block(uint32_t crc, const uint8_t* data, size_t length) const
     {
-      return 0xFFFFFFFF;
-    }
-
-    inline uint32_t add(uint32_t crc, uint8_t value) const
-    {
-      return  (crc >> 8) ^ CRC32_C[(crc ^ value) & 0xFF];
-    }
-
-    inline uint32_t final(uint32_t crc) const
-    {
-      return crc ^ 0xFFFFFFFF;
+      return etl::private_crc::crc32_c_x86(crc, data, length);
     }
+#endif
   };
 
   //*************************************************************************
@@ -35,7 +35,11 @@ SOFTWARE.
 #include <iterator>
 
 #include "platform.h"
-#include "frame_check_sequence.h"
+#include "crc.h"
+
+#if defined(ETL_CRC_HARDWARE_X86)
+  #include "private/crc_x86.h"
+#endif
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,34 +50,18 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC64_ECMA table
-  /// \ingroup crc64_ecma
-  //***************************************************************************
-  extern const uint64_t CRC64_ECMA[];
-
   //***************************************************************************
   /// CRC64 policy.
   /// Calculates CRC64 ECMA using polynomial 0x42F0E1EBA9EA3693.
   //***************************************************************************
-  struct crc_policy_64_ecma
+  struct crc_policy_64_ecma : public etl::crc_policy<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, 0x0000000000000000, false, ETL_CRC_TABLE_SIZE>
   {
-    typedef uint64_t value_type;
-
-    inline uint64_t initial() const
+#if defined(ETL_CRC_HARDWARE_X86)
+    inline uint64_t add_block(uint64_t crc, const uint8_t* data, size_t length) const
     {
-      return 0;
-    }
-
-    inline uint64_t add(uint64_t crc, uint8_t value) const
-    {
-      return  (crc << 8) ^ CRC64_ECMA[((crc >> 56) ^ value) & 0xFF];
-    }
-
-    inline uint64_t final(uint64_t crc) const
-    {
-      return crc;
+      return etl::private_crc::crc64_ecma_x86(crc, data, length);
     }
+#endif
   };
 
   //*************************************************************************
@@ -35,7 +35,7 @@ SOFTWARE.
 #include <iterator>
 
 #include "platform.h"
-#include "frame_check_sequence.h"
+#include "crc.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -46,34 +46,12 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC8 table
-  /// \ingroup crc8_ccitt
-  //***************************************************************************
-  extern const uint8_t CRC8_CCITT[];
-
   //***************************************************************************
   /// CRC8 CCITT policy.
   /// Calculates CRC8 CCITT using polynomial 0x07.
   //***************************************************************************
-  struct crc_policy_8_ccitt
+  struct crc_policy_8_ccitt : public etl::crc_policy<8, 0x07, 0x00, 0x00, false, ETL_CRC_TABLE_SIZE>
   {
-    typedef uint8_t value_type;
-
-    inline uint8_t initial() const
-    {
-      return 0;
-    }
-
-    inline uint8_t add(uint8_t crc, uint8_t value) const
-    {
-      return  CRC8_CCITT[crc ^ value];
-    }
-
-    inline uint8_t final(uint8_t crc) const
-    {
-      return crc;
-    }
   };
 
   //*************************************************************************
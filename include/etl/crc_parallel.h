@@ -0,0 +1,165 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_CRC_PARALLEL_INCLUDED
+#define ETL_CRC_PARALLEL_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+#include <iterator>
+
+#include "platform.h"
+#include "crc.h"
+
+///\defgroup crc_parallel Parallel CRC calculation
+/// Splits a range into chunks, calculates their CRCs on separate threads and
+/// combines the results. Requires std::thread.
+///\ingroup crc
+
+//*****************************************************************************
+/// The maximum number of threads that etl::crc_parallel will use.
+//*****************************************************************************
+#if !defined(ETL_CRC_PARALLEL_MAX_THREADS)
+  #define ETL_CRC_PARALLEL_MAX_THREADS 16
+#endif
+
+#if ETL_CPP11_SUPPORTED == 1
+  #define ETL_HAS_CRC_PARALLEL 1
+#else
+  #define ETL_HAS_CRC_PARALLEL 0
+#endif
+
+#if ETL_HAS_CRC_PARALLEL
+
+#include <thread>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Calculates the CRC of a range using a number of threads.
+  /// The calling thread calculates the first chunk.
+  ///\tparam TCrc    The CRC type, such as etl::crc32 or etl::crc_type.
+  ///\param begin    Start of the range.
+  ///\param end      End of the range.
+  ///\param threads  The number of threads to use. Limited to ETL_CRC_PARALLEL_MAX_THREADS.
+  ///\return The CRC of the range.
+  ///\ingroup crc_parallel
+  //***************************************************************************
+  template <typename TCrc, typename TIterator>
+  typename TCrc::value_type crc_parallel(TIterator begin, TIterator end, size_t threads)
+  {
+    typedef typename TCrc::value_type value_type;
+
+    const size_t length = size_t(std::distance(begin, end));
+
+    if (threads > ETL_CRC_PARALLEL_MAX_THREADS)
+    {
+      threads = ETL_CRC_PARALLEL_MAX_THREADS;
+    }
+
+    if (threads > length)
+    {
+      threads = length;
+    }
+
+    if (threads <= 1U)
+    {
+      return TCrc(begin, end).value();
+    }
+
+    TIterator  chunk_begin[ETL_CRC_PARALLEL_MAX_THREADS];
+    size_t     chunk_length[ETL_CRC_PARALLEL_MAX_THREADS];
+    value_type chunk_crc[ETL_CRC_PARALLEL_MAX_THREADS];
+
+    // Share the remainder between the first chunks.
+    const size_t size      = length / threads;
+    const size_t remainder = length % threads;
+
+    TIterator itr = begin;
+
+    for (size_t i = 0U; i < threads; ++i)
+    {
+      chunk_begin[i]  = itr;
+      chunk_length[i] = size + ((i < remainder) ? 1U : 0U);
+      std::advance(itr, chunk_length[i]);
+    }
+
+    std::thread workers[ETL_CRC_PARALLEL_MAX_THREADS];
+    value_type  crc;
+
+#if defined(ETL_THROW_EXCEPTIONS)
+    try
+#endif
+    {
+      for (size_t i = 1U; i < threads; ++i)
+      {
+        workers[i] = std::thread([&chunk_begin, &chunk_length, &chunk_crc, i]()
+        {
+          TIterator chunk_end = chunk_begin[i];
+          std::advance(chunk_end, chunk_length[i]);
+          chunk_crc[i] = TCrc(chunk_begin[i], chunk_end).value();
+        });
+      }
+
+      TIterator chunk_end = chunk_begin[0];
+      std::advance(chunk_end, chunk_length[0]);
+      crc = TCrc(chunk_begin[0], chunk_end).value();
+    }
+#if defined(ETL_THROW_EXCEPTIONS)
+    catch (...)
+    {
+      // A joinable std::thread calls std::terminate when destroyed, so wait
+      // for the workers that were started before passing the exception on.
+      for (size_t i = 1U; i < threads; ++i)
+      {
+        if (workers[i].joinable())
+        {
+          workers[i].join();
+        }
+      }
+
+      throw;
+    }
+#endif
+
+    for (size_t i = 1U; i < threads; ++i)
+    {
+      workers[i].join();
+      crc = etl::crc_combine<TCrc>(crc, chunk_crc[i], chunk_length[i]);
+    }
+
+    return crc;
+  }
+}
+
+#endif
+
+#endif
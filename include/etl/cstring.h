@@ -203,24 +203,9 @@ namespace etl
   /// Hash function.
   //*************************************************************************
 #if ETL_8BIT_SUPPORT
-  template <>
-  struct hash<etl::istring>
-  {
-    size_t operator()(const etl::istring& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
   template <const size_t SIZE>
-  struct hash<etl::string<SIZE> >
+  struct hash<etl::string<SIZE> > : public etl::private_hash::text_hash<char>
   {
-    size_t operator()(const etl::string<SIZE>& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
   };
 #endif
 }
@@ -0,0 +1,357 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CUCKOO_FILTER_INCLUDED
+#define ETL_CUCKOO_FILTER_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "smallest.h"
+#include "power.h"
+#include "static_assert.h"
+#include "private/hash_mix.h"
+
+#if !defined(ETL_CUCKOO_FILTER_MAX_KICKS)
+  #define ETL_CUCKOO_FILTER_MAX_KICKS 500
+#endif
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A cuckoo filter
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity cuckoo filter.
+  /// Like a Bloom filter, but keys may also be erased.
+  /// Each key is stored as a fingerprint in one of two buckets of four slots.
+  /// The hash must support the () operator and define 'argument_type'.
+  ///\tparam N                The number of keys that the filter must be able to hold.
+  ///\tparam FINGERPRINT_BITS The number of bits in a fingerprint. More bits give fewer false positives.
+  ///\tparam THash            The hash generator class.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <const size_t N, const size_t FINGERPRINT_BITS, typename THash>
+  class cuckoo_filter
+  {
+  private:
+
+    STATIC_ASSERT((FINGERPRINT_BITS >= 2) && (FINGERPRINT_BITS <= 32), "Fingerprint bits must be from 2 to 32");
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    typedef typename etl::smallest_uint_for_bits<FINGERPRINT_BITS>::type fingerprint_type;
+
+    static const size_t SLOTS_PER_BUCKET = 4;
+
+    // Sized so that N keys fill the slots to no more than 95%, as inserts are likely to fail beyond that.
+    static const size_t NUMBER_OF_BUCKETS = etl::power_of_2_round_up<((N * 20) + 75) / 76 < 2 ? 2 : ((N * 20) + 75) / 76>::value;
+    static const size_t NUMBER_OF_SLOTS   = NUMBER_OF_BUCKETS * SLOTS_PER_BUCKET;
+    static const size_t MAX_KICKS         = ETL_CUCKOO_FILTER_MAX_KICKS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cuckoo_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0; i < NUMBER_OF_BUCKETS; ++i)
+      {
+        for (size_t j = 0; j < SLOTS_PER_BUCKET; ++j)
+        {
+          buckets[i][j] = 0;
+        }
+      }
+
+      victim_fingerprint = 0;
+      victim_index       = 0;
+      entry_count        = 0;
+      kick_seed          = 1;
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    /// If a free slot cannot be found after MAX_KICKS relocations then the
+    /// last displaced fingerprint is held aside and the filter becomes full.
+    ///\param key The key to add.
+    ///\return <b>true</b> if the key was added, <b>false</b> if the filter is full.
+    //*************************************************************************
+    bool add(parameter_t key)
+    {
+      if (full())
+      {
+        return false;
+      }
+
+      fingerprint_type fingerprint;
+      size_t           index;
+
+      get_probe(key, index, fingerprint);
+
+      add_fingerprint(index, fingerprint);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      fingerprint_type fingerprint;
+      size_t           index;
+
+      get_probe(key, index, fingerprint);
+
+      const size_t index2 = alternate_index(index, fingerprint);
+
+      return contains(index, fingerprint) ||
+             contains(index2, fingerprint) ||
+             ((victim_fingerprint == fingerprint) && ((victim_index == index) || (victim_index == index2)));
+    }
+
+    //*************************************************************************
+    /// Erases a key from the filter.
+    /// Only erase keys that have been added, otherwise a key that shares its
+    /// fingerprint and buckets may be erased in its place.
+    ///\param key The key to erase.
+    ///\return <b>true</b> if the key was found and erased.
+    //*************************************************************************
+    bool erase(parameter_t key)
+    {
+      fingerprint_type fingerprint;
+      size_t           index;
+
+      get_probe(key, index, fingerprint);
+
+      const size_t index2 = alternate_index(index, fingerprint);
+
+      if (remove(index, fingerprint) || remove(index2, fingerprint))
+      {
+        --entry_count;
+
+        // There is now a free slot, so try to put the victim back into the table.
+        if (victim_fingerprint != 0)
+        {
+          const fingerprint_type held = victim_fingerprint;
+          victim_fingerprint = 0;
+          --entry_count;
+          add_fingerprint(victim_index, held);
+        }
+
+        return true;
+      }
+
+      if ((victim_fingerprint == fingerprint) && ((victim_index == index) || (victim_index == index2)))
+      {
+        victim_fingerprint = 0;
+        --entry_count;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys in the filter.
+    //*************************************************************************
+    size_t size() const
+    {
+      return entry_count;
+    }
+
+    //*************************************************************************
+    /// Returns the number of fingerprint slots.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return NUMBER_OF_SLOTS;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the filter is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return entry_count == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the filter is full.
+    /// The filter is full when an add has failed to find a free slot.
+    //*************************************************************************
+    bool full() const
+    {
+      return victim_fingerprint != 0;
+    }
+
+    //*************************************************************************
+    /// Returns the ratio of used slots to total slots.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(entry_count) / static_cast<float>(NUMBER_OF_SLOTS);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the first bucket index and the fingerprint for a key.
+    /// The fingerprint is never zero, as zero marks an empty slot.
+    //*************************************************************************
+    static void get_probe(parameter_t key, size_t& index, fingerprint_type& fingerprint)
+    {
+      const uint64_t hash = etl::private_hash::fmix_64(uint64_t(THash()(key)));
+
+      index       = size_t(hash >> 32) & (NUMBER_OF_BUCKETS - 1);
+      fingerprint = fingerprint_type((uint32_t(hash) % FINGERPRINT_MAX) + 1);
+    }
+
+    //*************************************************************************
+    /// Gets the other bucket for a fingerprint.
+    /// Applying it twice returns the original bucket.
+    //*************************************************************************
+    static size_t alternate_index(size_t index, fingerprint_type fingerprint)
+    {
+      return (index ^ (size_t(uint32_t(fingerprint) * 0x5BD1E995UL))) & (NUMBER_OF_BUCKETS - 1);
+    }
+
+    //*************************************************************************
+    /// Puts a fingerprint in a free slot of a bucket.
+    //*************************************************************************
+    bool insert(size_t index, fingerprint_type fingerprint)
+    {
+      for (size_t i = 0; i < SLOTS_PER_BUCKET; ++i)
+      {
+        if (buckets[index][i] == 0)
+        {
+          buckets[index][i] = fingerprint;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Removes one copy of a fingerprint from a bucket.
+    //*************************************************************************
+    bool remove(size_t index, fingerprint_type fingerprint)
+    {
+      for (size_t i = 0; i < SLOTS_PER_BUCKET; ++i)
+      {
+        if (buckets[index][i] == fingerprint)
+        {
+          buckets[index][i] = 0;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Checks a bucket for a fingerprint.
+    //*************************************************************************
+    bool contains(size_t index, fingerprint_type fingerprint) const
+    {
+      const fingerprint_type* bucket = buckets[index];
+
+      return (bucket[0] == fingerprint) || (bucket[1] == fingerprint) ||
+             (bucket[2] == fingerprint) || (bucket[3] == fingerprint);
+    }
+
+    //*************************************************************************
+    /// Adds a fingerprint in one of its buckets, kicking if necessary.
+    //*************************************************************************
+    void add_fingerprint(size_t index, fingerprint_type fingerprint)
+    {
+      if (insert(index, fingerprint) || insert(alternate_index(index, fingerprint), fingerprint))
+      {
+        ++entry_count;
+        return;
+      }
+
+      // Both buckets are full, so relocate fingerprints until one finds a free slot.
+      if ((kick_seed & 1) != 0)
+      {
+        index = alternate_index(index, fingerprint);
+      }
+
+      for (size_t kick = 0; kick < MAX_KICKS; ++kick)
+      {
+        kick_seed = (kick_seed * 1103515245UL) + 12345UL;
+
+        fingerprint_type& slot = buckets[index][(kick_seed >> 16) % SLOTS_PER_BUCKET];
+
+        fingerprint_type displaced = slot;
+        slot        = fingerprint;
+        fingerprint = displaced;
+
+        index = alternate_index(index, fingerprint);
+
+        if (insert(index, fingerprint))
+        {
+          ++entry_count;
+          return;
+        }
+      }
+
+      // The new fingerprint is in the table; hold the displaced one aside so that it is not lost.
+      victim_fingerprint = fingerprint;
+      victim_index       = index;
+      ++entry_count;
+    }
+
+    static const uint32_t FINGERPRINT_MAX = uint32_t((UINT64_C(1) << FINGERPRINT_BITS) - 1);
+
+    fingerprint_type buckets[NUMBER_OF_BUCKETS][SLOTS_PER_BUCKET];
+    fingerprint_type victim_fingerprint; ///< A fingerprint displaced when the filter became full. Zero if none.
+    size_t           victim_index;
+    size_t           entry_count;
+    uint32_t         kick_seed;          ///< State for choosing which slot to kick.
+  };
+}
+
+#endif
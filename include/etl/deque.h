@@ -33,8 +33,10 @@ SOFTWARE.
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <iterator>
 #include <algorithm>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -232,6 +234,9 @@ namespace etl
     typedef T*       pointer;
     typedef const T* const_pointer;
     typedef typename std::iterator_traits<pointer>::difference_type difference_type;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&      rvalue_reference;
+#endif
 
   protected:
 
@@ -886,8 +891,15 @@ namespace etl
       }
       else
       {
+        // The value may be an element of this deque, which the shift would move.
+        const T copy(value);
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          ::new (open_gap(position)) T(copy);
+        }
         // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
+        else if (std::distance(_begin, position) < std::distance(position, _end - 1))
         {
           // Construct the _begin.
           create_element_front(*_begin);
@@ -896,7 +908,7 @@ namespace etl
           std::copy(_begin + 1, position, _begin);
 
           // Write the new value.
-          *--position = value;
+          *--position = copy;
         }
         else
         {
@@ -907,13 +919,139 @@ namespace etl
           std::copy_backward(position, _end - 2, _end - 1);
 
           // Write the new value.
-          *position = value;
+          *position = copy;
+        }
+      }
+
+      return position;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves data into the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is full.
+    ///\param insert_position>The insert position.
+    ///\param value>The value to insert.
+    //*************************************************************************
+    iterator insert(const_iterator insert_position, rvalue_reference value)
+    {
+      iterator position(insert_position.index, *this, p_buffer);
+
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+
+      if (insert_position == begin())
+      {
+        create_element_front(std::move(value));
+        position = _begin;
+      }
+      else if (insert_position == end())
+      {
+        create_element_back(std::move(value));
+        position = _end - 1;
+      }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        ::new (open_gap(position)) T(std::move(value));
+      }
+      else
+      {
+        // Are we closer to the front?
+        if (std::distance(_begin, position) < std::distance(position, _end - 1))
+        {
+          // Construct the _begin.
+          create_element_front(std::move(*_begin));
+
+          // Move the values.
+          std::move(_begin + 2, position, _begin + 1);
+
+          // Write the new value.
+          *--position = std::move(value);
+        }
+        else
+        {
+          // Construct the _end.
+          create_element_back(std::move(*(_end - 1)));
+
+          // Move the values.
+          std::move_backward(position, _end - 2, _end - 1);
+
+          // Write the new value.
+          *position = std::move(value);
         }
       }
 
       return position;
     }
 
+    //*************************************************************************
+    /// Emplaces data into the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is full.
+    ///\param insert_position>The insert position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const_iterator insert_position, Args && ... args)
+    {
+      iterator position(insert_position.index, *this, p_buffer);
+
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+
+      void* p;
+
+      if (insert_position == begin())
+      {
+        --_begin;
+        p = etl::addressof(*_begin);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        position = _begin;
+      }
+      else if (insert_position == end())
+      {
+        p = etl::addressof(*_end);
+        ++_end;
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        position = _end - 1;
+      }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = open_gap(position);
+      }
+      else
+      {
+        // Are we closer to the front?
+        if (std::distance(_begin, position) < std::distance(position, _end - 1))
+        {
+          // Construct the _begin.
+          create_element_front(std::move(*_begin));
+
+          // Move the values.
+          std::move(_begin + 2, position, _begin + 1);
+
+          // Write the new value.
+          --position;
+          (*position).~T();
+          p = etl::addressof(*position);
+        }
+        else
+        {
+          // Construct the _end.
+          create_element_back(std::move(*(_end - 1)));
+
+          // Move the values.
+          std::move_backward(position, _end - 2, _end - 1);
+
+          // Write the new value.
+          (*position).~T();
+          p = etl::addressof(*position);
+        }
+      }
+
+      ::new (p) T(std::forward<Args>(args)...);
+
+      return position;
+    }
+#else
     //*************************************************************************
     /// Emplaces data into the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is full.
@@ -944,6 +1082,10 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = open_gap(position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1009,6 +1151,10 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = open_gap(position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1074,6 +1220,10 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = open_gap(position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1139,6 +1289,10 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = open_gap(position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1173,6 +1327,7 @@ namespace etl
 
       return position;
     }
+#endif
 
     //*************************************************************************
     /// Inserts 'n' copies of a value into the deque.
@@ -1407,6 +1562,11 @@ namespace etl
         destroy_element_back();
         position = end();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(etl::addressof(*position));
+        close_gap(position, 1);
+      }
       else
       {
         // Are we closer to the front?
@@ -1461,6 +1621,11 @@ namespace etl
 
         position = end();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy(position, position + length);
+        close_gap(position, length);
+      }
       else
       {
         // Copy the smallest number of items.
@@ -1498,7 +1663,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
     ///\param item The item to push to the deque.
     //*************************************************************************
-    void push_back(parameter_t item)
+    void push_back(const_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1506,6 +1671,21 @@ namespace etl
       create_element_back(item);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves an item to the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back(rvalue_reference item)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+      create_element_back(std::move(item));
+    }
+#endif
+
     //*************************************************************************
     /// Adds one to the front of the deque and returns a reference to the new element.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1522,6 +1702,24 @@ namespace etl
       return r;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+
+      ::new (&(*_end)) T(std::forward<Args>(args)...);
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#else
     //*************************************************************************
     /// Emplaces an item to the back of the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1589,6 +1787,7 @@ namespace etl
       ++current_size;
       ETL_INCREMENT_DEBUG_COUNT;
     }
+#endif
 
     //*************************************************************************
     /// Removes the oldest item from the deque.
@@ -1606,7 +1805,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
     ///\param item The item to push to the deque.
     //*************************************************************************
-    void push_front(parameter_t item)
+    void push_front(const_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1614,6 +1813,21 @@ namespace etl
       create_element_front(item);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves an item to the front of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_front(rvalue_reference item)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+      create_element_front(std::move(item));
+    }
+#endif
+
     //*************************************************************************
     /// Adds one to the front of the deque and returns a reference to the new element.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1629,6 +1843,24 @@ namespace etl
       return *_begin;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces an item to the front of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+
+      --_begin;
+      ::new (&(*_begin)) T(std::forward<Args>(args)...);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#else
     //*************************************************************************
     /// Emplaces an item to the front of the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1696,6 +1928,7 @@ namespace etl
       ++current_size;
       ETL_INCREMENT_DEBUG_COUNT;
     }
+#endif
 
     //*************************************************************************
     /// Removes the oldest item from the deque.
@@ -1783,6 +2016,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    /// The elements are moved, as the storage cannot be exchanged.
+    //*************************************************************************
+    ideque& operator =(ideque&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
 #ifdef ETL_IDEQUE_REPAIR_ENABLE
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
@@ -1838,6 +2087,26 @@ namespace etl
     iterator _end;     ///Iterator to the _end item in the deque.
     pointer  p_buffer; ///The buffer for the deque.
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Replaces the contents with the moved elements of 'rhs', leaving 'rhs'
+    /// empty.
+    //*************************************************************************
+    void move_container(ideque&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(deque_full));
+
+      clear();
+
+      for (iterator itr = rhs.begin(); itr != rhs.end(); ++itr)
+      {
+        create_element_back(std::move(*itr));
+      }
+
+      rhs.clear();
+    }
+#endif
+
   private:
 
     //*********************************************************************
@@ -1898,7 +2167,7 @@ namespace etl
     //*********************************************************************
     /// Create a new element with a default value at the front.
     //*********************************************************************
-    void create_element_front(parameter_t value)
+    void create_element_front(const_reference value)
     {
       --_begin;
       ::new (&(*_begin)) T(value);
@@ -1909,7 +2178,7 @@ namespace etl
     //*********************************************************************
     /// Create a new element with a value at the back
     //*********************************************************************
-    void create_element_back(parameter_t value)
+    void create_element_back(const_reference value)
     {
       ::new (&(*_end)) T(value);
       ++_end;
@@ -1917,6 +2186,30 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Create a new element with a moved value at the front.
+    //*********************************************************************
+    void create_element_front(rvalue_reference value)
+    {
+      --_begin;
+      ::new (&(*_begin)) T(std::move(value));
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Create a new element with a moved value at the back.
+    //*********************************************************************
+    void create_element_back(rvalue_reference value)
+    {
+      ::new (&(*_end)) T(std::move(value));
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#endif
+
     //*********************************************************************
     /// Destroy an element at the front.
     //*********************************************************************
@@ -1939,6 +2232,102 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Relocates the elements on the nearer side of 'position' one place
+    /// outwards, leaving unconstructed storage for a new element.
+    /// 'position' is updated to refer to the new storage.
+    /// Only for trivially relocatable types.
+    //*********************************************************************
+    void* open_gap(iterator& position)
+    {
+      // Are we closer to the front?
+      if (distance(_begin, position) < distance(position, _end - 1))
+      {
+        relocate_towards_front(_begin, position, 1);
+        --_begin;
+        --position;
+      }
+      else
+      {
+        relocate_towards_back(position, _end, 1);
+        ++_end;
+      }
+
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return etl::addressof(*position);
+    }
+
+    //*********************************************************************
+    /// Closes the gap left by 'length' destroyed elements at 'position' by
+    /// relocating the elements on the nearer side.
+    /// 'position' is updated to refer to the element following the gap.
+    /// Only for trivially relocatable types.
+    //*********************************************************************
+    void close_gap(iterator& position, size_t length)
+    {
+      // Are we closer to the front?
+      if (distance(_begin, position) < difference_type(current_size / 2))
+      {
+        relocate_towards_back(_begin, position, length);
+        _begin   += length;
+        position += length;
+      }
+      else
+      {
+        relocate_towards_front(position + length, _end, length);
+        _end -= length;
+      }
+
+      current_size -= length;
+      ETL_SUBTRACT_DEBUG_COUNT(length);
+    }
+
+    //*********************************************************************
+    /// Relocates [first, last) 'n' places towards the front with memmove,
+    /// one contiguous run of the circular buffer at a time.
+    //*********************************************************************
+    void relocate_towards_front(iterator first, iterator last, size_t n)
+    {
+      size_t   remaining   = distance(first, last);
+      iterator destination = first - n;
+
+      while (remaining > 0)
+      {
+        size_t run = std::min(remaining, std::min(BUFFER_SIZE - size_t(first.index), BUFFER_SIZE - size_t(destination.index)));
+
+        memmove(static_cast<void*>(p_buffer + destination.index), static_cast<const void*>(p_buffer + first.index), run * sizeof(T));
+
+        first       += run;
+        destination += run;
+        remaining   -= run;
+      }
+    }
+
+    //*********************************************************************
+    /// Relocates [first, last) 'n' places towards the back with memmove,
+    /// one contiguous run of the circular buffer at a time, last run first.
+    //*********************************************************************
+    void relocate_towards_back(iterator first, iterator last, size_t n)
+    {
+      size_t   remaining   = distance(first, last);
+      iterator destination = last + n;
+
+      while (remaining > 0)
+      {
+        size_t run = std::min(remaining, std::min(last.index        == 0 ? BUFFER_SIZE : size_t(last.index),
+                                                  destination.index == 0 ? BUFFER_SIZE : size_t(destination.index)));
+
+        last        -= run;
+        destination -= run;
+
+        memmove(static_cast<void*>(p_buffer + destination.index), static_cast<const void*>(p_buffer + last.index), run * sizeof(T));
+
+        remaining -= run;
+      }
+    }
+
     //*************************************************************************
     /// Measures the distance between two iterators.
     //*************************************************************************
@@ -2047,6 +2436,17 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    deque(deque&& other)
+      : etl::ideque<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE, BUFFER_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Assigns data to the deque.
     //*************************************************************************
@@ -2090,6 +2490,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    deque& operator =(deque&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
     //*************************************************************************
@@ -31,9 +31,21 @@ SOFTWARE.
 #ifndef ETL_FLAT_MAP_INCLUDED
 #define ETL_FLAT_MAP_INCLUDED
 
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 #include "platform.h"
 #include "reference_flat_map.h"
-#include "pool.h"
+#include "memory.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "debug_count.h"
+#include "error_handler.h"
+#include "private/flat_bulk.h"
 
 #if ETL_CPP11_SUPPORTED
   #include <initializer_list>
@@ -47,6 +59,8 @@ SOFTWARE.
 /// A flat_map with the capacity defined at compile time.
 /// Has insertion of O(N) and flat_map of O(logN)
 /// Duplicate entries are not allowed.
+/// The elements are stored contiguously in key order. A copy of each key is
+/// held in a parallel array so that searches only touch the keys.
 ///\ingroup containers
 //*****************************************************************************
 
@@ -58,29 +72,25 @@ namespace etl
   ///\ingroup flat_map
   //***************************************************************************
   template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey> >
-  class iflat_map : private etl::ireference_flat_map<TKey, TMapped, TKeyCompare>
+  class iflat_map
   {
-  private:
-
-    typedef etl::ireference_flat_map<TKey, TMapped, TKeyCompare> refmap_t;
-    typedef typename refmap_t::lookup_t lookup_t;
-    typedef etl::ipool storage_t;
-
   public:
 
-
     typedef std::pair<const TKey, TMapped> value_type;
     typedef TKey              key_type;
     typedef TMapped           mapped_type;
     typedef TKeyCompare       key_compare;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
 
-    typedef typename refmap_t::iterator       iterator;
-    typedef typename refmap_t::const_iterator const_iterator;
+    typedef value_type*       iterator;
+    typedef const value_type* const_iterator;
 
     typedef std::reverse_iterator<iterator>       reverse_iterator;
     typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
@@ -90,26 +100,6 @@ namespace etl
 
     typedef typename etl::parameter_type<TKey>::type key_parameter_t;
 
-  private:
-
-    //*********************************************************************
-    /// How to compare elements and keys.
-    //*********************************************************************
-    class compare
-    {
-    public:
-
-      bool operator ()(const value_type& element, key_type key) const
-      {
-        return key_compare()(element.first, key);
-      }
-
-      bool operator ()(key_type key, const value_type& element) const
-      {
-        return key_compare()(key, element.first);
-      }
-    };
-
   public:
 
     //*********************************************************************
@@ -118,7 +108,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return refmap_t::begin();
+      return p_values;
     }
 
     //*********************************************************************
@@ -127,7 +117,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return refmap_t::begin();
+      return p_values;
     }
 
     //*********************************************************************
@@ -136,7 +126,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return refmap_t::end();
+      return p_values + current_size;
     }
 
     //*********************************************************************
@@ -145,7 +135,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return refmap_t::end();
+      return p_values + current_size;
     }
 
     //*********************************************************************
@@ -154,7 +144,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return refmap_t::cbegin();
+      return p_values;
     }
 
     //*********************************************************************
@@ -163,7 +153,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return refmap_t::cend();
+      return p_values + current_size;
     }
 
     //*********************************************************************
@@ -172,7 +162,7 @@ namespace etl
     //*********************************************************************
     reverse_iterator rbegin()
     {
-      return refmap_t::rbegin();
+      return reverse_iterator(end());
     }
 
     //*********************************************************************
@@ -181,7 +171,7 @@ namespace etl
     //*********************************************************************
     const_reverse_iterator rbegin() const
     {
-      return refmap_t::rbegin();
+      return const_reverse_iterator(end());
     }
 
     //*********************************************************************
@@ -190,7 +180,7 @@ namespace etl
     //*********************************************************************
     reverse_iterator rend()
     {
-      return refmap_t::rend();
+      return reverse_iterator(begin());
     }
 
     //*********************************************************************
@@ -199,7 +189,7 @@ namespace etl
     //*********************************************************************
     const_reverse_iterator rend() const
     {
-      return refmap_t::rend();
+      return const_reverse_iterator(begin());
     }
 
     //*********************************************************************
@@ -208,7 +198,7 @@ namespace etl
     //*********************************************************************
     const_reverse_iterator crbegin() const
     {
-      return refmap_t::crbegin();
+      return const_reverse_iterator(cend());
     }
 
     //*********************************************************************
@@ -217,7 +207,7 @@ namespace etl
     //*********************************************************************
     const_reverse_iterator crend() const
     {
-      return refmap_t::crend();
+      return const_reverse_iterator(cbegin());
     }
 
     //*********************************************************************
@@ -227,20 +217,21 @@ namespace etl
     //*********************************************************************
     mapped_type& operator [](key_parameter_t key)
     {
-      iterator i_element = lower_bound(key);
+      size_type index = lower_bound_index(key);
 
       // Doesn't already exist?
-      if (i_element == end())
+      if (!is_match(index, key))
       {
-        value_type* pvalue = storage.allocate<value_type>();
-        ::new (pvalue) value_type();
-        ETL_INCREMENT_DEBUG_COUNT;
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
 
-        std::pair<iterator, bool> result = refmap_t::insert_at(i_element, *pvalue);
-        i_element->second = result.first->second;
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new (static_cast<void*>(p_values + index)) value_type(key, mapped_type());
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
       }
 
-      return i_element->second;
+      return p_values[index].second;
     }
 
     //*********************************************************************
@@ -251,7 +242,11 @@ namespace etl
     //*********************************************************************
     mapped_type& at(key_parameter_t key)
     {
-      return refmap_t::at(key);
+      size_type index = lower_bound_index(key);
+
+      ETL_ASSERT(is_match(index, key), ETL_ERROR(flat_map_out_of_bounds));
+
+      return p_values[index].second;
     }
 
     //*********************************************************************
@@ -262,7 +257,11 @@ namespace etl
     //*********************************************************************
     const mapped_type& at(key_parameter_t key) const
     {
-      return refmap_t::at(key);
+      size_type index = lower_bound_index(key);
+
+      ETL_ASSERT(is_match(index, key), ETL_ERROR(flat_map_out_of_bounds));
+
+      return p_values[index].second;
     }
 
     //*********************************************************************
@@ -295,19 +294,21 @@ namespace etl
     //*********************************************************************
     std::pair<iterator, bool> insert(const_reference value)
     {
-      iterator i_element = lower_bound(value.first);
+      size_type index = lower_bound_index(value.first);
 
-      std::pair<iterator, bool> result(i_element, false);
+      std::pair<iterator, bool> result(p_values + index, false);
 
       // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != value.first)))
+      if (!is_match(index, value.first))
       {
-        ETL_ASSERT(!refmap_t::full(), ETL_ERROR(flat_map_full));
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
 
-        value_type* pvalue = storage.allocate<value_type>();
-        ::new (pvalue) value_type(value);
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(value.first);
+        ::new (static_cast<void*>(p_values + index)) value_type(value);
+        ++current_size;
         ETL_INCREMENT_DEBUG_COUNT;
-        result = refmap_t::insert_at(i_element, *pvalue);
+        result.second = true;
       }
 
       return result;
@@ -324,6 +325,47 @@ namespace etl
       return insert(value).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the flat_map.
+    /// The value is left untouched if the key is already in the flat_map.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      size_type index = lower_bound_index(value.first);
+
+      std::pair<iterator, bool> result(p_values + index, false);
+
+      // Doesn't already exist?
+      if (!is_match(index, value.first))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(value.first);
+        ::new (static_cast<void*>(p_values + index)) value_type(std::move(value));
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        result.second = true;
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the flat_map.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator /*position*/, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
@@ -340,6 +382,66 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the flat_map in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values already in the map are kept. If a key is repeated in the range
+    /// then it is unspecified which of the repeats is kept.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const size_type n_sorted = current_size;
+
+        while ((first != last) && !full())
+        {
+          ::new (static_cast<void*>(p_values + current_size)) value_type(*first++);
+          ::new (static_cast<void*>(p_keys + current_size)) key_type(p_values[current_size].first);
+          ++current_size;
+          ETL_INCREMENT_DEBUG_COUNT;
+        }
+
+        element_access access(p_keys, p_values);
+
+        size_type kept = etl::private_flat_bulk::merge_appended(access, n_sorted, current_size, true);
+
+        // Remove the values whose keys were already present.
+        remove(kept, current_size - kept);
+
+        if (full())
+        {
+          // Only values that are already present can still be accepted.
+          while ((first != last) && (count((*first).first) != 0))
+          {
+            ++first;
+          }
+
+          break;
+        }
+      }
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_map_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the flat_map in bulk.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
     //*************************************************************************
     /// Emplaces a value to the map.
     //*************************************************************************
@@ -348,32 +450,66 @@ namespace etl
       return insert(value);
     }
 
+#if ETL_CPP11_SUPPORTED
     //*************************************************************************
     /// Emplaces a value to the map.
     //*************************************************************************
-    std::pair<iterator, bool> emplace(const key_type& key, const mapped_type& value)
+    std::pair<iterator, bool> emplace(rvalue_reference value)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
-
-      // Create it.
-      value_type* pvalue = storage.allocate<value_type>();
-      ::new ((void*)etl::addressof(pvalue->first)) key_type(key);
-      ::new ((void*)etl::addressof(pvalue->second)) mapped_type(value);
+      return insert(std::move(value));
+    }
+#endif
 
-      iterator i_element = lower_bound(key);
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from 'args'.
+    //*************************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(const key_type& key, Args && ... args)
+    {
+      size_type index = lower_bound_index(key);
 
-      std::pair<iterator, bool> result(i_element, false);
+      std::pair<iterator, bool> result(p_values + index, false);
 
       // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != key)))
+      if (!is_match(index, key))
       {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].second)) mapped_type(std::forward<Args>(args)...);
+        ++current_size;
         ETL_INCREMENT_DEBUG_COUNT;
-        result = refmap_t::insert_at(i_element, *pvalue);
+        result.second = true;
       }
-      else
+
+      return result;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    std::pair<iterator, bool> emplace(const key_type& key, const mapped_type& value)
+    {
+      size_type index = lower_bound_index(key);
+
+      std::pair<iterator, bool> result(p_values + index, false);
+
+      // Doesn't already exist?
+      if (!is_match(index, key))
       {
-        pvalue->~value_type();
-        storage.release(pvalue);
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].second)) mapped_type(value);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        result.second = true;
       }
 
       return result;
@@ -385,27 +521,22 @@ namespace etl
     template <typename T1>
     std::pair<iterator, bool> emplace(const key_type& key, const T1& value1)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+      size_type index = lower_bound_index(key);
 
-      // Create it.
-      value_type* pvalue = storage.allocate<value_type>();
-      ::new ((void*)etl::addressof(pvalue->first)) key_type(key);
-      ::new ((void*)etl::addressof(pvalue->second)) mapped_type(value1);
-
-      iterator i_element = lower_bound(key);
-
-      std::pair<iterator, bool> result(i_element, false);
+      std::pair<iterator, bool> result(p_values + index, false);
 
       // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != key)))
+      if (!is_match(index, key))
       {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].second)) mapped_type(value1);
+        ++current_size;
         ETL_INCREMENT_DEBUG_COUNT;
-        result = refmap_t::insert_at(i_element, *pvalue);
-      }
-      else
-      {
-        pvalue->~value_type();
-        storage.release(pvalue);
+        result.second = true;
       }
 
       return result;
@@ -417,27 +548,22 @@ namespace etl
     template <typename T1, typename T2>
     std::pair<iterator, bool> emplace(const key_type& key, const T1& value1, const T2& value2)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
-
-      // Create it.
-      value_type* pvalue = storage.allocate<value_type>();
-      ::new ((void*)etl::addressof(pvalue->first)) key_type(key);
-      ::new ((void*)etl::addressof(pvalue->second)) mapped_type(value1, value2);
+      size_type index = lower_bound_index(key);
 
-      iterator i_element = lower_bound(key);
-
-      std::pair<iterator, bool> result(i_element, false);
+      std::pair<iterator, bool> result(p_values + index, false);
 
       // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != key)))
+      if (!is_match(index, key))
       {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].second)) mapped_type(value1, value2);
+        ++current_size;
         ETL_INCREMENT_DEBUG_COUNT;
-        result = refmap_t::insert_at(i_element, *pvalue);
-      }
-      else
-      {
-        pvalue->~value_type();
-        storage.release(pvalue);
+        result.second = true;
       }
 
       return result;
@@ -449,27 +575,22 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     std::pair<iterator, bool> emplace(const key_type& key, const T1& value1, const T2& value2, const T3& value3)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
-
-      // Create it.
-      value_type* pvalue = storage.allocate<value_type>();
-      ::new ((void*)etl::addressof(pvalue->first)) key_type(key);
-      ::new ((void*)etl::addressof(pvalue->second)) mapped_type(value1, value2, value3);
-
-      iterator i_element = lower_bound(key);
+      size_type index = lower_bound_index(key);
 
-      std::pair<iterator, bool> result(i_element, false);
+      std::pair<iterator, bool> result(p_values + index, false);
 
       // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != key)))
+      if (!is_match(index, key))
       {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].second)) mapped_type(value1, value2, value3);
+        ++current_size;
         ETL_INCREMENT_DEBUG_COUNT;
-        result = refmap_t::insert_at(i_element, *pvalue);
-      }
-      else
-      {
-        pvalue->~value_type();
-        storage.release(pvalue);
+        result.second = true;
       }
 
       return result;
@@ -481,31 +602,27 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     std::pair<iterator, bool> emplace(const key_type& key, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
-      ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+      size_type index = lower_bound_index(key);
 
-      // Create it.
-      value_type* pvalue = storage.allocate<value_type>();
-      ::new ((void*)etl::addressof(pvalue->first)) key_type(key);
-      ::new ((void*)etl::addressof(pvalue->second)) mapped_type(value1, value2, value3, value4);
-
-      iterator i_element = lower_bound(key);
-
-      std::pair<iterator, bool> result(i_element, false);
+      std::pair<iterator, bool> result(p_values + index, false);
 
       // Doesn't already exist?
-      if ((i_element == end() || (i_element->first != key)))
+      if (!is_match(index, key))
       {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_map_full));
+
+        make_space(index);
+        ::new (static_cast<void*>(p_keys + index)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].first)) key_type(key);
+        ::new ((void*)etl::addressof(p_values[index].second)) mapped_type(value1, value2, value3, value4);
+        ++current_size;
         ETL_INCREMENT_DEBUG_COUNT;
-        result = refmap_t::insert_at(i_element, *pvalue);
-      }
-      else
-      {
-        pvalue->~value_type();
-        storage.release(pvalue);
+        result.second = true;
       }
 
       return result;
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -514,18 +631,15 @@ namespace etl
     //*********************************************************************
     size_t erase(key_parameter_t key)
     {
-      iterator i_element = find(key);
+      size_type index = lower_bound_index(key);
 
-      if (i_element == end())
+      if (!is_match(index, key))
       {
         return 0;
       }
       else
       {
-        i_element->~value_type();
-        storage.release(etl::addressof(*i_element));
-        refmap_t::erase(i_element);
-        ETL_DECREMENT_DEBUG_COUNT;
+        remove(index, 1);
         return 1;
       }
     }
@@ -536,10 +650,7 @@ namespace etl
     //*********************************************************************
     void erase(iterator i_element)
     {
-      i_element->~value_type();
-      storage.release(etl::addressof(*i_element));
-      refmap_t::erase(i_element);
-      ETL_DECREMENT_DEBUG_COUNT;
+      remove(size_type(i_element - p_values), 1);
     }
 
     //*********************************************************************
@@ -551,17 +662,7 @@ namespace etl
     //*********************************************************************
     void erase(iterator first, iterator last)
     {
-      iterator itr = first;
-
-      while (itr != last)
-      {
-        itr->~value_type();
-        storage.release(etl::addressof(*itr));
-        ++itr;
-        ETL_DECREMENT_DEBUG_COUNT;
-      }
-
-      refmap_t::erase(first, last);
+      remove(size_type(first - p_values), size_type(last - first));
     }
 
     //*************************************************************************
@@ -569,24 +670,17 @@ namespace etl
     //*************************************************************************
     void clear()
     {
-      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<value_type>::value)
+      if ETL_IF_CONSTEXPR(!(etl::is_trivially_destructible<key_type>::value && etl::is_trivially_destructible<mapped_type>::value))
       {
-        storage.release_all();
-      }
-      else
-      {
-        iterator itr = begin();
-
-        while (itr != end())
+        for (size_type i = 0; i < current_size; ++i)
         {
-          itr->~value_type();
-          storage.release(etl::addressof(*itr));
-          ++itr;
+          p_keys[i].~key_type();
+          p_values[i].~value_type();
         }
       }
 
+      current_size = 0;
       ETL_RESET_DEBUG_COUNT;
-      refmap_t::clear();
     }
 
     //*********************************************************************
@@ -596,7 +690,9 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      return refmap_t::find(key);
+      size_type index = lower_bound_index(key);
+
+      return is_match(index, key) ? p_values + index : end();
     }
 
     //*********************************************************************
@@ -606,7 +702,9 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      return refmap_t::find(key);
+      size_type index = lower_bound_index(key);
+
+      return is_match(index, key) ? p_values + index : end();
     }
 
     //*********************************************************************
@@ -616,7 +714,7 @@ namespace etl
     //*********************************************************************
     size_t count(key_parameter_t key) const
     {
-      return refmap_t::count(key);
+      return is_match(lower_bound_index(key), key) ? 1 : 0;
     }
 
     //*********************************************************************
@@ -626,7 +724,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return refmap_t::lower_bound(key);
+      return p_values + lower_bound_index(key);
     }
 
     //*********************************************************************
@@ -636,7 +734,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return refmap_t::lower_bound(key);
+      return p_values + lower_bound_index(key);
     }
 
     //*********************************************************************
@@ -646,7 +744,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return refmap_t::upper_bound(key);
+      return p_values + upper_bound_index(key);
     }
 
     //*********************************************************************
@@ -656,7 +754,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return refmap_t::upper_bound(key);
+      return p_values + upper_bound_index(key);
     }
 
     //*********************************************************************
@@ -666,7 +764,10 @@ namespace etl
     //*********************************************************************
     std::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      return refmap_t::equal_range(key);
+      size_type index = lower_bound_index(key);
+      size_type n = is_match(index, key) ? 1 : 0;
+
+      return std::pair<iterator, iterator>(p_values + index, p_values + index + n);
     }
 
     //*********************************************************************
@@ -676,7 +777,10 @@ namespace etl
     //*********************************************************************
     std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      return refmap_t::equal_range(key);
+      size_type index = lower_bound_index(key);
+      size_type n = is_match(index, key) ? 1 : 0;
+
+      return std::pair<const_iterator, const_iterator>(p_values + index, p_values + index + n);
     }
 
     //*************************************************************************
@@ -692,13 +796,28 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_map& operator = (iflat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the flat_map.
     ///\return The current size of the flat_map.
     //*************************************************************************
     size_type size() const
     {
-      return refmap_t::size();
+      return current_size;
     }
 
     //*************************************************************************
@@ -707,7 +826,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return refmap_t::empty();
+      return current_size == 0;
     }
 
     //*************************************************************************
@@ -716,7 +835,7 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      return refmap_t::full();
+      return current_size == CAPACITY;
     }
 
     //*************************************************************************
@@ -725,7 +844,7 @@ namespace etl
     //*************************************************************************
     size_type capacity() const
     {
-      return refmap_t::capacity();
+      return CAPACITY;
     }
 
     //*************************************************************************
@@ -734,7 +853,7 @@ namespace etl
     //*************************************************************************
     size_type max_size() const
     {
-      return refmap_t::max_size();
+      return CAPACITY;
     }
 
     //*************************************************************************
@@ -743,7 +862,7 @@ namespace etl
     //*************************************************************************
     size_t available() const
     {
-      return refmap_t::available();
+      return CAPACITY - current_size;
     }
 
   protected:
@@ -751,18 +870,249 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iflat_map(lookup_t& lookup_, storage_t& storage_)
-      : refmap_t(lookup_),
-        storage(storage_)
+    iflat_map(key_type* p_keys_, value_type* p_values_, size_type max_size_)
+      : p_keys(p_keys_),
+        p_values(p_values_),
+        current_size(0),
+        CAPACITY(max_size_)
     {
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another flat_map in to this one, leaving it empty.
+    /// The elements are already in order, so they are simply appended.
+    //*********************************************************************
+    void move_container(iflat_map&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(flat_map_full));
+
+      clear();
+
+      for (size_type i = 0; i < rhs.current_size; ++i)
+      {
+        ::new (static_cast<void*>(p_keys + i)) key_type(std::move(rhs.p_keys[i]));
+        ::new (static_cast<void*>(p_values + i)) value_type(std::move(rhs.p_values[i]));
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      current_size = rhs.current_size;
+
+      rhs.clear();
+    }
+#endif
+
   private:
 
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
-    storage_t& storage;
+    /// Can elements be moved with memmove?
+    static const bool IS_RELOCATABLE = etl::is_trivially_relocatable<key_type>::value &&
+                                       etl::is_trivially_relocatable<mapped_type>::value;
+
+    //*********************************************************************
+    /// Gives the bulk insertion algorithms access to the elements by index.
+    //*********************************************************************
+    class element_access
+    {
+    public:
+
+      element_access(key_type* p_keys_, value_type* p_values_)
+        : p_keys(p_keys_),
+          p_values(p_values_)
+      {
+      }
+
+      bool less(size_type a, size_type b) const
+      {
+        return key_compare()(p_keys[a], p_keys[b]);
+      }
+
+      //*******************************************************************
+      /// Exchanges two elements.
+      /// The keys of the elements are const, so non-relocatable elements are
+      /// copied and rebuilt.
+      //*******************************************************************
+      void swap(size_type a, size_type b)
+      {
+        if ETL_IF_CONSTEXPR(IS_RELOCATABLE)
+        {
+          swap_bytes(p_keys + a, p_keys + b);
+          swap_bytes(p_values + a, p_values + b);
+        }
+        else
+        {
+          std::swap(p_keys[a], p_keys[b]);
+
+#if ETL_CPP11_SUPPORTED
+          value_type temp(std::move(p_values[a]));
+          p_values[a].~value_type();
+          ::new (static_cast<void*>(p_values + a)) value_type(std::move(p_values[b]));
+          p_values[b].~value_type();
+          ::new (static_cast<void*>(p_values + b)) value_type(std::move(temp));
+#else
+          value_type temp(p_values[a]);
+          p_values[a].~value_type();
+          ::new (static_cast<void*>(p_values + a)) value_type(p_values[b]);
+          p_values[b].~value_type();
+          ::new (static_cast<void*>(p_values + b)) value_type(temp);
+#endif
+        }
+      }
+
+    private:
+
+      template <typename T>
+      static void swap_bytes(T* a, T* b)
+      {
+        typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type temp;
+
+        memcpy(static_cast<void*>(&temp), static_cast<const void*>(a), sizeof(T));
+        memcpy(static_cast<void*>(a), static_cast<const void*>(b), sizeof(T));
+        memcpy(static_cast<void*>(b), static_cast<const void*>(&temp), sizeof(T));
+      }
+
+      key_type*   p_keys;
+      value_type* p_values;
+    };
+
+    friend class element_access;
+
+    //*********************************************************************
+    /// Finds the index of the first key not less than 'key'.
+    /// The search halves the range without branching on the comparison,
+    /// so the cost does not depend on the branch predictor.
+    //*********************************************************************
+    size_type lower_bound_index(key_parameter_t key) const
+    {
+      if (current_size == 0)
+      {
+        return 0;
+      }
+
+      key_compare compare;
+      const key_type* base = p_keys;
+      size_type n = current_size;
+
+      while (n > 1)
+      {
+        size_type half = n / 2;
+        base = compare(base[half - 1], key) ? base + half : base;
+        n -= half;
+      }
+
+      return size_type(base - p_keys) + (compare(*base, key) ? 1 : 0);
+    }
+
+    //*********************************************************************
+    /// Finds the index of the first key greater than 'key'.
+    //*********************************************************************
+    size_type upper_bound_index(key_parameter_t key) const
+    {
+      if (current_size == 0)
+      {
+        return 0;
+      }
+
+      key_compare compare;
+      const key_type* base = p_keys;
+      size_type n = current_size;
+
+      while (n > 1)
+      {
+        size_type half = n / 2;
+        base = !compare(key, base[half - 1]) ? base + half : base;
+        n -= half;
+      }
+
+      return size_type(base - p_keys) + (!compare(key, *base) ? 1 : 0);
+    }
+
+    //*********************************************************************
+    /// Is the key at 'index' equal to 'key'?
+    /// 'index' must be the lower bound of 'key'.
+    //*********************************************************************
+    bool is_match(size_type index, key_parameter_t key) const
+    {
+      return (index != current_size) && !key_compare()(key, p_keys[index]);
+    }
+
+    //*********************************************************************
+    /// Moves the elements from 'index' up by one, leaving 'index' unconstructed.
+    //*********************************************************************
+    void make_space(size_type index)
+    {
+      if ETL_IF_CONSTEXPR(IS_RELOCATABLE)
+      {
+        size_type n = current_size - index;
+        memmove(static_cast<void*>(p_keys + index + 1),   static_cast<const void*>(p_keys + index),   n * sizeof(key_type));
+        memmove(static_cast<void*>(p_values + index + 1), static_cast<const void*>(p_values + index), n * sizeof(value_type));
+      }
+      else
+      {
+        for (size_type i = current_size; i > index; --i)
+        {
+#if ETL_CPP11_SUPPORTED
+          ::new (static_cast<void*>(p_keys + i)) key_type(std::move(p_keys[i - 1]));
+          p_keys[i - 1].~key_type();
+          ::new (static_cast<void*>(p_values + i)) value_type(std::move(p_values[i - 1]));
+          p_values[i - 1].~value_type();
+#else
+          ::new (static_cast<void*>(p_keys + i)) key_type(p_keys[i - 1]);
+          p_keys[i - 1].~key_type();
+          ::new (static_cast<void*>(p_values + i)) value_type(p_values[i - 1]);
+          p_values[i - 1].~value_type();
+#endif
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Destroys 'n' elements from 'index' and closes the gap.
+    //*********************************************************************
+    void remove(size_type index, size_type n)
+    {
+      size_type i;
+
+      for (i = index; i < (index + n); ++i)
+      {
+        p_keys[i].~key_type();
+        p_values[i].~value_type();
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      if ETL_IF_CONSTEXPR(IS_RELOCATABLE)
+      {
+        size_type remaining = current_size - (index + n);
+        memmove(static_cast<void*>(p_keys + index),   static_cast<const void*>(p_keys + index + n),   remaining * sizeof(key_type));
+        memmove(static_cast<void*>(p_values + index), static_cast<const void*>(p_values + index + n), remaining * sizeof(value_type));
+      }
+      else
+      {
+        for (i = index + n; i < current_size; ++i)
+        {
+#if ETL_CPP11_SUPPORTED
+          ::new (static_cast<void*>(p_keys + i - n)) key_type(std::move(p_keys[i]));
+          p_keys[i].~key_type();
+          ::new (static_cast<void*>(p_values + i - n)) value_type(std::move(p_values[i]));
+          p_values[i].~value_type();
+#else
+          ::new (static_cast<void*>(p_keys + i - n)) key_type(p_keys[i]);
+          p_keys[i].~key_type();
+          ::new (static_cast<void*>(p_values + i - n)) value_type(p_values[i]);
+          p_values[i].~value_type();
+#endif
+        }
+      }
+
+      current_size -= n;
+    }
+
+    key_type*       p_keys;       ///< The sorted keys, searched by lookups.
+    value_type*     p_values;     ///< The elements, in the same order as the keys.
+    size_type       current_size; ///< The number of elements.
+    const size_type CAPACITY;     ///< The maximum number of elements.
 
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT;
@@ -828,7 +1178,7 @@ namespace etl
     /// Constructor.
     //*************************************************************************
     flat_map()
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
     {
     }
 
@@ -836,7 +1186,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     flat_map(const flat_map& other)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
     {
       this->assign(other.cbegin(), other.cend());
     }
@@ -849,17 +1199,26 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     flat_map(TIterator first, TIterator last)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
     {
       this->assign(first, last);
     }
 
 #if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_map(flat_map&& other)
+      : etl::iflat_map<TKey, TValue, TCompare>(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+
     //*************************************************************************
     /// Construct from initializer_list.
     //*************************************************************************
     flat_map(std::initializer_list<typename etl::iflat_map<TKey, TValue, TCompare>::value_type> init)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
     {
       this->assign(init.begin(), init.end());
     }
@@ -886,15 +1245,30 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_map& operator = (flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     typedef typename etl::iflat_map<TKey, TValue, TCompare>::value_type node_t;
 
-    /// The pool of nodes.
-    etl::pool<node_t, MAX_SIZE> storage;
+    /// The buffer for the sorted keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE, etl::alignment_of<TKey>::value>::type key_buffer;
 
-    /// The vector that stores pointers to the nodes.
-    etl::vector<node_t*, MAX_SIZE> lookup;
+    /// The buffer for the elements.
+    typename etl::aligned_storage<sizeof(node_t) * MAX_SIZE, etl::alignment_of<node_t>::value>::type value_buffer;
   };
 }
 
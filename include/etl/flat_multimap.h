@@ -31,6 +31,8 @@ SOFTWARE.
 #ifndef ETL_FLAT_MULTMAP_INCLUDED
 #define ETL_FLAT_MULTMAP_INCLUDED
 
+#include <utility>
+
 #include "platform.h"
 #include "reference_flat_multimap.h"
 #include "pool.h"
@@ -77,6 +79,9 @@ namespace etl
     typedef TKeyCompare       key_compare;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -277,6 +282,37 @@ namespace etl
       return insert(value).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the flat_multimap.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      ETL_ASSERT(!refmap_t::full(), ETL_ERROR(flat_multimap_full));
+
+      iterator i_element = lower_bound(value.first);
+
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new (pvalue) value_type(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return refmap_t::insert_at(i_element, *pvalue);
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the flat_multimap.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the flat_multimap.
     /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
@@ -293,6 +329,46 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the flat_multimap in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values from the range follow any equal keys already in the multimap.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      const size_type n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
+      }
+
+      refmap_t::merge_appended(n_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multimap_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the flat_multimap in bulk.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
     //*************************************************************************
     /// Emplaces a value to the map.
     //*************************************************************************
@@ -301,6 +377,34 @@ namespace etl
       return insert(value);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    //*************************************************************************
+    std::pair<iterator, bool> emplace(rvalue_reference value)
+    {
+      return insert(std::move(value));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from 'args'.
+    //*************************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(const key_type& key, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(flat_multimap_full));
+
+      // Create it.
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new ((void*)etl::addressof(pvalue->first)) key_type(key);
+      ::new ((void*)etl::addressof(pvalue->second)) mapped_type(std::forward<Args>(args)...);
+      iterator i_element = lower_bound(key);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return refmap_t::insert_at(i_element, *pvalue);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the map.
     //*************************************************************************
@@ -389,6 +493,7 @@ namespace etl
 
       return refmap_t::insert_at(i_element, *pvalue);
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -573,6 +678,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_multimap& operator = (iflat_multimap&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the flat_multiset.
     ///\return The current size of the flat_multiset.
@@ -638,6 +758,32 @@ namespace etl
     {
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another flat_multimap in to this one, leaving it empty.
+    /// The elements are already in order, so they are simply appended.
+    //*********************************************************************
+    void move_container(iflat_multimap&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= capacity(), ETL_ERROR(flat_multimap_full));
+
+      clear();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(std::move(*itr));
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
+        ++itr;
+      }
+
+      rhs.clear();
+    }
+#endif
+
   private:
 
     // Disable copy construction.
@@ -744,6 +890,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_multimap(flat_multimap&& other)
+      : etl::iflat_multimap<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -767,6 +922,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_multimap& operator = (flat_multimap&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     typedef typename etl::iflat_multimap<TKey, TValue, TCompare>::value_type node_t;
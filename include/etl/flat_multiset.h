@@ -31,6 +31,8 @@ SOFTWARE.
 #ifndef ETL_FLAT_MULTISET_INCLUDED
 #define ETL_FLAT_MULTISET_INCLUDED
 
+#include <utility>
+
 #include "platform.h"
 #include "reference_flat_multiset.h"
 #include "pool.h"
@@ -73,6 +75,9 @@ namespace etl
     typedef TKeyCompare       key_compare;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -253,6 +258,37 @@ namespace etl
       return insert(value).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the flat_multiset.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(flat_multiset_full));
+
+      iterator i_element = std::lower_bound(begin(), end(), value, TKeyCompare());
+
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new (pvalue) value_type(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return refset_t::insert_at(i_element, *pvalue);
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the flat_multiset.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the flat_multiset.
     /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
@@ -269,6 +305,66 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the flat_multiset in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values from the range follow any equal keys already in the multiset.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      const size_type n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
+      }
+
+      refset_t::merge_appended(n_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multiset_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the flat_multiset in bulk.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// The value is constructed in place from 'args'.
+    //*************************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(flat_multiset_full));
+
+      // Create it.
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new (pvalue) value_type(std::forward<Args>(args)...);
+
+      iterator i_element = lower_bound(*pvalue);
+
+      ETL_INCREMENT_DEBUG_COUNT;
+      return std::pair<iterator, bool>(refset_t::insert_at(i_element, *pvalue));
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the set.
     //*************************************************************************
@@ -349,6 +445,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
       return std::pair<iterator, bool>(refset_t::insert_at(i_element, *pvalue));
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -533,6 +630,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_multiset& operator = (iflat_multiset&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the flat_multiset.
     ///\return The current size of the flat_multiset.
@@ -598,6 +710,32 @@ namespace etl
     {
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another flat_multiset in to this one, leaving it empty.
+    /// The elements are already in order, so they are simply appended.
+    //*********************************************************************
+    void move_container(iflat_multiset&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= capacity(), ETL_ERROR(flat_multiset_full));
+
+      clear();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(std::move(*itr));
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
+        ++itr;
+      }
+
+      rhs.clear();
+    }
+#endif
+
   private:
 
     // Disable copy construction.
@@ -676,7 +814,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     flat_multiset(const flat_multiset& other)
-      : iflat_multiset<T, TCompare>(lookup, storage)
+      : etl::iflat_multiset<T, TCompare>(lookup, storage)
     {
       this->assign(other.cbegin(), other.cend());
     }
@@ -689,7 +827,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     flat_multiset(TIterator first, TIterator last)
-      : iflat_multiset<T, TCompare>(lookup, storage)
+      : etl::iflat_multiset<T, TCompare>(lookup, storage)
     {
       this->assign(first, last);
     }
@@ -699,10 +837,19 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     flat_multiset(std::initializer_list<T> init)
-      : iflat_multiset<T, TCompare>(lookup, storage)
+      : etl::iflat_multiset<T, TCompare>(lookup, storage)
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_multiset(flat_multiset&& other)
+      : etl::iflat_multiset<T, TCompare>(lookup, storage)
+    {
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -726,6 +873,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_multiset& operator = (flat_multiset&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     typedef typename etl::iflat_multiset<T, TCompare>::value_type node_t;
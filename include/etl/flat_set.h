@@ -31,6 +31,8 @@ SOFTWARE.
 #ifndef ETL_FLAT_SET_INCLUDED
 #define ETL_FLAT_SET_INCLUDED
 
+#include <utility>
+
 #include "platform.h"
 #include "reference_flat_set.h"
 #include "pool.h"
@@ -73,6 +75,9 @@ namespace etl
     typedef TKeyCompare       key_compare;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -257,6 +262,45 @@ namespace etl
       return insert(value).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the flat_set.
+    /// The value is left untouched if it is already in the flat_set.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      iterator i_element = lower_bound(value);
+
+      std::pair<iterator, bool> result(i_element, false);
+
+      // Doesn't already exist?
+      if ((i_element == end() || (*i_element != value)))
+      {
+        ETL_ASSERT(!refset_t::full(), ETL_ERROR(flat_set_full));
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(std::move(value));
+        ETL_INCREMENT_DEBUG_COUNT;
+        result = refset_t::insert_at(i_element, *pvalue);
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the flat_set.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
@@ -273,6 +317,64 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the flat_set in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values already in the set are kept. If a value is repeated in the range
+    /// then it is unspecified which of the repeats is kept.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const size_type n_sorted = size();
+
+        while ((first != last) && !full())
+        {
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(*first++);
+          ETL_INCREMENT_DEBUG_COUNT;
+          refset_t::append(*pvalue);
+        }
+
+        // Remove the values that were already present.
+        iterator itr = begin();
+        std::advance(itr, refset_t::merge_appended(n_sorted));
+        erase(itr, end());
+
+        if (full())
+        {
+          // Only values that are already present can still be accepted.
+          while ((first != last) && (count(*first) != 0))
+          {
+            ++first;
+          }
+
+          break;
+        }
+      }
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_set_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the flat_set in bulk.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
     //*************************************************************************
     /// Emplaces a value to the set.
     //*************************************************************************
@@ -281,6 +383,47 @@ namespace etl
       return insert(value);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// The value is constructed in place from 'args'.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set is full and the value is not in it.
+    //*************************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      if (full())
+      {
+        // There is no free node to build the value in, but it may
+        // already be in the set, so look it up before asserting.
+        const value_type value(std::forward<Args>(args)...);
+        iterator i_element = find(value);
+
+        ETL_ASSERT(i_element != end(), ETL_ERROR(flat_set_full));
+
+        return std::pair<iterator, bool>(i_element, false);
+      }
+
+      // Create it.
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new (pvalue) value_type(std::forward<Args>(args)...);
+
+      iterator i_element = lower_bound(*pvalue);
+
+      // Doesn't already exist?
+      if ((i_element == end() || (*i_element != *pvalue)))
+      {
+        ETL_INCREMENT_DEBUG_COUNT;
+        return refset_t::insert_at(i_element, *pvalue);
+      }
+
+      // Destroy it.
+      pvalue->~value_type();
+      storage.release(pvalue);
+
+      return std::pair<iterator, bool>(i_element, false);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the set.
     //*************************************************************************
@@ -412,6 +555,7 @@ namespace etl
 
       return result;
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -599,6 +743,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_set& operator = (iflat_set&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the flat_set.
     ///\return The current size of the flat_set.
@@ -664,6 +823,32 @@ namespace etl
     {
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another flat_set in to this one, leaving it empty.
+    /// The elements are already in order, so they are simply appended.
+    //*********************************************************************
+    void move_container(iflat_set&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= capacity(), ETL_ERROR(flat_set_full));
+
+      clear();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(std::move(*itr));
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
+        ++itr;
+      }
+
+      rhs.clear();
+    }
+#endif
+
   private:
 
     // Disable copy construction.
@@ -769,6 +954,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_set(flat_set&& other)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -792,6 +986,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_set& operator = (flat_set&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     typedef typename etl::iflat_set<T, TCompare>::value_type node_t;
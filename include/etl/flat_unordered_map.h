@@ -0,0 +1,1229 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_UNORDERED_MAP_INCLUDED
+#define ETL_FLAT_UNORDERED_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+#include <functional>
+#include <utility>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "nullptr.h"
+#include "power.h"
+#include "log.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "private/flat_hash_group.h"
+#include "private/hash_mix.h"
+
+#undef ETL_FILE
+#define ETL_FILE "51"
+
+//*****************************************************************************
+///\defgroup flat_unordered_map flat_unordered_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// The elements are stored inline in the slots, with a separate array of
+/// control bytes that is searched a group at a time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_exception : public etl::exception
+  {
+  public:
+
+    flat_unordered_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_full : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_out_of_range : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:range", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_iterator : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:iterator", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_unordered_map.
+  /// Can be used as a reference type for all flat_unordered_map containing a specific type.
+  ///
+  /// Keys are placed by linear probing and found by matching a 7 bit tag from
+  /// the hash against a group of control bytes at a time. Erase shifts the
+  /// following entries of the probe run back instead of leaving tombstones,
+  /// so lookups never slow down as entries are erased.
+  ///
+  /// Iterators are invalidated by insertion. Erasure only invalidates
+  /// iterators to the erased element, and to elements that it moves; an
+  /// iteration that erases as it goes visits every element exactly once.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class iflat_unordered_map
+  {
+  public:
+
+    typedef std::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  private:
+
+    typedef etl::private_flat_hash::group group_t;
+    typedef typename group_t::mask_t      mask_t;
+
+  public:
+
+    //*********************************************************************
+    class iterator : public std::iterator<std::forward_iterator_tag, T>
+    {
+    public:
+
+      typedef typename iflat_unordered_map::value_type      value_type;
+      typedef typename iflat_unordered_map::key_type        key_type;
+      typedef typename iflat_unordered_map::mapped_type     mapped_type;
+      typedef typename iflat_unordered_map::hasher          hasher;
+      typedef typename iflat_unordered_map::key_equal       key_equal;
+      typedef typename iflat_unordered_map::reference       reference;
+      typedef typename iflat_unordered_map::const_reference const_reference;
+      typedef typename iflat_unordered_map::pointer         pointer;
+      typedef typename iflat_unordered_map::const_pointer   const_pointer;
+      typedef typename iflat_unordered_map::size_type       size_type;
+
+      friend class iflat_unordered_map;
+
+      //*********************************
+      iterator()
+        : pmap(nullptr),
+          index(0)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pmap(other.pmap),
+          index(other.index)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        index = pmap->next_index(index);
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        index = pmap->next_index(index);
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pmap  = other.pmap;
+        index = other.index;
+        return *this;
+      }
+
+      //*********************************
+      reference operator *()
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      pointer operator &()
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      pointer operator ->()
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(iflat_unordered_map* pmap_, size_t index_)
+        : pmap(pmap_),
+          index(index_)
+      {
+      }
+
+      iflat_unordered_map* pmap;
+      size_t               index;
+    };
+
+    friend class iterator;
+
+    //*********************************************************************
+    class const_iterator : public std::iterator<std::forward_iterator_tag, const T>
+    {
+    public:
+
+      typedef typename iflat_unordered_map::value_type      value_type;
+      typedef typename iflat_unordered_map::key_type        key_type;
+      typedef typename iflat_unordered_map::mapped_type     mapped_type;
+      typedef typename iflat_unordered_map::hasher          hasher;
+      typedef typename iflat_unordered_map::key_equal       key_equal;
+      typedef typename iflat_unordered_map::reference       reference;
+      typedef typename iflat_unordered_map::const_reference const_reference;
+      typedef typename iflat_unordered_map::pointer         pointer;
+      typedef typename iflat_unordered_map::const_pointer   const_pointer;
+      typedef typename iflat_unordered_map::size_type       size_type;
+
+      friend class iflat_unordered_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pmap(nullptr),
+          index(0)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iflat_unordered_map::iterator& other)
+        : pmap(other.pmap),
+          index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pmap(other.pmap),
+          index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        index = pmap->next_index(index);
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        index = pmap->next_index(index);
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pmap  = other.pmap;
+        index = other.index;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const iflat_unordered_map* pmap_, size_t index_)
+        : pmap(pmap_),
+          index(index_)
+      {
+      }
+
+      const iflat_unordered_map* pmap;
+      size_t                     index;
+    };
+
+    friend class const_iterator;
+
+    typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the flat_unordered_map.
+    ///\return An iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(this, next_index(anchor));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_unordered_map.
+    ///\return A const iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, next_index(anchor));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_unordered_map.
+    ///\return A const iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, next_index(anchor));
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the flat_unordered_map.
+    ///\return An iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(this, anchor);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_unordered_map.
+    ///\return A const iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, anchor);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_unordered_map.
+    ///\return A const iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, anchor);
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_full if a new key does not fit.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      return insert(value_type(key, T())).first->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(flat_unordered_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(flat_unordered_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_unordered_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(flat_unordered_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param value The value to insert.
+    ///\return A pair of the iterator to the element and <b>true</b> if it was inserted.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(const value_type& key_value_pair)
+    {
+      const size_t hash  = key_hash_function(key_value_pair.first);
+      size_t       index = find_or_prepare_insert(key_value_pair.first, hash);
+
+      if (pcontrol[index] != etl::private_flat_hash::CONTROL_EMPTY)
+      {
+        // Already there.
+        return std::pair<iterator, bool>(iterator(this, index), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(flat_unordered_map_full));
+
+      ::new (&pslots[index]) value_type(key_value_pair);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      set_control(index, get_tag(hash));
+      ++current_size;
+
+      if (index == anchor)
+      {
+        anchor = next_empty_index(index);
+      }
+
+      return std::pair<iterator, bool>(iterator(this, index), true);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const value_type& key_value_pair)
+    {
+      (void)position;
+
+      return insert(key_value_pair).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = find_index(key);
+
+      if (index == number_of_slots)
+      {
+        return 0;
+      }
+
+      erase_index(index);
+
+      return 1;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      const size_t index = ielement.index;
+
+      erase_index(index);
+
+      // A following element may have been shifted into the erased slot.
+      if (pcontrol[index] != etl::private_flat_hash::CONTROL_EMPTY)
+      {
+        return iterator(this, index);
+      }
+
+      return iterator(this, next_index(index));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      size_t       index     = first_.index;
+      const size_t end_index = last_.index;
+
+      if (index == end_index)
+      {
+        return iterator(this, end_index);
+      }
+
+      // The range is the run of slots from first to last, so empty them all.
+      while (index != end_index)
+      {
+        if (pcontrol[index] != etl::private_flat_hash::CONTROL_EMPTY)
+        {
+          pslots[index].~value_type();
+          ETL_DECREMENT_DEBUG_COUNT;
+          --current_size;
+
+          set_control(index, etl::private_flat_hash::CONTROL_EMPTY);
+        }
+
+        index = (index + 1) & slot_mask;
+      }
+
+      // The rest of the probe run may now be cut off from its home slots, so move
+      // each element back to the first empty slot after its home.
+      while (pcontrol[index] != etl::private_flat_hash::CONTROL_EMPTY)
+      {
+        const size_t home   = get_home(key_hash_function(pslots[index].first));
+        const size_t target = (pcontrol[home] == etl::private_flat_hash::CONTROL_EMPTY) ? home : next_empty_index(home);
+
+        if (((target - home) & slot_mask) < ((index - home) & slot_mask))
+        {
+          ::new (&pslots[target]) value_type(pslots[index]);
+          pslots[index].~value_type();
+
+          set_control(target, pcontrol[index]);
+          set_control(index, etl::private_flat_hash::CONTROL_EMPTY);
+        }
+
+        index = (index + 1) & slot_mask;
+      }
+
+      // Elements only move back into the emptied slots, none before first, so
+      // iteration carries on from the first occupied slot from there.
+      if (pcontrol[first_.index] != etl::private_flat_hash::CONTROL_EMPTY)
+      {
+        return iterator(this, first_.index);
+      }
+
+      return iterator(this, next_index(first_.index));
+    }
+
+    //*************************************************************************
+    /// Clears the flat_unordered_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find_index(key) == number_of_slots) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t index = find_index(key);
+
+      return (index == number_of_slots) ? end() : iterator(this, index);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const size_t index = find_index(key);
+
+      return (index == number_of_slots) ? end() : const_iterator(this, index);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    std::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the flat_unordered_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_unordered_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_unordered_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_unordered_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of slots.
+    //*************************************************************************
+    size_t slot_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / slot_count.
+    ///\return The load factor = size / slot_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(slot_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_unordered_map& operator = (const iflat_unordered_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    ///\param pcontrol_        The control bytes. number_of_slots_ + group width - 1 of them.
+    ///\param pslots_          The uninitialised slots.
+    ///\param number_of_slots_ The number of slots. A power of two, greater than max_size_.
+    ///\param max_size_        The maximum number of elements.
+    //*********************************************************************
+    iflat_unordered_map(uint8_t* pcontrol_, value_type* pslots_, size_t number_of_slots_, size_t max_size_)
+      : pcontrol(pcontrol_),
+        pslots(pslots_),
+        number_of_slots(number_of_slots_),
+        maximum_size(max_size_),
+        slot_mask(number_of_slots_ - 1),
+        hash_shift(64 - etl::private_flat_hash::lowest_bit_index(uint64_t(number_of_slots_))),
+        current_size(0),
+        anchor(0)
+    {
+    }
+
+    //*********************************************************************
+    /// Initialise the flat_unordered_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0; i < number_of_slots; ++i)
+        {
+          if (pcontrol[i] != etl::private_flat_hash::CONTROL_EMPTY)
+          {
+            pslots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+      }
+
+      for (size_t i = 0; i < (number_of_slots + group_t::WIDTH - 1); ++i)
+      {
+        pcontrol[i] = etl::private_flat_hash::CONTROL_EMPTY;
+      }
+
+      current_size = 0;
+      anchor       = 0;
+    }
+
+  private:
+
+    //*********************************************************************
+    /// The home slot for a hash, from the top bits of the mixed hash.
+    //*********************************************************************
+    size_t get_home(size_t hash) const
+    {
+      return size_t(etl::private_hash::fmix_64(uint64_t(hash)) >> hash_shift);
+    }
+
+    //*********************************************************************
+    /// The 7 bit tag for a hash, from the mixed bits just below the home bits.
+    //*********************************************************************
+    uint8_t get_tag(size_t hash) const
+    {
+      return uint8_t((etl::private_hash::fmix_64(uint64_t(hash)) >> (hash_shift - 7)) & 0x7F);
+    }
+
+    //*********************************************************************
+    /// Sets a control byte, and its copy after the end if it has one.
+    //*********************************************************************
+    void set_control(size_t index, uint8_t value)
+    {
+      pcontrol[index] = value;
+
+      if (index < (group_t::WIDTH - 1))
+      {
+        pcontrol[number_of_slots + index] = value;
+      }
+    }
+
+    //*********************************************************************
+    /// Finds the slot holding a key.
+    ///\return The slot index, or number_of_slots if the key is not found.
+    //*********************************************************************
+    size_t find_index(key_parameter_t key) const
+    {
+      const size_t index = find_or_prepare_insert(key, key_hash_function(key));
+
+      return (pcontrol[index] == etl::private_flat_hash::CONTROL_EMPTY) ? number_of_slots : index;
+    }
+
+    //*********************************************************************
+    /// Finds the slot holding a key, or the empty slot where it would go.
+    //*********************************************************************
+    size_t find_or_prepare_insert(key_parameter_t key, size_t hash) const
+    {
+      const uint8_t tag   = get_tag(hash);
+      size_t        index = get_home(hash);
+
+      while (true)
+      {
+        const group_t group(pcontrol + index);
+
+        mask_t matches = group.match(tag);
+        mask_t empties = group.match_empty();
+
+        // A key is never stored beyond the first empty slot of its probe run.
+        if (empties != 0)
+        {
+          matches &= (empties & (~empties + 1)) - 1;
+        }
+
+        while (matches != 0)
+        {
+          const size_t slot = (index + group_t::index(matches)) & slot_mask;
+
+          if (key_equal_function(key, pslots[slot].first))
+          {
+            return slot;
+          }
+
+          matches &= matches - 1;
+        }
+
+        if (empties != 0)
+        {
+          return (index + group_t::index(empties)) & slot_mask;
+        }
+
+        index = (index + group_t::WIDTH) & slot_mask;
+      }
+    }
+
+    //*********************************************************************
+    /// Finds the next empty slot after 'index'.
+    /// There is always at least one, as there are more slots than elements.
+    //*********************************************************************
+    size_t next_empty_index(size_t index) const
+    {
+      index = (index + 1) & slot_mask;
+
+      while (true)
+      {
+        const mask_t empties = group_t(pcontrol + index).match_empty();
+
+        if (empties != 0)
+        {
+          return (index + group_t::index(empties)) & slot_mask;
+        }
+
+        index = (index + group_t::WIDTH) & slot_mask;
+      }
+    }
+
+    //*********************************************************************
+    /// Finds the next occupied slot after 'index', or the anchor if there is none.
+    /// Iteration runs from just after the anchor, which is always empty, round to
+    /// the anchor. No probe run crosses it, so erase only ever shifts elements
+    /// back towards the current position.
+    //*********************************************************************
+    size_t next_index(size_t index) const
+    {
+      do
+      {
+        index = (index + 1) & slot_mask;
+      } while ((index != anchor) && (pcontrol[index] == etl::private_flat_hash::CONTROL_EMPTY));
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Erases the element in a slot.
+    /// Following elements of the probe run are shifted back into the gap if
+    /// that does not move them before their home slot.
+    //*********************************************************************
+    void erase_index(size_t hole)
+    {
+      pslots[hole].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+      --current_size;
+
+      size_t index = hole;
+
+      while (true)
+      {
+        index = (index + 1) & slot_mask;
+
+        if (pcontrol[index] == etl::private_flat_hash::CONTROL_EMPTY)
+        {
+          break;
+        }
+
+        const size_t home = get_home(key_hash_function(pslots[index].first));
+
+        // Can it move back to the hole without passing its home?
+        if (((index - home) & slot_mask) >= ((index - hole) & slot_mask))
+        {
+          ::new (&pslots[hole]) value_type(pslots[index]);
+          pslots[index].~value_type();
+
+          set_control(hole, pcontrol[index]);
+          hole = index;
+        }
+      }
+
+      set_control(hole, etl::private_flat_hash::CONTROL_EMPTY);
+    }
+
+    // Disable copy construction.
+    iflat_unordered_map(const iflat_unordered_map&);
+
+    /// The control bytes, with copies of the first group width - 1 after the end.
+    uint8_t* pcontrol;
+
+    /// The slots.
+    value_type* pslots;
+
+    /// The number of slots.
+    const size_t number_of_slots;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// number_of_slots - 1.
+    const size_t slot_mask;
+
+    /// Shifts the mixed hash down to a slot index.
+    const size_t hash_shift;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// An empty slot that marks the start and end of iteration.
+    size_t anchor;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_UNORDERED_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_unordered_map()
+    {
+    }
+#else
+  protected:
+    ~iflat_unordered_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  /// The element order of equal maps may differ, so each key is looked up.
+  ///\param lhs Reference to the first flat_unordered_map.
+  ///\param rhs Reference to the second flat_unordered_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_unordered_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iflat_unordered_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    typedef typename etl::iflat_unordered_map<TKey, TMapped, THash, TKeyEqual>::const_iterator const_iterator;
+
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (const_iterator itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      const_iterator other = rhs.find(itr->first);
+
+      if ((other == rhs.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_unordered_map.
+  ///\param rhs Reference to the second flat_unordered_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_unordered_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iflat_unordered_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_unordered_map implementation that uses a fixed size buffer.
+  /// The number of slots is a power of two, sized so that the map is at most 7/8 full.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class flat_unordered_map : public etl::iflat_unordered_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iflat_unordered_map<TKey, TValue, THash, TKeyEqual> base;
+
+    // At least 8/7 of the maximum size, so there is always an empty slot.
+    static const size_t MIN_SLOTS = ((MAX_SIZE_ * 8) + 6) / 7;
+
+  public:
+
+    static const size_t MAX_SIZE        = MAX_SIZE_;
+    static const size_t NUMBER_OF_SLOTS = (MIN_SLOTS <= 16) ? 16 : size_t(etl::power_of_2_round_up<MIN_SLOTS>::value);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_unordered_map()
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), NUMBER_OF_SLOTS, MAX_SIZE_)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_unordered_map(const flat_unordered_map& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), NUMBER_OF_SLOTS, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_unordered_map(TIterator first_, TIterator last_)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), NUMBER_OF_SLOTS, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_unordered_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_unordered_map& operator = (const flat_unordered_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The control bytes.
+    uint8_t control[NUMBER_OF_SLOTS + etl::private_flat_hash::group::WIDTH - 1];
+
+    /// The slots.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * NUMBER_OF_SLOTS, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -57,19 +57,19 @@ namespace etl
   {
     typedef uint64_t value_type;
 
-    inline uint64_t initial() const
+    ETL_CONSTEXPR14 uint64_t initial() const
     {
       return OFFSET_BASIS;
     }
 
-    inline uint64_t add(uint64_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint64_t add(uint64_t hash, uint8_t value) const
     {
       hash *= PRIME;
       hash ^= value;
       return  hash;
     }
 
-    inline uint64_t final(uint64_t hash) const
+    ETL_CONSTEXPR14 uint64_t final(uint64_t hash) const
     {
       return hash;
     }
@@ -115,19 +115,19 @@ namespace etl
     {
     typedef uint64_t value_type;
 
-    inline uint64_t initial() const
+    ETL_CONSTEXPR14 uint64_t initial() const
       {
       return OFFSET_BASIS;
     }
 
-    inline uint64_t add(uint64_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint64_t add(uint64_t hash, uint8_t value) const
     {
       hash ^= value;
       hash *= PRIME;
       return hash;
     }
 
-    inline uint64_t final(uint64_t hash) const
+    ETL_CONSTEXPR14 uint64_t final(uint64_t hash) const
     {
       return hash;
     }
@@ -173,19 +173,19 @@ namespace etl
     {
     typedef uint32_t value_type;
       
-    inline uint32_t initial() const
+    ETL_CONSTEXPR14 uint32_t initial() const
       {
       return OFFSET_BASIS;
     }
 
-    inline uint32_t add(uint32_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(uint32_t hash, uint8_t value) const
     {
       hash *= PRIME;
       hash ^= value;
       return hash;
     }
 
-    inline uint32_t final(uint32_t hash) const
+    ETL_CONSTEXPR14 uint32_t final(uint32_t hash) const
     {
       return hash;
     }
@@ -231,19 +231,19 @@ namespace etl
     {
     typedef uint32_t value_type;
 
-    inline uint32_t initial() const
+    ETL_CONSTEXPR14 uint32_t initial() const
       {
       return OFFSET_BASIS;
     }
 
-    inline uint32_t add(uint32_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(uint32_t hash, uint8_t value) const
     {
       hash ^= value;
       hash *= PRIME;
       return hash;
     }
 
-    inline uint32_t final(uint32_t hash) const
+    ETL_CONSTEXPR14 uint32_t final(uint32_t hash) const
     {
       return hash;
     }
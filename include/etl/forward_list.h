@@ -34,6 +34,7 @@ SOFTWARE.
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include <stddef.h>
 
 #include "platform.h"
@@ -293,6 +294,9 @@ namespace etl
     typedef const T* const_pointer;
     typedef T&       reference;
     typedef const T& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&      rvalue_reference;
+#endif
     typedef size_t   size_type;
 
   protected:
@@ -635,7 +639,7 @@ namespace etl
     //*************************************************************************
     /// Pushes a value to the front of the forward_list.
     //*************************************************************************
-    void push_front(parameter_t value)
+    void push_front(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(forward_list_full));
@@ -645,6 +649,37 @@ namespace etl
       insert_node_after(start_node, data_node);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the front of the forward_list.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(forward_list_full));
+#endif
+
+      data_node_t& data_node = allocate_data_node(std::move(value));
+      insert_node_after(start_node, data_node);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the front of the list..
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(forward_list_full));
+#endif
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node_after(start_node, *p_data_node);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the front of the list..
     //*************************************************************************
@@ -704,6 +739,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
       insert_node_after(start_node, *p_data_node);
     }
+#endif
 
     //*************************************************************************
     /// Removes a value from the front of the forward_list.
@@ -771,7 +807,7 @@ namespace etl
     //*************************************************************************
     /// Inserts a value to the forward_list after the specified position.
     //*************************************************************************
-    iterator insert_after(iterator position, parameter_t value)
+    iterator insert_after(iterator position, const_reference value)
     {
       ETL_ASSERT(!full(), ETL_ERROR(forward_list_full));
 
@@ -781,6 +817,38 @@ namespace etl
       return iterator(data_node);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value in to the forward_list after the specified position.
+    //*************************************************************************
+    iterator insert_after(iterator position, rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(forward_list_full));
+
+      data_node_t& data_node = allocate_data_node(std::move(value));
+      insert_node_after(*position.p_node, data_node);
+
+      return iterator(data_node);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the forward_list after the specified position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace_after(iterator position, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(forward_list_full));
+
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node_after(*position.p_node, *p_data_node);
+
+      return iterator(*p_data_node);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the forward_list after the specified position.
     //*************************************************************************
@@ -844,6 +912,7 @@ namespace etl
 
       return iterator(*p_data_node);
     }
+#endif
 
     //*************************************************************************
     /// Inserts 'n' copies of a value to the forward_list after the specified position.
@@ -1225,6 +1294,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iforward_list& operator = (iforward_list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1265,6 +1349,32 @@ namespace etl
       start_node.next = nullptr;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements of another forward_list in to this one, leaving it empty.
+    /// The nodes live in each list's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(iforward_list&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(forward_list_full));
+
+      initialise();
+
+      node_t* p_last_node = &start_node;
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        data_node_t& data_node = allocate_data_node(std::move(*itr));
+        insert_node_after(*p_last_node, data_node);
+        p_last_node = &data_node;
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
     //*************************************************************************
@@ -1320,7 +1430,7 @@ namespace etl
     //*************************************************************************
     /// Allocate a data_node_t.
     //*************************************************************************
-    data_node_t& allocate_data_node(parameter_t value)
+    data_node_t& allocate_data_node(const_reference value)
     {
       data_node_t* p_node = p_node_pool->allocate<data_node_t>();
       ::new (&(p_node->value)) T(value);
@@ -1329,6 +1439,20 @@ namespace etl
       return *p_node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allocate a data_node_t, moving the value in to it.
+    //*************************************************************************
+    data_node_t& allocate_data_node(rvalue_reference value)
+    {
+      data_node_t* p_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_node->value)) T(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return *p_node;
+    }
+#endif
+
     //*************************************************************************
     /// Destroy a data_node_t.
     //*************************************************************************
@@ -1416,6 +1540,15 @@ namespace etl
     }
 
 #if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    forward_list(forward_list&& other)
+      : etl::iforward_list<T>(node_pool, MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+
     //*************************************************************************
     /// Construct from initializer_list.
     //*************************************************************************
@@ -1447,6 +1580,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    forward_list& operator = (forward_list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used in the list.
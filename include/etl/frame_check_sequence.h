@@ -28,6 +28,8 @@ SOFTWARE.
 #define __ETL_FRAME_CHECK_SEQUENCE__
 
 #include <stdint.h>
+#include <stddef.h>
+#include <iterator>
 
 #include "platform.h"
 #include "static_assert.h"
@@ -41,8 +43,35 @@ STATIC_ASSERT(ETL_8BIT_SUPPORT, "This file does not currently support targets wi
 
 namespace etl
 {
+  namespace private_frame_check_sequence
+  {
+    //*************************************************************************
+    /// Detects whether a policy, or one of its bases, has an 'add_block' member function.
+    /// value_type add_block(value_type, const uint8_t*, size_t) const
+    //*************************************************************************
+    template <typename TPolicy>
+    struct has_add_block
+    {
+    private:
+
+      typedef char yes[1];
+      typedef char no[2];
+
+      template <typename U>
+      static yes& test(char (*)[sizeof(&U::add_block)]);
+
+      template <typename U>
+      static no& test(...);
+
+    public:
+
+      static const bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
+  }
+
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
+  /// If the policy defines 'add_block' then it is used for ranges defined by pointers.
   ///\tparam TPolicy The type used to enact the policy.
   ///\ingroup frame_check_sequence
   //***************************************************************************
@@ -96,10 +125,10 @@ namespace etl
     {
       STATIC_ASSERT(sizeof(typename std::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin++);
-      }
+      typedef etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                           private_frame_check_sequence::has_add_block<policy_type>::value> use_block;
+
+      add_range(begin, end, use_block());
     }
 
     //*************************************************************************
@@ -128,6 +157,29 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range using the policy's block function.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(begin);
+
+      frame_check = policy.add_block(frame_check, p, static_cast<size_t>(end - begin));
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_FUNCTIONAL_INCLUDED
 
 #include "platform.h"
+#include "type_traits.h"
 
 ///\defgroup functional functional
 ///\ingroup utilities
@@ -105,6 +106,73 @@ namespace etl
   {
     return reference_wrapper<const T>(t.get());
   }
+
+  //***************************************************************************
+  /// Function object for equality comparison.
+  ///\ingroup functional
+  //***************************************************************************
+  template <typename T = void>
+  struct equal_to
+  {
+    bool operator ()(const T& lhs, const T& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
+  //***************************************************************************
+  /// Transparent equality comparison.
+  /// Compares any two types that have an operator ==.
+  ///\ingroup functional
+  //***************************************************************************
+  template <>
+  struct equal_to<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    bool operator ()(const T1& lhs, const T2& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
+  //***************************************************************************
+  /// Detects a nested 'is_transparent' type, which marks a hash or comparison
+  /// function object as accepting types other than the key type.
+  ///\ingroup functional
+  //***************************************************************************
+  template <typename T>
+  struct is_transparent
+  {
+  private:
+
+    typedef char yes[1];
+    typedef char no[2];
+
+    template <typename U>
+    static yes& test(typename U::is_transparent*);
+
+    template <typename U>
+    static no& test(...);
+
+  public:
+
+    static const bool value = (sizeof(test<T>(0)) == sizeof(yes));
+  };
+
+  namespace private_functional
+  {
+    //*************************************************************************
+    /// Defines 'type' as TReturn if both function objects are transparent.
+    /// TKey defers the check until a lookup with another key type is used.
+    //*************************************************************************
+    template <typename THash, typename TKeyEqual, typename TKey, typename TReturn>
+    struct enable_if_transparent
+      : public etl::enable_if<etl::is_transparent<THash>::value && etl::is_transparent<TKeyEqual>::value, TReturn>
+    {
+    };
+  }
 }
 
 #endif
@@ -37,7 +37,14 @@ SOFTWARE.
 #include "platform.h"
 
 // The default hash calculation.
+// Define ETL_HASH_USE_WYHASH to use wyhash in place of FNV-1a for strings and
+// the other types that are hashed as bytes.
 #include "fnv_1.h"
+
+#if defined(ETL_HASH_USE_WYHASH)
+  #include "wyhash.h"
+#endif
+
 #include "type_traits.h"
 #include "static_assert.h"
 
@@ -48,6 +55,45 @@ namespace etl
 {
   namespace private_hash
   {
+#if defined(ETL_HASH_USE_WYHASH)
+    //*************************************************************************
+    /// Hash to use when size_t is 16 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
+    generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = etl::wyhash(begin, end);
+      h ^= (h >> 32);
+
+      return static_cast<size_t>(h ^ (h >> 16));
+    }
+
+    //*************************************************************************
+    /// Hash to use when size_t is 32 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
+    generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = etl::wyhash(begin, end);
+
+      return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    //*************************************************************************
+    /// Hash to use when size_t is 64 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
+    generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return etl::wyhash(begin, end);
+    }
+#else
     //*************************************************************************
     /// Hash to use when size_t is 16 bits.
     /// T is always expected to be size_t.
@@ -82,6 +128,50 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+#endif
+
+    //*************************************************************************
+    /// Hash for text of character type T.
+    /// Accepts any text type with 'data()' and 'size()', such as
+    /// etl::ibasic_string and etl::basic_string_view, or a null terminated
+    /// string. The same characters give the same hash, whatever the type.
+    /// Transparent, so it may be used for heterogeneous lookup.
+    //*************************************************************************
+    template <typename T>
+    struct text_hash
+    {
+      typedef void is_transparent;
+
+      template <typename TText>
+      size_t operator ()(const TText& text) const
+      {
+        return hash(text.data(), text.data() + text.size());
+      }
+
+      size_t operator ()(const T* text) const
+      {
+        const T* end = text;
+
+        while (*end != 0)
+        {
+          ++end;
+        }
+
+        return hash(text, end);
+      }
+
+      size_t operator ()(T* text) const
+      {
+        return operator ()(const_cast<const T*>(text));
+      }
+
+    private:
+
+      static size_t hash(const T* begin, const T* end)
+      {
+        return generic_hash<size_t>(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+    };
   }
 
   //***************************************************************************
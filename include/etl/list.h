@@ -34,6 +34,7 @@ SOFTWARE.
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include <stddef.h>
 
 #include "platform.h"
@@ -335,6 +336,9 @@ namespace etl
     typedef const T* const_pointer;
     typedef T&       reference;
     typedef const T& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&      rvalue_reference;
+#endif
     typedef size_t   size_type;
 
   protected:
@@ -768,7 +772,7 @@ namespace etl
     //*************************************************************************
     /// Pushes a value to the front of the list.
     //*************************************************************************
-    void push_front(parameter_t value)
+    void push_front(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(list_full));
@@ -776,6 +780,35 @@ namespace etl
       insert_node(get_head(), allocate_data_node(value));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the front of the list.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      insert_node(get_head(), allocate_data_node(std::move(value)));
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the front of the list..
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node(get_head(), *p_data_node);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the front of the list..
     //*************************************************************************
@@ -835,6 +868,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
       insert_node(get_head(), *p_data_node);
     }
+#endif
 
     //*************************************************************************
     /// Removes a value from the front of the list.
@@ -859,7 +893,7 @@ namespace etl
     //*************************************************************************
     /// Pushes a value to the back of the list..
     //*************************************************************************
-    void push_back(parameter_t value)
+    void push_back(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(list_full));
@@ -867,6 +901,35 @@ namespace etl
       insert_node(terminal_node, allocate_data_node(value));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the back of the list..
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      insert_node(terminal_node, allocate_data_node(std::move(value)));
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the back of the list..
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node(terminal_node, *p_data_node);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the back of the list..
     //*************************************************************************
@@ -926,6 +989,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
       insert_node(terminal_node, *p_data_node);
     }
+#endif
 
     //*************************************************************************
     /// Removes a value from the back of the list.
@@ -952,6 +1016,38 @@ namespace etl
       return iterator(data_node);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value in to the list at the specified position.
+    //*************************************************************************
+    iterator insert(iterator position, rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+
+      data_node_t& data_node = allocate_data_node(std::move(value));
+      insert_node(*position.p_node, data_node);
+
+      return iterator(data_node);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the list at the specified position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(iterator position, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node(*position.p_node, *p_data_node);
+
+      return iterator(*p_data_node);
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the list at the specified position.
     //*************************************************************************
@@ -1015,6 +1111,7 @@ namespace etl
 
       return iterator(*p_data_node);
     }
+#endif
 
     //*************************************************************************
     /// Inserts 'n' copies of a value to the list at the specified position.
@@ -1434,6 +1531,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ilist& operator = (ilist&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1472,6 +1584,29 @@ namespace etl
       join(terminal_node, terminal_node);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements of another list in to this one, leaving it empty.
+    /// The nodes live in each list's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(ilist&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(list_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        insert_node(terminal_node, allocate_data_node(std::move(*itr)));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
     //*************************************************************************
@@ -1543,7 +1678,7 @@ namespace etl
     //*************************************************************************
     /// Allocate a data_node_t.
     //*************************************************************************
-    data_node_t& allocate_data_node(parameter_t value)
+    data_node_t& allocate_data_node(const_reference value)
     {
       data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
       ::new (&(p_data_node->value)) T(value);
@@ -1552,6 +1687,20 @@ namespace etl
       return *p_data_node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allocate a data_node_t, moving the value in to it.
+    //*************************************************************************
+    data_node_t& allocate_data_node(rvalue_reference value)
+    {
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return *p_data_node;
+    }
+#endif
+
     //*************************************************************************
     /// Destroy a data_node_t.
     //*************************************************************************
@@ -1656,6 +1805,15 @@ namespace etl
     }
 
 #if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    list(list&& other)
+      : etl::ilist<T>(node_pool, MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+
     //*************************************************************************
     /// Construct from initializer_list.
     //*************************************************************************
@@ -1679,6 +1837,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    list& operator = (list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used in the list.
@@ -36,6 +36,7 @@ SOFTWARE.
 #include <functional>
 #include <iterator>
 #include <algorithm>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -469,6 +470,9 @@ namespace etl
     typedef TKeyCompare                    key_compare;
     typedef value_type&                    reference;
     typedef const value_type&              const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&                   rvalue_reference;
+#endif
     typedef value_type*                    pointer;
     typedef const value_type*              const_pointer;
     typedef size_t                         size_type;
@@ -1159,6 +1163,82 @@ namespace etl
       return iterator(*this, inserted_node);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the map.
+    /// The value is left untouched if the key is already in the map.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      Node* found = find_node(root_node, value.first);
+
+      if (found)
+      {
+        return std::make_pair(iterator(*this, found), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = allocate_data_node(std::move(value));
+
+      return std::make_pair(iterator(*this, insert_node(root_node, node)), true);
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the map starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the map starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// If the key is already in the map the new value is discarded.
+    /// If asserts or exceptions are enabled, emits map_full if the map is full and the key is not in it.
+    ///\param args The arguments to construct the value_type from.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      if (full())
+      {
+        // There is no free node to build the value in, but the key may
+        // already be in the map, so look it up before asserting.
+        const value_type value(std::forward<Args>(args)...);
+        Node* found = find_node(root_node, value.first);
+
+        ETL_ASSERT(found != nullptr, ETL_ERROR(map_full));
+
+        return std::make_pair(iterator(*this, found), false);
+      }
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new (&node.value) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return std::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the map.
     /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
@@ -1233,6 +1313,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    imap& operator = (imap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1252,12 +1348,35 @@ namespace etl
       erase(begin(), end());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements of another map in to this one, leaving it empty.
+    /// The nodes live in each map's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(imap&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(map_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        insert_node(root_node, allocate_data_node(std::move(*itr)));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
-    Data_Node& allocate_data_node(value_type value)
+    Data_Node& allocate_data_node(const_reference value)
     {
       Data_Node& node = *p_node_pool->allocate<Data_Node>();
       ::new (&node.value) const value_type(value);
@@ -1265,6 +1384,19 @@ namespace etl
       return node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allocate a Data_Node, moving the value in to it.
+    //*************************************************************************
+    Data_Node& allocate_data_node(rvalue_reference value)
+    {
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new (&node.value) value_type(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+      return node;
+    }
+#endif
+
     //*************************************************************************
     /// Destroy a Data_Node.
     //*************************************************************************
@@ -2064,6 +2196,15 @@ namespace etl
     }
 
 #if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    map(map&& other)
+      : etl::imap<TKey, TValue, TCompare>(node_pool, MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+
     //*************************************************************************
     /// Constructor, from an initializer_list.
     //*************************************************************************
@@ -2096,6 +2237,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    map& operator = (map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used for the map.
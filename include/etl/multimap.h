@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -625,6 +626,9 @@ namespace etl
     typedef TKeyCompare                    key_compare;
     typedef value_type&                    reference;
     typedef const value_type&              const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&                   rvalue_reference;
+#endif
     typedef value_type*                    pointer;
     typedef const value_type*              const_pointer;
     typedef size_t                         size_type;
@@ -1252,6 +1256,63 @@ namespace etl
       return insert(value);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the multimap.
+    /// If asserts or exceptions are enabled, emits map_full if the multimap is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = allocate_data_node(std::move(value));
+
+      return iterator(*this, insert_node(root_node, node));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the multimap starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the multimap is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator /*position*/, rvalue_reference value)
+    {
+      // Ignore position provided and just do a normal insert
+      return insert(std::move(value));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the multimap starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the multimap is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      // Ignore position provided and just do a normal insert
+      return insert(std::move(value));
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// If asserts or exceptions are enabled, emits map_full if the multimap is already full.
+    ///\param args The arguments to construct the value_type from.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new (&node.value) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return iterator(*this, insert_node(root_node, node));
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the multimap.
     /// If asserts or exceptions are enabled, emits map_full if the multimap does not have enough free space.
@@ -1326,6 +1387,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    imultimap& operator = (imultimap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1345,12 +1422,35 @@ namespace etl
       erase(begin(), end());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements of another multimap in to this one, leaving it empty.
+    /// The nodes live in each multimap's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(imultimap&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(multimap_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        insert_node(root_node, allocate_data_node(std::move(*itr)));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
-    Data_Node& allocate_data_node(value_type value)
+    Data_Node& allocate_data_node(const_reference value)
     {
       Data_Node& node = *p_node_pool->allocate<Data_Node>();
       ::new (&node.value) const value_type(value);
@@ -1358,6 +1458,19 @@ namespace etl
       return node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allocate a Data_Node, moving the value in to it.
+    //*************************************************************************
+    Data_Node& allocate_data_node(rvalue_reference value)
+    {
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new (&node.value) value_type(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+      return node;
+    }
+#endif
+
     //*************************************************************************
     /// Destroy a Data_Node.
     //*************************************************************************
@@ -1957,6 +2070,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    multimap(multimap&& other)
+      : etl::imultimap<TKey, TValue, TCompare>(node_pool, MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -1981,6 +2103,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    multimap& operator = (multimap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used for the multimap.
@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 #include "platform.h"
 #include "parameter_type.h"
@@ -624,6 +625,9 @@ namespace etl
     typedef TCompare                       key_compare;
     typedef TCompare                       value_compare;
     typedef value_type&                    const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                            rvalue_reference;
+#endif
     typedef value_type*                    const_pointer;
     typedef size_t                         size_type;
 
@@ -653,6 +657,7 @@ namespace etl
 
     //*************************************************************************
     /// The data node element in the multiset.
+    /// The value is not const, so that a moved multiset can move it out.
     //*************************************************************************
     struct Data_Node : public Node
     {
@@ -661,7 +666,7 @@ namespace etl
       {
       }
 
-      value_type value;
+      T value;
     };
 
     /// Defines the key value parameter type
@@ -1233,6 +1238,63 @@ namespace etl
       return insert(value);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the multiset.
+    /// If asserts or exceptions are enabled, emits set_full if the multiset is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = allocate_data_node(std::move(value));
+
+      return iterator(*this, insert_node(root_node, node));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the multiset starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits set_full if the multiset is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator /*position*/, rvalue_reference value)
+    {
+      // Ignore position provided and just do a normal insert
+      return insert(std::move(value));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the multiset starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits set_full if the multiset is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      // Ignore position provided and just do a normal insert
+      return insert(std::move(value));
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multiset.
+    /// If asserts or exceptions are enabled, emits set_full if the multiset is already full.
+    ///\param args The arguments to construct the value from.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multiset_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return iterator(*this, insert_node(root_node, node));
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the multiset.
     /// If asserts or exceptions are enabled, emits set_full if the multiset does not have enough free space.
@@ -1307,6 +1369,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    imultiset& operator = (imultiset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1326,19 +1404,59 @@ namespace etl
       erase(begin(), end());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements of another multiset in to this one, leaving it empty.
+    /// The nodes live in each multiset's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(imultiset&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(multiset_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        insert_node(root_node, allocate_data_node(std::move(data_cast(itr.p_node)->value)));
+        ++itr;
+      }
+
+      // The moved from values may no longer be comparable, so the nodes
+      // are released by walking the tree rather than by erasing each key.
+      rhs.destroy_nodes(rhs.root_node);
+      rhs.root_node = nullptr;
+      rhs.current_size = 0;
+    }
+#endif
+
   private:
 
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
-    Data_Node& allocate_data_node(value_type value)
+    Data_Node& allocate_data_node(const_reference value)
     {
       Data_Node& node = *p_node_pool->allocate<Data_Node>();
-      ::new ((void*)&node.value) value_type(value);
+      ::new ((void*)&node.value) T(value);
       ETL_INCREMENT_DEBUG_COUNT;
       return node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allocate a Data_Node, moving the value in to it.
+    //*************************************************************************
+    Data_Node& allocate_data_node(rvalue_reference value)
+    {
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) T(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+      return node;
+    }
+#endif
+
     //*************************************************************************
     /// Destroy a Data_Node.
     //*************************************************************************
@@ -1349,6 +1467,21 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Destroy the Data_Node at position and all of the nodes below it.
+    //*************************************************************************
+    void destroy_nodes(Node* position)
+    {
+      if (position)
+      {
+        destroy_nodes(position->children[kLeft]);
+        destroy_nodes(position->children[kRight]);
+        destroy_data_node(*data_cast(position));
+      }
+    }
+#endif
+
     //*************************************************************************
     /// Count the nodes that match the key provided
     //*************************************************************************
@@ -1937,6 +2070,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    multiset(multiset&& other)
+      : etl::imultiset<T, TCompare>(node_pool, MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -1961,6 +2103,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    multiset& operator = (multiset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used for the multiset.
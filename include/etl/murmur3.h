@@ -32,11 +32,16 @@ SOFTWARE.
 #define ETL_MURMUR3_INCLUDED
 
 #include <stdint.h>
+#include <stddef.h>
+#include <iterator>
 
 #include "platform.h"
 #include "ihash.h"
 #include "binary.h"
+#include "array.h"
+#include "type_traits.h"
 #include "error_handler.h"
+#include "private/hash_mix.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -47,6 +52,27 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace private_murmur3
+  {
+    //*************************************************************************
+    /// Reads a little endian 32 bit word from any alignment.
+    /// Compilers reduce this to a single load on little endian targets.
+    //*************************************************************************
+    inline uint32_t read_le_32(const uint8_t* data)
+    {
+      return  uint32_t(data[0])         | (uint32_t(data[1]) << 8U) |
+             (uint32_t(data[2]) << 16U) | (uint32_t(data[3]) << 24U);
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit word from any alignment.
+    //*************************************************************************
+    inline uint64_t read_le_64(const uint8_t* data)
+    {
+      return uint64_t(read_le_32(data)) | (uint64_t(read_le_32(data + 4U)) << 32U);
+    }
+  }
+
   //***************************************************************************
   /// Calculates the murmur3 hash.
   /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
@@ -81,22 +107,8 @@ namespace etl
     murmur3(TIterator begin, const TIterator end, value_type seed_ = 0)
       : seed(seed_)
     {
-      STATIC_ASSERT(sizeof(typename std::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
-
       reset();
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -122,19 +134,7 @@ namespace etl
       STATIC_ASSERT(sizeof(typename std::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, typename etl::is_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -147,7 +147,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8);
+      block |= value_type(value_) << (block_fill_count * 8);
 
       if (++block_fill_count == FULL_BLOCK)
       {
@@ -178,6 +178,52 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    /// Completes any partial block a byte at a time, then reads whole words.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* data   = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = static_cast<size_t>(end - begin);
+
+      while ((block_fill_count != 0) && (length != 0))
+      {
+        add(*data++);
+        --length;
+      }
+
+      char_count += length & ~size_t(FULL_BLOCK - 1);
+
+      while (length >= FULL_BLOCK)
+      {
+        block = private_murmur3::read_le_32(data);
+        add_block();
+        block = 0;
+
+        data   += FULL_BLOCK;
+        length -= FULL_BLOCK;
+      }
+
+      while (length-- != 0)
+      {
+        add(*data++);
+      }
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -230,6 +276,253 @@ namespace etl
     static const value_type MULTIPLY   = 5;
     static const value_type ADD        = 0xE6546B64;
   };
+
+  //***************************************************************************
+  /// Calculates the 128 bit MurmurHash3_x64_128 hash.
+  /// The value is the two 64 bit halves, h1 then h2, as in the reference
+  /// implementation.
+  /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128
+  {
+  public:
+
+    typedef etl::array<uint64_t, 2> value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x64_128(uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      hash[0]          = seed;
+      hash[1]          = seed;
+      char_count       = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      STATIC_ASSERT(sizeof(typename std::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, typename etl::is_pointer<TIterator>::type());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      block[block_fill_count] = value_;
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(block);
+        block_fill_count = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    /// Completes any partial block a byte at a time, then reads whole blocks
+    /// directly from the range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* data   = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = static_cast<size_t>(end - begin);
+
+      while ((block_fill_count != 0) && (length != 0))
+      {
+        add(*data++);
+        --length;
+      }
+
+      char_count += length & ~size_t(FULL_BLOCK - 1);
+
+      while (length >= FULL_BLOCK)
+      {
+        add_block(data);
+
+        data   += FULL_BLOCK;
+        length -= FULL_BLOCK;
+      }
+
+      while (length-- != 0)
+      {
+        add(*data++);
+      }
+    }
+
+    //*************************************************************************
+    /// Mixes the first half of a block.
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= CONSTANT1;
+      k1 = rotate_left(k1, 31);
+      k1 *= CONSTANT2;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    /// Mixes the second half of a block.
+    //*************************************************************************
+    static uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= CONSTANT2;
+      k2 = rotate_left(k2, 33);
+      k2 *= CONSTANT1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block(const uint8_t* data)
+    {
+      uint64_t& h1 = hash[0];
+      uint64_t& h2 = hash[1];
+
+      h1 ^= mix_k1(private_murmur3::read_le_64(data));
+      h1 = rotate_left(h1, 27);
+      h1 += h2;
+      h1 = (h1 * 5) + 0x52DCE729;
+
+      h2 ^= mix_k2(private_murmur3::read_le_64(data + 8));
+      h2 = rotate_left(h2, 31);
+      h2 += h1;
+      h2 = (h2 * 5) + 0x38495AB5;
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        uint64_t& h1 = hash[0];
+        uint64_t& h2 = hash[1];
+
+        // The tail, if any.
+        if (block_fill_count != 0)
+        {
+          uint8_t tail[FULL_BLOCK] = { 0 };
+
+          for (size_t i = 0; i < block_fill_count; ++i)
+          {
+            tail[i] = block[i];
+          }
+
+          if (block_fill_count > 8)
+          {
+            h2 ^= mix_k2(private_murmur3::read_le_64(tail + 8));
+          }
+
+          h1 ^= mix_k1(private_murmur3::read_le_64(tail));
+        }
+
+        h1 ^= uint64_t(char_count);
+        h2 ^= uint64_t(char_count);
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = etl::private_hash::fmix_64(h1);
+        h2 = etl::private_hash::fmix_64(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        is_finalised = true;
+      }
+    }
+
+    static const uint8_t  FULL_BLOCK = 16;
+    static const uint64_t CONSTANT1  = 0x87C37B91114253D5ULL;
+    static const uint64_t CONSTANT2  = 0x4CF5AD432745937FULL;
+
+    bool       is_finalised;
+    uint8_t    block_fill_count;
+    size_t     char_count;
+    uint8_t    block[FULL_BLOCK];
+    value_type hash;
+    uint32_t   seed;
+  };
 }
 
 #endif
@@ -31,6 +31,8 @@ SOFTWARE.
 #ifndef ETL_OPTIONAL_INCLUDED
 #define ETL_OPTIONAL_INCLUDED
 
+#include <utility>
+
 #include "platform.h"
 #include "alignment.h"
 #include "type_traits.h"
@@ -134,6 +136,20 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Move constructor.
+    //***************************************************************************
+    optional(optional&& other)
+      : valid(bool(other))
+    {
+      if (valid)
+      {
+       ::new (storage.template get_address<T>()) T(std::move(other.value()));
+      }
+    }
+#endif
+
     //***************************************************************************
     /// Constructor from value type.
     //***************************************************************************
@@ -143,6 +159,17 @@ namespace etl
       valid = true;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Constructor from a moved value type.
+    //***************************************************************************
+    optional(T&& value_)
+    {
+     ::new (storage.template get_address<T>()) T(std::move(value_));
+      valid = true;
+    }
+#endif
+
     //***************************************************************************
     /// Destructor.
     //***************************************************************************
@@ -197,6 +224,37 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Move assignment operator from optional.
+    //***************************************************************************
+    optional& operator =(optional&& other)
+    {
+      if (this != &other)
+      {
+        if (valid && !bool(other))
+        {
+          storage.template get_reference<T>().~T();
+          valid = false;
+        }
+        else if (bool(other))
+        {
+          if (valid)
+          {
+            storage.template get_reference<T>() = std::move(other.value());
+          }
+          else
+          {
+           ::new (storage.template get_address<T>()) T(std::move(other.value()));
+            valid = true;
+          }
+        }
+      }
+
+      return *this;
+    }
+#endif
+
     //***************************************************************************
     /// Assignment operator from value type.
     //***************************************************************************
@@ -215,6 +273,26 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Assignment operator from a moved value type.
+    //***************************************************************************
+    optional& operator =(T&& value_)
+    {
+      if (valid)
+      {
+        storage.template get_reference<T>() = std::move(value_);
+      }
+      else
+      {
+       ::new (storage.template get_address<T>()) T(std::move(value_));
+        valid = true;
+      }
+
+      return *this;
+    }
+#endif
+
     //***************************************************************************
     /// Pointer operator.
     //***************************************************************************
@@ -308,11 +386,33 @@ namespace etl
     //***************************************************************************
     void swap(optional& other)
     {
+#if ETL_CPP11_SUPPORTED
+      optional temp(std::move(*this));
+      *this = std::move(other);
+      other = std::move(temp);
+#else
       optional temp(*this);
       *this = other;
       other = temp;
+#endif
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Constructs the value in place, destroying any previous value.
+    //***************************************************************************
+    template <typename ... Args>
+    T& emplace(Args && ... args)
+    {
+      reset();
+
+     ::new (storage.template get_address<T>()) T(std::forward<Args>(args)...);
+      valid = true;
+
+      return storage.template get_reference<T>();
+    }
+#endif
+
     //***************************************************************************
     /// Reset back to invalid.
     //***************************************************************************
@@ -77,6 +77,12 @@ SOFTWARE.
   #define ETL_CONSTEXPR
 #endif
 
+#if ETL_CPP14_SUPPORTED
+  #define ETL_CONSTEXPR14 constexpr
+#else
+  #define ETL_CONSTEXPR14
+#endif
+
 #if ETL_CPP17_SUPPORTED
   #define ETL_IF_CONSTEXPR constexpr
 #else
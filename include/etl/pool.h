@@ -134,6 +134,68 @@ namespace etl
       return reinterpret_cast<T*>(allocate_item());
     }
 
+    //*************************************************************************
+    /// Allocate storage for 'n' objects from the pool.
+    /// Either all or none are allocated.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    ///\param o_begin The output iterator for the pointers to the storage.
+    ///\param n       The number of objects.
+    ///\return An iterator to one past the last pointer written.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    TOutputIterator allocate_n(TOutputIterator o_begin, size_t n)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      if (n <= available())
+      {
+        while (n-- != 0)
+        {
+          *o_begin++ = reinterpret_cast<T*>(allocate_item());
+        }
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
+
+      return o_begin;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// Takes as many as are free, up to 'n'. Taking fewer is not an error.
+    ///\param o_begin The output iterator for the pointers to the storage.
+    ///\param n       The maximum number of objects.
+    ///\return An iterator to one past the last pointer written.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    TOutputIterator allocate_up_to(TOutputIterator o_begin, size_t n)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      const size_t n_free = available();
+
+      if (n > n_free)
+      {
+        n = n_free;
+      }
+
+      while (n-- != 0)
+      {
+        *o_begin++ = reinterpret_cast<T*>(allocate_item());
+      }
+
+      return o_begin;
+    }
+
 #if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
     //*************************************************************************
     /// Allocate storage for an object from the pool and create default.
@@ -270,6 +332,33 @@ namespace etl
       release_item((char*)p_object);
     }
 
+    //*************************************************************************
+    /// Release a range of objects in the pool.
+    /// Either all or none are released.
+    /// If asserts or exceptions are enabled and any object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    ///\param first The iterator to the first pointer to an object.
+    ///\param last  The iterator to one past the last pointer to an object.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_n(TIterator first, TIterator last)
+    {
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        if (!is_item_in_pool((const char*)(*itr)))
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+          return;
+        }
+      }
+
+      while (first != last)
+      {
+        release_item((char*)(*first));
+        ++first;
+      }
+    }
+
     //*************************************************************************
     /// Release all objects in the pool.
     //*************************************************************************
@@ -499,6 +588,34 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for 'n' objects from the pool.
+    /// Either all or none are allocated.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_n(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool::allocate_n<U>(o_begin, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// Takes as many as are free, up to 'n'.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_up_to(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool::allocate_up_to<U>(o_begin, n);
+    }
+
 #if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -650,6 +767,34 @@ namespace etl
       return base_t::template allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for 'n' objects from the pool.
+    /// Either all or none are allocated.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_n(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return base_t::template allocate_n<U>(o_begin, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// Takes as many as are free, up to 'n'.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    TOutputIterator allocate_up_to(TOutputIterator o_begin, size_t n)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return base_t::template allocate_up_to<U>(o_begin, n);
+    }
+
 #if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
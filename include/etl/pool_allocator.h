@@ -0,0 +1,349 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_ALLOCATOR_INCLUDED
+#define ETL_POOL_ALLOCATOR_INCLUDED
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "pool.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include <utility>
+#endif
+
+#if (__cplusplus >= 201703L) && defined(__has_include)
+  #if __has_include(<memory_resource>)
+    #include <memory_resource>
+    #define ETL_POOL_MEMORY_RESOURCE_SUPPORTED 1
+  #endif
+#endif
+
+#if !defined(ETL_POOL_MEMORY_RESOURCE_SUPPORTED)
+  #define ETL_POOL_MEMORY_RESOURCE_SUPPORTED 0
+#endif
+
+//*****************************************************************************
+///\defgroup pool_allocator pool_allocator
+/// Adapters that let standard containers take their nodes from ETL pools.
+///\ingroup pool
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A standard allocator that takes single objects from a generic_pool.
+  /// Node based containers rebind the allocator to their node type, so each
+  /// node type gets a pool of SIZE_ nodes, shared by every container that
+  /// uses the same node type and size. The allocator is stateless and all
+  /// instances compare equal.
+  /// Requests for more than one object, such as the bucket array of an
+  /// std::unordered_map, are passed to ::operator new.
+  /// If asserts or exceptions are enabled and the pool is empty an
+  /// etl::pool_no_allocation is thrown. Otherwise std::bad_alloc is thrown,
+  /// or abort() is called if the compiler has exceptions disabled.
+  /// The pool is a static shared by every instance and is not thread safe.
+  /// Containers that use the same node type and size must not allocate or
+  /// free from different threads without external locking.
+  ///\tparam T     The type to allocate.
+  ///\tparam SIZE_ The number of objects in the pool.
+  ///\ingroup pool_allocator
+  //***************************************************************************
+  template <typename T, const size_t SIZE_>
+  class pool_allocator
+  {
+  public:
+
+    typedef T         value_type;
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    typedef etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_> pool_type;
+
+    static const size_t SIZE = SIZE_;
+
+    template <typename U>
+    struct rebind
+    {
+      typedef pool_allocator<U, SIZE_> other;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    pool_allocator()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from an allocator for another type.
+    //*************************************************************************
+    template <typename U>
+    pool_allocator(const pool_allocator<U, SIZE_>&)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates storage for 'n' objects.
+    //*************************************************************************
+    pointer allocate(size_type n, const void* = 0)
+    {
+      if (n == 1)
+      {
+        pointer p = get_pool().template allocate<T>();
+
+        // An allocator may not return null, so an empty pool must fail here
+        // when the pool's own checks are disabled.
+        if (p == nullptr)
+        {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+          throw std::bad_alloc();
+#else
+          abort();
+#endif
+        }
+
+        return p;
+      }
+      else
+      {
+        return static_cast<pointer>(::operator new(n * sizeof(T)));
+      }
+    }
+
+    //*************************************************************************
+    /// Frees the storage for 'n' objects.
+    //*************************************************************************
+    void deallocate(pointer p, size_type n)
+    {
+      if (n == 1)
+      {
+        get_pool().release(p);
+      }
+      else
+      {
+        ::operator delete(p);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Constructs an object in allocated storage.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+      ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    //*************************************************************************
+    /// Destroys an object in allocated storage.
+    //*************************************************************************
+    template <typename U>
+    void destroy(U* p)
+    {
+      p->~U();
+    }
+#else
+    //*************************************************************************
+    /// Constructs an object in allocated storage.
+    //*************************************************************************
+    void construct(pointer p, const_reference value)
+    {
+      ::new (static_cast<void*>(p)) T(value);
+    }
+
+    //*************************************************************************
+    /// Destroys an object in allocated storage.
+    //*************************************************************************
+    void destroy(pointer p)
+    {
+      p->~T();
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the address of an object.
+    //*************************************************************************
+    pointer address(reference value) const
+    {
+      return &value;
+    }
+
+    //*************************************************************************
+    /// Gets the address of an object.
+    //*************************************************************************
+    const_pointer address(const_reference value) const
+    {
+      return &value;
+    }
+
+    //*************************************************************************
+    /// The largest number of objects that may be requested.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return size_type(-1) / sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Gets the pool shared by all allocators of this type.
+    //*************************************************************************
+    static pool_type& get_pool()
+    {
+      static pool_type pool;
+
+      return pool;
+    }
+  };
+
+  //***************************************************************************
+  /// Pool allocators are stateless, so always compare equal.
+  //***************************************************************************
+  template <typename T1, typename T2, const size_t SIZE_>
+  bool operator ==(const etl::pool_allocator<T1, SIZE_>&, const etl::pool_allocator<T2, SIZE_>&)
+  {
+    return true;
+  }
+
+  //***************************************************************************
+  /// Pool allocators are stateless, so always compare equal.
+  //***************************************************************************
+  template <typename T1, typename T2, const size_t SIZE_>
+  bool operator !=(const etl::pool_allocator<T1, SIZE_>&, const etl::pool_allocator<T2, SIZE_>&)
+  {
+    return false;
+  }
+
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+  //***************************************************************************
+  /// A memory resource for std::pmr containers, backed by a generic_pool.
+  /// Requests that fit the pool's items are served from the pool while it has
+  /// free items. Everything else goes to the upstream resource. Use
+  /// std::pmr::null_memory_resource() as the upstream to forbid the fallback.
+  ///\tparam TYPE_SIZE_ The size of the pool's items.
+  ///\tparam ALIGNMENT_ The alignment of the pool's items.
+  ///\tparam SIZE_      The number of items in the pool.
+  ///\ingroup pool_allocator
+  //***************************************************************************
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_>
+  class pool_memory_resource : public std::pmr::memory_resource
+  {
+  public:
+
+    typedef etl::generic_pool<TYPE_SIZE_, ALIGNMENT_, SIZE_> pool_type;
+
+    static const size_t SIZE      = SIZE_;
+    static const size_t ALIGNMENT = ALIGNMENT_;
+    static const size_t TYPE_SIZE = TYPE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param upstream_ The resource for requests that the pool cannot serve.
+    //*************************************************************************
+    explicit pool_memory_resource(std::pmr::memory_resource* upstream_ = std::pmr::get_default_resource())
+      : upstream(upstream_)
+    {
+    }
+
+    pool_memory_resource(const pool_memory_resource&) = delete;
+    pool_memory_resource& operator =(const pool_memory_resource&) = delete;
+
+    //*************************************************************************
+    /// Gets the pool.
+    //*************************************************************************
+    const pool_type& get_pool() const
+    {
+      return pool;
+    }
+
+    //*************************************************************************
+    /// Gets the upstream resource.
+    //*************************************************************************
+    std::pmr::memory_resource* upstream_resource() const
+    {
+      return upstream;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocates from the pool if the request fits, otherwise from upstream.
+    //*************************************************************************
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+      if ((bytes <= TYPE_SIZE_) && (alignment <= ALIGNMENT_) && !pool.full())
+      {
+        return pool.template allocate<char>();
+      }
+      else
+      {
+        return upstream->allocate(bytes, alignment);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the memory to wherever it came from.
+    //*************************************************************************
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+      if (pool.is_in_pool(p))
+      {
+        pool.release(p);
+      }
+      else
+      {
+        upstream->deallocate(p, bytes, alignment);
+      }
+    }
+
+    //*************************************************************************
+    /// Only the same resource can free another's memory.
+    //*************************************************************************
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+      return this == &other;
+    }
+
+    pool_type                  pool;     ///< The pool for small requests.
+    std::pmr::memory_resource* upstream; ///< The resource for everything else.
+  };
+#endif
+}
+
+#endif
@@ -0,0 +1,438 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_CACHE_INCLUDED
+#define ETL_POOL_CACHE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "pool.h"
+
+#undef ETL_FILE
+#define ETL_FILE "56"
+
+//*****************************************************************************
+///\defgroup pool_cache pool_cache
+/// A small cache of free items in front of a shared pool.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The default access type for pool_cache.
+  /// Does no locking, for backing pools that are thread safe, such as
+  /// etl::atomic_pool, or are not shared.
+  ///\ingroup pool_cache
+  //***************************************************************************
+  struct pool_cache_no_lock
+  {
+    static void lock()
+    {
+    }
+
+    static void unlock()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A magazine of free items taken from a shared pool.
+  /// Items are taken from, and returned to, the backing pool in batches of
+  /// half the magazine, so most allocations and releases do not touch the
+  /// shared pool at all.
+  /// Each thread should have its own pool_cache; a pool_cache is not thread
+  /// safe. The batch transfers are guarded by TAccess::lock() and
+  /// TAccess::unlock().
+  /// Items allocated from one cache may be released to another cache of the
+  /// same pool.
+  ///\tparam T              The largest type that will be allocated.
+  ///\tparam MAGAZINE_SIZE_ The number of free items that may be cached.
+  ///\tparam TPool          The backing pool type. etl::ipool or etl::iatomic_pool.
+  ///\tparam TAccess        The type with static lock and unlock functions that guard the backing pool.
+  ///\ingroup pool_cache
+  //***************************************************************************
+  template <typename T, const size_t MAGAZINE_SIZE_, typename TPool = etl::ipool, typename TAccess = etl::pool_cache_no_lock>
+  class pool_cache
+  {
+  public:
+
+    static const size_t MAGAZINE_SIZE = MAGAZINE_SIZE_;
+    static const size_t BATCH_SIZE    = (MAGAZINE_SIZE_ + 1) / 2;
+    static const size_t ALIGNMENT     = etl::alignment_of<T>::value;
+    static const size_t TYPE_SIZE     = sizeof(T);
+
+    STATIC_ASSERT(MAGAZINE_SIZE_ > 0, "Zero size magazine");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit pool_cache(TPool& pool_)
+      : pool(pool_),
+        count(0),
+        n_hits(0),
+        n_misses(0),
+        n_refills(0),
+        n_drains(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns the cached items to the pool.
+    //*************************************************************************
+    ~pool_cache()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return reinterpret_cast<U*>(allocate_item());
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(std::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object to the cache.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      if (pool.is_in_pool(p_object))
+      {
+        if (count == MAGAZINE_SIZE)
+        {
+          drain();
+        }
+
+        magazine[count++] = const_cast<void*>(p_object);
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+      }
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      if (count > 0)
+      {
+        TAccess::lock();
+        pool.release_n(magazine, magazine + count);
+        TAccess::unlock();
+
+        count = 0;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items held by the cache.
+    //*************************************************************************
+    size_t cached() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the backing pool.
+    //*************************************************************************
+    TPool& get_pool() const
+    {
+      return pool;
+    }
+
+    //*************************************************************************
+    /// The number of allocations served from the cache.
+    //*************************************************************************
+    size_t hits() const
+    {
+      return n_hits;
+    }
+
+    //*************************************************************************
+    /// The number of allocations that found the cache empty.
+    //*************************************************************************
+    size_t misses() const
+    {
+      return n_misses;
+    }
+
+    //*************************************************************************
+    /// The number of batches taken from the pool.
+    //*************************************************************************
+    size_t refills() const
+    {
+      return n_refills;
+    }
+
+    //*************************************************************************
+    /// The number of batches returned to the pool when the cache was full.
+    //*************************************************************************
+    size_t drains() const
+    {
+      return n_drains;
+    }
+
+    //*************************************************************************
+    /// Clears the hit, miss, refill and drain counts.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      n_hits    = 0;
+      n_misses  = 0;
+      n_refills = 0;
+      n_drains  = 0;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item from the cache, refilling it if empty.
+    //*************************************************************************
+    void* allocate_item()
+    {
+      if (count == 0)
+      {
+        ++n_misses;
+        refill();
+
+        if (count == 0)
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+          return nullptr;
+        }
+      }
+      else
+      {
+        ++n_hits;
+      }
+
+      return magazine[--count];
+    }
+
+    //*************************************************************************
+    /// Takes a batch of items from the pool.
+    /// Takes fewer if the pool is nearly exhausted. The pool decides how many
+    /// it can give in the same step that takes them, so another thread taking
+    /// items in the meantime cannot make the refill fail.
+    //*************************************************************************
+    void refill()
+    {
+      TAccess::lock();
+      void** p_end = pool.template allocate_up_to<T>(magazine, BATCH_SIZE);
+      TAccess::unlock();
+
+      count = size_t(p_end - magazine);
+
+      if (count > 0)
+      {
+        ++n_refills;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the least recently released batch of items to the pool.
+    //*************************************************************************
+    void drain()
+    {
+      TAccess::lock();
+      pool.release_n(magazine, magazine + BATCH_SIZE);
+      TAccess::unlock();
+
+      for (size_t i = BATCH_SIZE; i < count; ++i)
+      {
+        magazine[i - BATCH_SIZE] = magazine[i];
+      }
+
+      count -= BATCH_SIZE;
+      ++n_drains;
+    }
+
+    // Should not be copied.
+    pool_cache(const pool_cache&);
+    pool_cache& operator =(const pool_cache&);
+
+    TPool& pool;                    ///< The backing pool.
+    void*  magazine[MAGAZINE_SIZE]; ///< The cached free items. The most recently released is last.
+    size_t count;                   ///< The number of cached free items.
+
+    size_t n_hits;    ///< Allocations served from the cache.
+    size_t n_misses;  ///< Allocations that found the cache empty.
+    size_t n_refills; ///< Batches taken from the pool.
+    size_t n_drains;  ///< Batches returned to the pool.
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <stddef.h>
 #include <functional>
 #include <algorithm>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -123,6 +124,9 @@ namespace etl
     typedef TCompare              compare_type;       ///< The comparison type.
     typedef T&                    reference;          ///< A reference to the type used in the queue.
     typedef const T&              const_reference;    ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                   rvalue_reference;   ///< An rvalue reference to the type used in the queue.
+#endif
     typedef typename TContainer::size_type size_type; ///< The type used for determining the size of the queue.
     typedef typename std::iterator_traits<typename TContainer::iterator>::difference_type difference_type;
 
@@ -156,7 +160,7 @@ namespace etl
     /// is the priority queue is already full.
     ///\param value The value to push to the queue.
     //*************************************************************************
-    void push(parameter_t value)
+    void push(const_reference value)
     {
       ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
 
@@ -166,6 +170,42 @@ namespace etl
       std::push_heap(container.begin(), container.end(), TCompare());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
+
+      // Put element at end
+      container.push_back(std::move(value));
+      // Make elements in container into heap
+      std::push_heap(container.begin(), container.end(), TCompare());
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param args The arguments to construct the value from.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
+
+      // Put element at end
+      container.emplace_back(std::forward<Args>(args)...);
+      // Make elements in container into heap
+      std::push_heap(container.begin(), container.end(), TCompare());
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the queue.
     /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
@@ -233,6 +273,7 @@ namespace etl
       // Make elements in container into heap
       std::push_heap(container.begin(), container.end(), TCompare());
     }
+#endif
 
     //*************************************************************************
     /// Assigns values to the priority queue.
@@ -340,6 +381,18 @@ namespace etl
       assign(other.container.cbegin(), other.container.cend());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Make this a clone of the supplied priority queue, moving its values
+    /// and leaving it empty.
+    /// The values are already a heap, so the container is moved as it is.
+    //*************************************************************************
+    void move_clone(ipriority_queue&& other)
+    {
+      container = std::move(other.container);
+    }
+#endif
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -387,6 +440,17 @@ namespace etl
       etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor
+    //*************************************************************************
+    priority_queue(priority_queue&& rhs)
+      : etl::ipriority_queue<T, TContainer, TCompare>()
+    {
+      etl::ipriority_queue<T, TContainer, TCompare>::move_clone(std::move(rhs));
+    }
+#endif
+
     //*************************************************************************
     /// Constructor, from an iterator range.
     ///\tparam TIterator The iterator type.
@@ -420,6 +484,21 @@ namespace etl
 
       return *this;
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    priority_queue& operator = (priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::ipriority_queue<T, TContainer, TCompare>::move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
   };
 }
 
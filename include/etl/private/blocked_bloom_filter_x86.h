@@ -0,0 +1,110 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BLOCKED_BLOOM_FILTER_X86_INCLUDED
+#define ETL_BLOCKED_BLOOM_FILTER_X86_INCLUDED
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "../platform.h"
+
+// GCC and Clang need the instruction set enabling per function.
+#if defined(__GNUC__)
+  #define ETL_BLOOM_FILTER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+  #define ETL_BLOOM_FILTER_TARGET_AVX2
+#endif
+
+namespace etl
+{
+  namespace private_blocked_bloom_filter
+  {
+    //*************************************************************************
+    /// Block operations for x86 targets, for when the compiler does not
+    /// target AVX2. Uses AVX2 if a CPUID check shows that it is available,
+    /// otherwise the scalar code.
+    /// Defined in src/blocked_bloom_filter_x86.cpp
+    //*************************************************************************
+    void set_block_x86(uint64_t* block, uint32_t key);
+    bool test_block_x86(const uint64_t* block, uint32_t key);
+
+    //*************************************************************************
+    /// Builds the eight 64 bit lane masks for a key in two AVX2 registers.
+    /// Each lane gets the bit selected by the top six bits of key * salt.
+    //*************************************************************************
+    ETL_BLOOM_FILTER_TARGET_AVX2
+    inline void make_mask_avx2(uint32_t key, __m256i& mask_low, __m256i& mask_high)
+    {
+      const __m256i salt = _mm256_setr_epi32(int(0x47B6137BUL), int(0x44974D91UL), int(0x8824AD5BUL), int(0xA2B7289DUL),
+                                             int(0x705495C7UL), int(0x2DF1424BUL), int(0x9EFC4947UL), int(0x5C6BFB31UL));
+
+      const __m256i bits = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(int(key)), salt), 26);
+      const __m256i one  = _mm256_set1_epi64x(1);
+
+      mask_low  = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(bits)));
+      mask_high = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(bits, 1)));
+    }
+
+    //*************************************************************************
+    /// Sets the key's bits in a 64 byte aligned block.
+    //*************************************************************************
+    ETL_BLOOM_FILTER_TARGET_AVX2
+    inline void set_block_avx2(uint64_t* block, uint32_t key)
+    {
+      __m256i mask_low;
+      __m256i mask_high;
+      make_mask_avx2(key, mask_low, mask_high);
+
+      __m256i* p = reinterpret_cast<__m256i*>(block);
+
+      _mm256_store_si256(p,     _mm256_or_si256(_mm256_load_si256(p),     mask_low));
+      _mm256_store_si256(p + 1, _mm256_or_si256(_mm256_load_si256(p + 1), mask_high));
+    }
+
+    //*************************************************************************
+    /// Tests the key's bits in a 64 byte aligned block.
+    //*************************************************************************
+    ETL_BLOOM_FILTER_TARGET_AVX2
+    inline bool test_block_avx2(const uint64_t* block, uint32_t key)
+    {
+      __m256i mask_low;
+      __m256i mask_high;
+      make_mask_avx2(key, mask_low, mask_high);
+
+      const __m256i* p = reinterpret_cast<const __m256i*>(block);
+
+      return (_mm256_testc_si256(_mm256_load_si256(p),     mask_low) != 0) &&
+             (_mm256_testc_si256(_mm256_load_si256(p + 1), mask_high) != 0);
+    }
+  }
+}
+
+#endif
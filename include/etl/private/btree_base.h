@@ -0,0 +1,1570 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <algorithm>
+#include <new>
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../pool.h"
+#include "../parameter_type.h"
+#include "../nullptr.h"
+#include "../static_assert.h"
+#include "../exception.h"
+#include "../error_handler.h"
+#include "../debug_count.h"
+#include "key_of.h"
+
+#undef ETL_FILE
+#define ETL_FILE "52"
+
+//*****************************************************************************
+// The number of bytes that each B-tree node is sized to fit.
+// Defaults to four 64 byte cache lines.
+//*****************************************************************************
+#if !defined(ETL_BTREE_NODE_SIZE)
+  #define ETL_BTREE_NODE_SIZE 256
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the B-tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_exception : public etl::exception
+  {
+  public:
+
+    btree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the B-tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_full : public etl::btree_exception
+  {
+  public:
+
+    btree_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the B-tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_out_of_bounds : public etl::btree_exception
+  {
+  public:
+
+    btree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the B-tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_iterator : public etl::btree_exception
+  {
+  public:
+
+    btree_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:iterator", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all B-tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the size of the container.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the container.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the container is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the container is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the container.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of levels in the tree, counting the leaves.
+    /// Zero if the container is empty.
+    //*************************************************************************
+    size_t depth() const
+    {
+      return (current_size == 0) ? 0 : height + 1;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    btree_base(size_type max_size_)
+      : current_size(0)
+      , CAPACITY(max_size_)
+      , height(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_base()
+    {
+    }
+
+    size_type       current_size; ///< The number of the used nodes.
+    const size_type CAPACITY;     ///< The maximum size of the container.
+    size_t          height;       ///< The number of internal node levels.
+    ETL_DECLARE_DEBUG_COUNT;      ///< Internal debugging.
+  };
+
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The B+ tree shared by btree_map, btree_multimap and btree_set.
+    /// Values are stored only in the leaves, which are linked in order for
+    /// iteration. Internal nodes hold copies of the keys to guide lookups.
+    /// Each node holds as many entries as fit in ETL_BTREE_NODE_SIZE bytes.
+    /// Every node except the root is kept at least half full.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyCompare>
+    class ibtree : public etl::btree_base
+    {
+    public:
+
+      typedef TKey              key_type;
+      typedef TValue            value_type;
+      typedef TKeyCompare       key_compare;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+      typedef ptrdiff_t         difference_type;
+
+    protected:
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+      typedef etl::private_container::key_of<TKey, TValue> key_of_value;
+
+      typedef typename etl::aligned_storage<sizeof(TValue), etl::alignment_of<TValue>::value>::type value_storage_t;
+      typedef typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type     key_storage_t;
+
+      struct internal_node;
+
+      //***********************************************************************
+      /// The header common to leaf and internal nodes.
+      //***********************************************************************
+      struct node
+      {
+        internal_node* parent;
+        size_t         count;
+      };
+
+    public:
+
+      /// The number of values in a leaf and keys in an internal node.
+      static const size_t LEAF_HEADER_SIZE   = sizeof(node) + (2 * sizeof(void*));
+      static const size_t LEAF_FIT           = (ETL_BTREE_NODE_SIZE > LEAF_HEADER_SIZE) ? (ETL_BTREE_NODE_SIZE - LEAF_HEADER_SIZE) / sizeof(TValue) : 0;
+      static const size_t LEAF_CAPACITY      = (LEAF_FIT < 4) ? 4 : LEAF_FIT;
+      static const size_t LEAF_MINIMUM       = (LEAF_CAPACITY + 1) / 2;
+
+      // An internal node has room for one extra key and child, used while it splits.
+      static const size_t INTERNAL_FIT       = (ETL_BTREE_NODE_SIZE > (sizeof(node) + (2 * sizeof(void*)) + sizeof(TKey))) ? (ETL_BTREE_NODE_SIZE - sizeof(node) - (2 * sizeof(void*)) - sizeof(TKey)) / (sizeof(TKey) + sizeof(void*)) : 0;
+      static const size_t INTERNAL_CAPACITY  = (INTERNAL_FIT < 4) ? 4 : INTERNAL_FIT;
+      static const size_t INTERNAL_MINIMUM   = INTERNAL_CAPACITY / 2;
+
+    protected:
+
+      //***********************************************************************
+      /// A leaf node, holding the values.
+      //***********************************************************************
+      struct leaf_node : public node
+      {
+        value_type& value(size_t i)
+        {
+          return *reinterpret_cast<value_type*>(&values[i]);
+        }
+
+        const value_type& value(size_t i) const
+        {
+          return *reinterpret_cast<const value_type*>(&values[i]);
+        }
+
+        const key_type& key(size_t i) const
+        {
+          return key_of_value::get(value(i));
+        }
+
+        leaf_node*      prev;
+        leaf_node*      next;
+        value_storage_t values[LEAF_CAPACITY];
+      };
+
+      //***********************************************************************
+      /// An internal node, holding the keys that separate its children.
+      //***********************************************************************
+      struct internal_node : public node
+      {
+        key_type& key(size_t i)
+        {
+          return *reinterpret_cast<key_type*>(&keys[i]);
+        }
+
+        const key_type& key(size_t i) const
+        {
+          return *reinterpret_cast<const key_type*>(&keys[i]);
+        }
+
+        node*         children[INTERNAL_CAPACITY + 2];
+        key_storage_t keys[INTERNAL_CAPACITY + 1];
+      };
+
+    public:
+
+      /// The number of nodes needed for a container of MAX_SIZE values.
+      /// Non-root leaves hold at least LEAF_MINIMUM values and non-root
+      /// internal nodes have at least INTERNAL_MINIMUM + 1 children.
+      template <const size_t MAX_SIZE>
+      struct node_count
+      {
+        static const size_t LEAVES   = (MAX_SIZE / LEAF_MINIMUM) + 1;
+        static const size_t INTERNAL = (LEAVES / INTERNAL_MINIMUM) + 1;
+      };
+
+      class const_iterator;
+
+      //*************************************************************************
+      /// iterator.
+      //*************************************************************************
+      class iterator : public std::iterator<std::bidirectional_iterator_tag, value_type>
+      {
+      public:
+
+        friend class ibtree;
+        friend class const_iterator;
+
+        iterator()
+          : p_tree(nullptr)
+          , p_leaf(nullptr)
+          , index(0)
+        {
+        }
+
+        iterator(ibtree& tree, leaf_node* leaf, size_t index_)
+          : p_tree(&tree)
+          , p_leaf(leaf)
+          , index(index_)
+        {
+        }
+
+        iterator& operator ++()
+        {
+          if (++index == p_leaf->count)
+          {
+            p_leaf = p_leaf->next;
+            index  = 0;
+          }
+
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        iterator& operator --()
+        {
+          if (p_leaf == nullptr)
+          {
+            p_leaf = p_tree->last_leaf;
+            index  = p_leaf->count;
+          }
+          else if (index == 0)
+          {
+            p_leaf = p_leaf->prev;
+            index  = p_leaf->count;
+          }
+
+          --index;
+
+          return *this;
+        }
+
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        reference operator *() const
+        {
+          return p_leaf->value(index);
+        }
+
+        pointer operator &() const
+        {
+          return &p_leaf->value(index);
+        }
+
+        pointer operator ->() const
+        {
+          return &p_leaf->value(index);
+        }
+
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        ibtree*    p_tree;
+        leaf_node* p_leaf;
+        size_t     index;
+      };
+
+      friend class iterator;
+
+      //*************************************************************************
+      /// const_iterator.
+      //*************************************************************************
+      class const_iterator : public std::iterator<std::bidirectional_iterator_tag, const value_type>
+      {
+      public:
+
+        friend class ibtree;
+
+        const_iterator()
+          : p_tree(nullptr)
+          , p_leaf(nullptr)
+          , index(0)
+        {
+        }
+
+        const_iterator(const ibtree& tree, const leaf_node* leaf, size_t index_)
+          : p_tree(&tree)
+          , p_leaf(leaf)
+          , index(index_)
+        {
+        }
+
+        const_iterator(const typename ibtree::iterator& other)
+          : p_tree(other.p_tree)
+          , p_leaf(other.p_leaf)
+          , index(other.index)
+        {
+        }
+
+        const_iterator& operator ++()
+        {
+          if (++index == p_leaf->count)
+          {
+            p_leaf = p_leaf->next;
+            index  = 0;
+          }
+
+          return *this;
+        }
+
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        const_iterator& operator --()
+        {
+          if (p_leaf == nullptr)
+          {
+            p_leaf = p_tree->last_leaf;
+            index  = p_leaf->count;
+          }
+          else if (index == 0)
+          {
+            p_leaf = p_leaf->prev;
+            index  = p_leaf->count;
+          }
+
+          --index;
+
+          return *this;
+        }
+
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        const_reference operator *() const
+        {
+          return p_leaf->value(index);
+        }
+
+        const_pointer operator &() const
+        {
+          return &p_leaf->value(index);
+        }
+
+        const_pointer operator ->() const
+        {
+          return &p_leaf->value(index);
+        }
+
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        const ibtree*    p_tree;
+        const leaf_node* p_leaf;
+        size_t           index;
+      };
+
+      friend class const_iterator;
+
+      typedef std::reverse_iterator<iterator>       reverse_iterator;
+      typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      //*************************************************************************
+      /// Gets the beginning of the container.
+      //*************************************************************************
+      iterator begin()
+      {
+        return iterator(*this, first_leaf, 0);
+      }
+
+      //*************************************************************************
+      /// Gets the beginning of the container.
+      //*************************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(*this, first_leaf, 0);
+      }
+
+      //*************************************************************************
+      /// Gets the end of the container.
+      //*************************************************************************
+      iterator end()
+      {
+        return iterator(*this, nullptr, 0);
+      }
+
+      //*************************************************************************
+      /// Gets the end of the container.
+      //*************************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(*this, nullptr, 0);
+      }
+
+      //*************************************************************************
+      /// Gets the beginning of the container.
+      //*************************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(*this, first_leaf, 0);
+      }
+
+      //*************************************************************************
+      /// Gets the end of the container.
+      //*************************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(*this, nullptr, 0);
+      }
+
+      //*************************************************************************
+      /// Gets the reverse beginning of the container.
+      //*************************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse beginning of the container.
+      //*************************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse end of the container.
+      //*************************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse end of the container.
+      //*************************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse beginning of the container.
+      //*************************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(cend());
+      }
+
+      //*************************************************************************
+      /// Gets the reverse end of the container.
+      //*************************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(cbegin());
+      }
+
+      //*************************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end() if not found.
+      //*************************************************************************
+      iterator find(key_parameter_t key)
+      {
+        iterator i_element = lower_bound(key);
+
+        if ((i_element.p_leaf != nullptr) && key_compare()(key, i_element.p_leaf->key(i_element.index)))
+        {
+          return end();
+        }
+
+        return i_element;
+      }
+
+      //*************************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end() if not found.
+      //*************************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        const_iterator i_element = lower_bound(key);
+
+        if ((i_element.p_leaf != nullptr) && key_compare()(key, i_element.p_leaf->key(i_element.index)))
+        {
+          return end();
+        }
+
+        return i_element;
+      }
+
+      //*************************************************************************
+      /// Counts the number of elements that match the key.
+      //*************************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return std::distance(lower_bound(key), upper_bound(key));
+      }
+
+      //*************************************************************************
+      /// Gets the first element that is not less than the key.
+      //*************************************************************************
+      iterator lower_bound(key_parameter_t key)
+      {
+        leaf_node* leaf;
+        size_t     index;
+
+        find_lower_bound(key, leaf, index);
+
+        return iterator(*this, leaf, index);
+      }
+
+      //*************************************************************************
+      /// Gets the first element that is not less than the key.
+      //*************************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        leaf_node* leaf;
+        size_t     index;
+
+        find_lower_bound(key, leaf, index);
+
+        return const_iterator(*this, leaf, index);
+      }
+
+      //*************************************************************************
+      /// Gets the first element that is greater than the key.
+      //*************************************************************************
+      iterator upper_bound(key_parameter_t key)
+      {
+        leaf_node* leaf;
+        size_t     index;
+
+        find_upper_bound(key, leaf, index);
+
+        return iterator(*this, leaf, index);
+      }
+
+      //*************************************************************************
+      /// Gets the first element that is greater than the key.
+      //*************************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        leaf_node* leaf;
+        size_t     index;
+
+        find_upper_bound(key, leaf, index);
+
+        return const_iterator(*this, leaf, index);
+      }
+
+      //*************************************************************************
+      /// Gets the range of elements that match the key.
+      //*************************************************************************
+      std::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        return std::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+      //*************************************************************************
+      /// Gets the range of elements that match the key.
+      //*************************************************************************
+      std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        return std::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+      //*************************************************************************
+      /// Erases the element at the position.
+      ///\return An iterator to the element after the erased one.
+      //*************************************************************************
+      iterator erase(const_iterator position)
+      {
+        leaf_node* leaf  = const_cast<leaf_node*>(position.p_leaf);
+        size_t     index = position.index;
+
+        erase_value(leaf, index);
+
+        return iterator(*this, leaf, index);
+      }
+
+      //*************************************************************************
+      /// Erases a range of elements.
+      ///\return An iterator to the element after the erased ones.
+      //*************************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        // Erasing moves values between leaves, so count them first.
+        difference_type n = std::distance(first, last);
+
+        iterator position(*this, const_cast<leaf_node*>(first.p_leaf), first.index);
+
+        while (n-- > 0)
+        {
+          position = erase(position);
+        }
+
+        return position;
+      }
+
+      //*************************************************************************
+      /// Erases all of the elements with the key.
+      ///\return The number of elements erased.
+      //*************************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        std::pair<iterator, iterator> range = equal_range(key);
+
+        size_t n = std::distance(range.first, range.second);
+
+        erase(range.first, range.second);
+
+        return n;
+      }
+
+      //*************************************************************************
+      /// Clears the container.
+      //*************************************************************************
+      void clear()
+      {
+        if (root != nullptr)
+        {
+          release_node(root, height);
+        }
+
+        root         = nullptr;
+        first_leaf   = nullptr;
+        last_leaf    = nullptr;
+        height       = 0;
+        current_size = 0;
+      }
+
+      //*************************************************************************
+      /// How to compare two key elements.
+      //*************************************************************************
+      key_compare key_comp() const
+      {
+        return key_compare();
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      ibtree(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_type max_size_)
+        : btree_base(max_size_)
+        , p_leaf_pool(&leaf_pool_)
+        , p_internal_pool(&internal_pool_)
+        , root(nullptr)
+        , first_leaf(nullptr)
+        , last_leaf(nullptr)
+      {
+      }
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+      ~ibtree()
+      {
+      }
+
+      //*************************************************************************
+      /// Inserts a value if there is no element with an equivalent key.
+      ///\return The position of the element and <b>true</b> if it was inserted.
+      //*************************************************************************
+      std::pair<iterator, bool> insert_unique(const value_type& value)
+      {
+        const key_type& key = key_of_value::get(value);
+
+        if (root == nullptr)
+        {
+          return std::make_pair(insert_first(value), true);
+        }
+
+        leaf_node* leaf  = find_leaf_lower(key);
+        size_t     index = leaf_lower_bound(leaf, key);
+
+        // Is the key already there? It may be the first in the next leaf.
+        leaf_node* next_leaf  = leaf;
+        size_t     next_index = index;
+
+        if (next_index == leaf->count)
+        {
+          next_leaf  = leaf->next;
+          next_index = 0;
+        }
+
+        if ((next_leaf != nullptr) && !key_compare()(key, next_leaf->key(next_index)))
+        {
+          return std::make_pair(iterator(*this, next_leaf, next_index), false);
+        }
+
+        ETL_ASSERT(!full(), ETL_ERROR(btree_full));
+
+        insert_value(leaf, index, value);
+
+        return std::make_pair(iterator(*this, leaf, index), true);
+      }
+
+      //*************************************************************************
+      /// Inserts a value after any elements with an equivalent key.
+      ///\return The position of the element.
+      //*************************************************************************
+      iterator insert_equal(const value_type& value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(btree_full));
+
+        if (root == nullptr)
+        {
+          return insert_first(value);
+        }
+
+        const key_type& key = key_of_value::get(value);
+
+        leaf_node* leaf  = find_leaf_upper(key);
+        size_t     index = leaf_upper_bound(leaf, key);
+
+        insert_value(leaf, index, value);
+
+        return iterator(*this, leaf, index);
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Finds the leaf that would hold the first element not less than the key.
+      //*************************************************************************
+      leaf_node* find_leaf_lower(const key_type& key) const
+      {
+        node* p_node = root;
+
+        for (size_t level = height; level != 0; --level)
+        {
+          const internal_node* p_internal = static_cast<const internal_node*>(p_node);
+
+          p_node = p_internal->children[count_less(p_internal, key)];
+        }
+
+        return static_cast<leaf_node*>(p_node);
+      }
+
+      //*************************************************************************
+      /// Finds the leaf that would hold the first element greater than the key.
+      //*************************************************************************
+      leaf_node* find_leaf_upper(const key_type& key) const
+      {
+        node* p_node = root;
+
+        for (size_t level = height; level != 0; --level)
+        {
+          const internal_node* p_internal = static_cast<const internal_node*>(p_node);
+
+          p_node = p_internal->children[count_not_greater(p_internal, key)];
+        }
+
+        return static_cast<leaf_node*>(p_node);
+      }
+
+      //*************************************************************************
+      /// The index of the first value in the leaf that is not less than the key.
+      //*************************************************************************
+      static size_t leaf_lower_bound(const leaf_node* leaf, const key_type& key)
+      {
+        return count_less(leaf, key);
+      }
+
+      //*************************************************************************
+      /// The index of the first value in the leaf that is greater than the key.
+      //*************************************************************************
+      static size_t leaf_upper_bound(const leaf_node* leaf, const key_type& key)
+      {
+        return count_not_greater(leaf, key);
+      }
+
+      //*************************************************************************
+      /// The number of keys in a node that are less than the key.
+      /// The keys are sorted, so this is the lower bound. Counting every key,
+      /// rather than searching, has no unpredictable branches and a node is
+      /// only a few cache lines.
+      //*************************************************************************
+      template <typename TNode>
+      static size_t count_less(const TNode* p_node, const key_type& key)
+      {
+        size_t n = 0;
+
+        for (size_t i = 0; i < p_node->count; ++i)
+        {
+          n += key_compare()(p_node->key(i), key) ? 1 : 0;
+        }
+
+        return n;
+      }
+
+      //*************************************************************************
+      /// The number of keys in a node that are not greater than the key.
+      /// The keys are sorted, so this is the upper bound.
+      //*************************************************************************
+      template <typename TNode>
+      static size_t count_not_greater(const TNode* p_node, const key_type& key)
+      {
+        size_t n = 0;
+
+        for (size_t i = 0; i < p_node->count; ++i)
+        {
+          n += key_compare()(key, p_node->key(i)) ? 0 : 1;
+        }
+
+        return n;
+      }
+
+      //*************************************************************************
+      /// Finds the position of the first element not less than the key.
+      //*************************************************************************
+      void find_lower_bound(const key_type& key, leaf_node*& leaf, size_t& index) const
+      {
+        if (root == nullptr)
+        {
+          leaf  = nullptr;
+          index = 0;
+        }
+        else
+        {
+          leaf  = find_leaf_lower(key);
+          index = leaf_lower_bound(leaf, key);
+          normalise(leaf, index);
+        }
+      }
+
+      //*************************************************************************
+      /// Finds the position of the first element greater than the key.
+      //*************************************************************************
+      void find_upper_bound(const key_type& key, leaf_node*& leaf, size_t& index) const
+      {
+        if (root == nullptr)
+        {
+          leaf  = nullptr;
+          index = 0;
+        }
+        else
+        {
+          leaf  = find_leaf_upper(key);
+          index = leaf_upper_bound(leaf, key);
+          normalise(leaf, index);
+        }
+      }
+
+      //*************************************************************************
+      /// Moves a position that is one past the end of a leaf to the next leaf.
+      //*************************************************************************
+      static void normalise(leaf_node*& leaf, size_t& index)
+      {
+        if (index == leaf->count)
+        {
+          leaf  = leaf->next;
+          index = 0;
+        }
+      }
+
+      //*************************************************************************
+      /// Inserts the first value into an empty tree.
+      //*************************************************************************
+      iterator insert_first(const value_type& value)
+      {
+        leaf_node* leaf = allocate_leaf();
+
+        ::new (&leaf->value(0)) value_type(value);
+        leaf->count = 1;
+        ETL_INCREMENT_DEBUG_COUNT;
+        ++current_size;
+
+        root       = leaf;
+        first_leaf = leaf;
+        last_leaf  = leaf;
+        height     = 0;
+
+        return iterator(*this, leaf, 0);
+      }
+
+      //*************************************************************************
+      /// Inserts a value into a leaf, splitting it if it is full.
+      /// Updates leaf and index to where the value ended up.
+      //*************************************************************************
+      void insert_value(leaf_node*& leaf, size_t& index, const value_type& value)
+      {
+        if (leaf->count < LEAF_CAPACITY)
+        {
+          insert_into_leaf(leaf, index, value);
+        }
+        else
+        {
+          // Split the full leaf, keeping the left half at least as large.
+          leaf_node* right = allocate_leaf();
+          const size_t left_count = (LEAF_CAPACITY + 1) / 2;
+
+          if (index < left_count)
+          {
+            move_values(leaf, left_count - 1, right, 0, LEAF_CAPACITY - (left_count - 1));
+            right->count = LEAF_CAPACITY - (left_count - 1);
+            leaf->count  = left_count - 1;
+            insert_into_leaf(leaf, index, value);
+          }
+          else
+          {
+            move_values(leaf, left_count, right, 0, LEAF_CAPACITY - left_count);
+            right->count = LEAF_CAPACITY - left_count;
+            leaf->count  = left_count;
+            insert_into_leaf(right, index - left_count, value);
+          }
+
+          // Link the new leaf into the list.
+          right->prev = leaf;
+          right->next = leaf->next;
+
+          if (leaf->next != nullptr)
+          {
+            leaf->next->prev = right;
+          }
+          else
+          {
+            last_leaf = right;
+          }
+
+          leaf->next = right;
+
+          insert_into_parent(leaf, right->key(0), right);
+
+          if (index >= left_count)
+          {
+            leaf   = right;
+            index -= left_count;
+          }
+        }
+
+        ++current_size;
+      }
+
+      //*************************************************************************
+      /// Inserts a value into a leaf that has room for it.
+      //*************************************************************************
+      void insert_into_leaf(leaf_node* leaf, size_t index, const value_type& value)
+      {
+        for (size_t i = leaf->count; i > index; --i)
+        {
+          ::new (&leaf->value(i)) value_type(leaf->value(i - 1));
+          leaf->value(i - 1).~value_type();
+        }
+
+        ::new (&leaf->value(index)) value_type(value);
+        ++leaf->count;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      //*************************************************************************
+      /// Moves n values from one leaf to another, which must not overlap.
+      //*************************************************************************
+      static void move_values(leaf_node* source, size_t source_index, leaf_node* destination, size_t destination_index, size_t n)
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          ::new (&destination->value(destination_index + i)) value_type(source->value(source_index + i));
+          source->value(source_index + i).~value_type();
+        }
+      }
+
+      //*************************************************************************
+      /// Adds a separator key and new right child after 'left' in its parent.
+      /// Splits the parent if it overflows.
+      //*************************************************************************
+      void insert_into_parent(node* left, const key_type& key, node* right)
+      {
+        internal_node* parent = left->parent;
+
+        if (parent == nullptr)
+        {
+          // A new root.
+          parent = allocate_internal();
+          ::new (&parent->key(0)) key_type(key);
+          parent->children[0] = left;
+          parent->children[1] = right;
+          parent->count       = 1;
+          left->parent        = parent;
+          right->parent       = parent;
+
+          root = parent;
+          ++height;
+          return;
+        }
+
+        const size_t position = child_index(parent, left);
+
+        // There is always room for one more before splitting.
+        for (size_t i = parent->count; i > position; --i)
+        {
+          ::new (&parent->key(i)) key_type(parent->key(i - 1));
+          parent->key(i - 1).~key_type();
+          parent->children[i + 1] = parent->children[i];
+        }
+
+        ::new (&parent->key(position)) key_type(key);
+        parent->children[position + 1] = right;
+        right->parent = parent;
+        ++parent->count;
+
+        if (parent->count > INTERNAL_CAPACITY)
+        {
+          // Split, moving the middle key up.
+          internal_node* sibling = allocate_internal();
+          const size_t middle = parent->count / 2;
+
+          sibling->count = parent->count - middle - 1;
+
+          for (size_t i = 0; i < sibling->count; ++i)
+          {
+            ::new (&sibling->key(i)) key_type(parent->key(middle + 1 + i));
+            parent->key(middle + 1 + i).~key_type();
+          }
+
+          for (size_t i = 0; i <= sibling->count; ++i)
+          {
+            sibling->children[i] = parent->children[middle + 1 + i];
+            sibling->children[i]->parent = sibling;
+          }
+
+          parent->count = middle;
+
+          // Copy the middle key, as inserting it may move the storage it is in.
+          key_type separator(parent->key(middle));
+          parent->key(middle).~key_type();
+
+          insert_into_parent(parent, separator, sibling);
+        }
+      }
+
+      //*************************************************************************
+      /// Erases a value from a leaf, rebalancing the tree as needed.
+      /// Updates leaf and index to the position of the next element.
+      //*************************************************************************
+      void erase_value(leaf_node*& leaf, size_t& index)
+      {
+        leaf->value(index).~value_type();
+        ETL_DECREMENT_DEBUG_COUNT;
+
+        for (size_t i = index + 1; i < leaf->count; ++i)
+        {
+          ::new (&leaf->value(i - 1)) value_type(leaf->value(i));
+          leaf->value(i).~value_type();
+        }
+
+        --leaf->count;
+        --current_size;
+
+        if (leaf == root)
+        {
+          if (leaf->count == 0)
+          {
+            p_leaf_pool->release(leaf);
+            root       = nullptr;
+            first_leaf = nullptr;
+            last_leaf  = nullptr;
+            leaf       = nullptr;
+            index      = 0;
+            return;
+          }
+        }
+        else if (leaf->count < LEAF_MINIMUM)
+        {
+          rebalance_leaf(leaf, index);
+        }
+
+        normalise(leaf, index);
+      }
+
+      //*************************************************************************
+      /// Refills a leaf that is below the minimum from a sibling, or merges
+      /// it with one. The position leaf/index is kept pointing at the same value.
+      //*************************************************************************
+      void rebalance_leaf(leaf_node*& leaf, size_t& index)
+      {
+        internal_node* parent   = leaf->parent;
+        const size_t   position = child_index(parent, leaf);
+
+        leaf_node* left  = (position > 0)             ? static_cast<leaf_node*>(parent->children[position - 1]) : nullptr;
+        leaf_node* right = (position < parent->count) ? static_cast<leaf_node*>(parent->children[position + 1]) : nullptr;
+
+        if ((left != nullptr) && (left->count > LEAF_MINIMUM))
+        {
+          // Borrow the last value of the left sibling.
+          for (size_t i = leaf->count; i > 0; --i)
+          {
+            ::new (&leaf->value(i)) value_type(leaf->value(i - 1));
+            leaf->value(i - 1).~value_type();
+          }
+
+          move_values(left, left->count - 1, leaf, 0, 1);
+          --left->count;
+          ++leaf->count;
+          ++index;
+
+          parent->key(position - 1) = leaf->key(0);
+        }
+        else if ((right != nullptr) && (right->count > LEAF_MINIMUM))
+        {
+          // Borrow the first value of the right sibling.
+          move_values(right, 0, leaf, leaf->count, 1);
+          ++leaf->count;
+
+          for (size_t i = 1; i < right->count; ++i)
+          {
+            ::new (&right->value(i - 1)) value_type(right->value(i));
+            right->value(i).~value_type();
+          }
+
+          --right->count;
+
+          parent->key(position) = right->key(0);
+        }
+        else if (left != nullptr)
+        {
+          // Merge into the left sibling.
+          move_values(leaf, 0, left, left->count, leaf->count);
+          index       += left->count;
+          left->count += leaf->count;
+
+          unlink_leaf(leaf);
+          p_leaf_pool->release(leaf);
+          leaf = left;
+
+          remove_from_internal(parent, position - 1);
+        }
+        else
+        {
+          // Merge the right sibling into this one.
+          move_values(right, 0, leaf, leaf->count, right->count);
+          leaf->count += right->count;
+
+          unlink_leaf(right);
+          p_leaf_pool->release(right);
+
+          remove_from_internal(parent, position);
+        }
+      }
+
+      //*************************************************************************
+      /// Removes a key and the child to its right from an internal node,
+      /// then rebalances the node.
+      //*************************************************************************
+      void remove_from_internal(internal_node* p_node, size_t key_index)
+      {
+        p_node->key(key_index).~key_type();
+
+        for (size_t i = key_index + 1; i < p_node->count; ++i)
+        {
+          ::new (&p_node->key(i - 1)) key_type(p_node->key(i));
+          p_node->key(i).~key_type();
+          p_node->children[i] = p_node->children[i + 1];
+        }
+
+        --p_node->count;
+
+        rebalance_internal(p_node);
+      }
+
+      //*************************************************************************
+      /// Refills an internal node that is below the minimum from a sibling,
+      /// or merges it with one.
+      //*************************************************************************
+      void rebalance_internal(internal_node* p_node)
+      {
+        if (p_node == root)
+        {
+          if (p_node->count == 0)
+          {
+            // The tree gets shorter.
+            root = p_node->children[0];
+            root->parent = nullptr;
+            p_internal_pool->release(p_node);
+            --height;
+          }
+
+          return;
+        }
+
+        if (p_node->count >= INTERNAL_MINIMUM)
+        {
+          return;
+        }
+
+        internal_node* parent   = p_node->parent;
+        const size_t   position = child_index(parent, p_node);
+
+        internal_node* left  = (position > 0)             ? static_cast<internal_node*>(parent->children[position - 1]) : nullptr;
+        internal_node* right = (position < parent->count) ? static_cast<internal_node*>(parent->children[position + 1]) : nullptr;
+
+        if ((left != nullptr) && (left->count > INTERNAL_MINIMUM))
+        {
+          // Rotate the last child of the left sibling through the parent.
+          p_node->children[p_node->count + 1] = p_node->children[p_node->count];
+
+          for (size_t i = p_node->count; i > 0; --i)
+          {
+            ::new (&p_node->key(i)) key_type(p_node->key(i - 1));
+            p_node->key(i - 1).~key_type();
+            p_node->children[i] = p_node->children[i - 1];
+          }
+
+          ::new (&p_node->key(0)) key_type(parent->key(position - 1));
+          p_node->children[0] = left->children[left->count];
+          p_node->children[0]->parent = p_node;
+          ++p_node->count;
+
+          parent->key(position - 1) = left->key(left->count - 1);
+          left->key(left->count - 1).~key_type();
+          --left->count;
+        }
+        else if ((right != nullptr) && (right->count > INTERNAL_MINIMUM))
+        {
+          // Rotate the first child of the right sibling through the parent.
+          ::new (&p_node->key(p_node->count)) key_type(parent->key(position));
+          p_node->children[p_node->count + 1] = right->children[0];
+          p_node->children[p_node->count + 1]->parent = p_node;
+          ++p_node->count;
+
+          parent->key(position) = right->key(0);
+
+          right->key(0).~key_type();
+
+          for (size_t i = 1; i < right->count; ++i)
+          {
+            ::new (&right->key(i - 1)) key_type(right->key(i));
+            right->key(i).~key_type();
+          }
+
+          for (size_t i = 0; i < right->count; ++i)
+          {
+            right->children[i] = right->children[i + 1];
+          }
+
+          --right->count;
+        }
+        else if (left != nullptr)
+        {
+          merge_internal(left, parent->key(position - 1), p_node);
+          remove_from_internal(parent, position - 1);
+        }
+        else
+        {
+          merge_internal(p_node, parent->key(position), right);
+          remove_from_internal(parent, position);
+        }
+      }
+
+      //*************************************************************************
+      /// Appends the separator and the contents of 'right' to 'left' and
+      /// releases 'right'.
+      //*************************************************************************
+      void merge_internal(internal_node* left, const key_type& separator, internal_node* right)
+      {
+        ::new (&left->key(left->count)) key_type(separator);
+
+        for (size_t i = 0; i < right->count; ++i)
+        {
+          ::new (&left->key(left->count + 1 + i)) key_type(right->key(i));
+          right->key(i).~key_type();
+        }
+
+        for (size_t i = 0; i <= right->count; ++i)
+        {
+          left->children[left->count + 1 + i] = right->children[i];
+          right->children[i]->parent = left;
+        }
+
+        left->count += right->count + 1;
+
+        p_internal_pool->release(right);
+      }
+
+      //*************************************************************************
+      /// Removes a leaf from the linked list of leaves.
+      //*************************************************************************
+      void unlink_leaf(leaf_node* leaf)
+      {
+        if (leaf->prev != nullptr)
+        {
+          leaf->prev->next = leaf->next;
+        }
+        else
+        {
+          first_leaf = leaf->next;
+        }
+
+        if (leaf->next != nullptr)
+        {
+          leaf->next->prev = leaf->prev;
+        }
+        else
+        {
+          last_leaf = leaf->prev;
+        }
+      }
+
+      //*************************************************************************
+      /// Gets the index of a child in its parent.
+      //*************************************************************************
+      static size_t child_index(const internal_node* parent, const node* child)
+      {
+        size_t i = 0;
+
+        while (parent->children[i] != child)
+        {
+          ++i;
+        }
+
+        return i;
+      }
+
+      //*************************************************************************
+      /// Allocates an empty leaf.
+      //*************************************************************************
+      leaf_node* allocate_leaf()
+      {
+        leaf_node* leaf = p_leaf_pool->allocate<leaf_node>();
+
+        leaf->parent = nullptr;
+        leaf->count  = 0;
+        leaf->prev   = nullptr;
+        leaf->next   = nullptr;
+
+        return leaf;
+      }
+
+      //*************************************************************************
+      /// Allocates an empty internal node.
+      //*************************************************************************
+      internal_node* allocate_internal()
+      {
+        internal_node* p_node = p_internal_pool->allocate<internal_node>();
+
+        p_node->parent = nullptr;
+        p_node->count  = 0;
+
+        return p_node;
+      }
+
+      //*************************************************************************
+      /// Destroys the contents of a node and its children and releases them.
+      //*************************************************************************
+      void release_node(node* p_node, size_t level)
+      {
+        if (level == 0)
+        {
+          leaf_node* leaf = static_cast<leaf_node*>(p_node);
+
+          for (size_t i = 0; i < leaf->count; ++i)
+          {
+            leaf->value(i).~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+
+          p_leaf_pool->release(leaf);
+        }
+        else
+        {
+          internal_node* p_internal = static_cast<internal_node*>(p_node);
+
+          for (size_t i = 0; i <= p_internal->count; ++i)
+          {
+            release_node(p_internal->children[i], level - 1);
+          }
+
+          for (size_t i = 0; i < p_internal->count; ++i)
+          {
+            p_internal->key(i).~key_type();
+          }
+
+          p_internal_pool->release(p_internal);
+        }
+      }
+
+      etl::ipool* p_leaf_pool;     ///< The pool of leaf nodes.
+      etl::ipool* p_internal_pool; ///< The pool of internal nodes.
+      node*       root;            ///< The root node, a leaf when height is zero.
+      leaf_node*  first_leaf;      ///< The leaf with the smallest values.
+      leaf_node*  last_leaf;       ///< The leaf with the largest values.
+
+      // Disable copy construction.
+      ibtree(const ibtree&);
+    };
+  }
+}
+
+#undef ETL_FILE
+
+#endif
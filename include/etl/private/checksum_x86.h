@@ -0,0 +1,53 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CHECKSUM_X86_INCLUDED
+#define ETL_CHECKSUM_X86_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../platform.h"
+
+namespace etl
+{
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// SIMD sum and xor of bytes for x86 targets.
+    /// Uses AVX2 if a CPUID check shows that it is available, otherwise SSE2.
+    /// Defined in src/checksum_x86.cpp
+    //*************************************************************************
+    uint64_t sum_x86(const uint8_t* data, size_t length);
+    uint8_t  xor_x86(const uint8_t* data, size_t length);
+  }
+}
+
+#endif
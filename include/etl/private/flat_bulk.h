@@ -0,0 +1,326 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_BULK_INCLUDED
+#define ETL_FLAT_BULK_INCLUDED
+
+#include <stddef.h>
+
+#include "../platform.h"
+
+namespace etl
+{
+  namespace private_flat_bulk
+  {
+    //*************************************************************************
+    /// Gives the bulk algorithms access to the elements of a lookup of
+    /// pointers, as used by the reference_flat containers.
+    /// The algorithms only compare and exchange elements by index.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    class pointer_access
+    {
+    public:
+
+      explicit pointer_access(T** p_)
+        : p(p_)
+      {
+      }
+
+      bool less(size_t a, size_t b) const
+      {
+        return compare(*p[a], *p[b]);
+      }
+
+      void swap(size_t a, size_t b)
+      {
+        T* temp = p[a];
+        p[a] = p[b];
+        p[b] = temp;
+      }
+
+    private:
+
+      T**      p;
+      TCompare compare;
+    };
+
+    //*************************************************************************
+    /// Compares two map elements by their keys.
+    //*************************************************************************
+    template <typename TKeyCompare>
+    struct compare_first
+    {
+      template <typename T>
+      bool operator ()(const T& lhs, const T& rhs) const
+      {
+        return TKeyCompare()(lhs.first, rhs.first);
+      }
+    };
+
+    //*************************************************************************
+    /// Restores the heap property of [base, base + n) from 'root' downwards.
+    //*************************************************************************
+    template <typename TAccess>
+    void sift_down(TAccess& access, size_t base, size_t root, size_t n)
+    {
+      size_t child = (2 * root) + 1;
+
+      while (child < n)
+      {
+        if (((child + 1) < n) && access.less(base + child, base + child + 1))
+        {
+          ++child;
+        }
+
+        if (!access.less(base + root, base + child))
+        {
+          break;
+        }
+
+        access.swap(base + root, base + child);
+        root  = child;
+        child = (2 * root) + 1;
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts [first, last) in place with a heap sort.
+    /// A range that is already in order is left untouched.
+    //*************************************************************************
+    template <typename TAccess>
+    void sort(TAccess& access, size_t first, size_t last)
+    {
+      size_t i = first + 1;
+
+      while ((i < last) && !access.less(i, i - 1))
+      {
+        ++i;
+      }
+
+      if (i >= last)
+      {
+        return;
+      }
+
+      const size_t n = last - first;
+
+      for (i = n / 2; i > 0; --i)
+      {
+        private_flat_bulk::sift_down(access, first, i - 1, n);
+      }
+
+      for (i = n; i > 1; --i)
+      {
+        access.swap(first, first + i - 1);
+        private_flat_bulk::sift_down(access, first, 0, i - 1);
+      }
+    }
+
+    //*************************************************************************
+    /// Reverses [first, last).
+    //*************************************************************************
+    template <typename TAccess>
+    void reverse(TAccess& access, size_t first, size_t last)
+    {
+      while ((first + 1) < last)
+      {
+        --last;
+        access.swap(first, last);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Exchanges the ranges [first, middle) and [middle, last).
+    ///\return The new position of the element at 'first'.
+    //*************************************************************************
+    template <typename TAccess>
+    size_t rotate(TAccess& access, size_t first, size_t middle, size_t last)
+    {
+      private_flat_bulk::reverse(access, first, middle);
+      private_flat_bulk::reverse(access, middle, last);
+      private_flat_bulk::reverse(access, first, last);
+
+      return first + (last - middle);
+    }
+
+    //*************************************************************************
+    /// Finds the first element in [first, last) not less than 'probe'.
+    //*************************************************************************
+    template <typename TAccess>
+    size_t lower_bound(const TAccess& access, size_t first, size_t last, size_t probe)
+    {
+      size_t n = last - first;
+
+      while (n > 0)
+      {
+        size_t half = n / 2;
+
+        if (access.less(first + half, probe))
+        {
+          first += half + 1;
+          n     -= half + 1;
+        }
+        else
+        {
+          n = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the first element in [first, last) greater than 'probe'.
+    //*************************************************************************
+    template <typename TAccess>
+    size_t upper_bound(const TAccess& access, size_t first, size_t last, size_t probe)
+    {
+      size_t n = last - first;
+
+      while (n > 0)
+      {
+        size_t half = n / 2;
+
+        if (!access.less(probe, first + half))
+        {
+          first += half + 1;
+          n     -= half + 1;
+        }
+        else
+        {
+          n = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last) in place,
+    /// without a buffer, by rotating the ranges about their midpoints.
+    /// Equal elements from [first, middle) are kept before those from
+    /// [middle, last).
+    //*************************************************************************
+    template <typename TAccess>
+    void merge(TAccess& access, size_t first, size_t middle, size_t last)
+    {
+      while ((first != middle) && (middle != last))
+      {
+        // Already in order?
+        if (!access.less(middle, middle - 1))
+        {
+          return;
+        }
+
+        const size_t length1 = middle - first;
+        const size_t length2 = last - middle;
+
+        if ((length1 + length2) == 2)
+        {
+          access.swap(first, middle);
+          return;
+        }
+
+        size_t cut1;
+        size_t cut2;
+
+        if (length1 > length2)
+        {
+          cut1 = first + (length1 / 2);
+          cut2 = private_flat_bulk::lower_bound(access, middle, last, cut1);
+        }
+        else
+        {
+          cut2 = middle + (length2 / 2);
+          cut1 = private_flat_bulk::upper_bound(access, first, middle, cut2);
+        }
+
+        const size_t new_middle = private_flat_bulk::rotate(access, cut1, middle, cut2);
+
+        private_flat_bulk::merge(access, first, cut1, new_middle);
+
+        first  = new_middle;
+        middle = cut2;
+      }
+    }
+
+    //*************************************************************************
+    /// Keeps the first of each run of equal elements in the sorted range
+    /// [first, last) and moves the others to the end.
+    ///\return The end of the kept elements.
+    //*************************************************************************
+    template <typename TAccess>
+    size_t unique(TAccess& access, size_t first, size_t last)
+    {
+      if (first == last)
+      {
+        return last;
+      }
+
+      size_t kept = first + 1;
+
+      for (size_t i = first + 1; i < last; ++i)
+      {
+        if (access.less(kept - 1, i))
+        {
+          if (i != kept)
+          {
+            access.swap(kept, i);
+          }
+
+          ++kept;
+        }
+      }
+
+      return kept;
+    }
+
+    //*************************************************************************
+    /// Sorts the elements appended at [n_sorted, n) and merges them with the
+    /// sorted elements at [0, n_sorted).
+    /// If 'is_unique' is set then, of each run of equal elements, the first
+    /// is kept and the others are moved to the end. An existing element is
+    /// always kept in preference to an appended one.
+    ///\return The number of elements kept.
+    //*************************************************************************
+    template <typename TAccess>
+    size_t merge_appended(TAccess& access, size_t n_sorted, size_t n, bool is_unique)
+    {
+      private_flat_bulk::sort(access, n_sorted, n);
+      private_flat_bulk::merge(access, 0, n_sorted, n);
+
+      return is_unique ? private_flat_bulk::unique(access, 0, n) : n;
+    }
+  }
+}
+
+#endif
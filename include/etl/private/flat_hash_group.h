@@ -0,0 +1,184 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_GROUP_INCLUDED
+#define ETL_FLAT_HASH_GROUP_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../binary.h"
+
+#if defined(ETL_FLAT_HASH_HARDWARE_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_FLAT_HASH_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if defined(ETL_COMPILER_MICROSOFT)
+  #include <intrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_flat_hash
+  {
+    /// The control byte of an empty slot. Occupied slots hold a 7 bit tag from the hash.
+    const uint8_t CONTROL_EMPTY = 0x80;
+
+    //*************************************************************************
+    /// The index of the lowest set bit. The mask must not be zero.
+    //*************************************************************************
+    inline size_t lowest_bit_index(uint32_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      return size_t(__builtin_ctz(mask));
+#elif defined(ETL_COMPILER_MICROSOFT)
+      unsigned long index;
+      _BitScanForward(&index, mask);
+      return size_t(index);
+#else
+      return size_t(etl::count_trailing_zeros(mask));
+#endif
+    }
+
+    //*************************************************************************
+    /// The index of the lowest set bit. The mask must not be zero.
+    //*************************************************************************
+    inline size_t lowest_bit_index(uint64_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      return size_t(__builtin_ctzll(mask));
+#elif defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+      unsigned long index;
+      _BitScanForward64(&index, mask);
+      return size_t(index);
+#else
+      return size_t(etl::count_trailing_zeros(mask));
+#endif
+    }
+
+#if defined(ETL_FLAT_HASH_SSE2)
+    //*************************************************************************
+    /// Sixteen control bytes, matched with SSE2.
+    /// Bit i of a mask refers to control byte i.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      typedef uint32_t mask_t;
+
+      static const size_t WIDTH = 16;
+
+      explicit group(const uint8_t* control)
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control)))
+      {
+      }
+
+      /// The bytes equal to the tag.
+      mask_t match(uint8_t tag) const
+      {
+        return mask_t(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(char(tag)))));
+      }
+
+      /// The empty bytes.
+      mask_t match_empty() const
+      {
+        return mask_t(_mm_movemask_epi8(bytes));
+      }
+
+      /// The byte index of the lowest bit in a mask.
+      static size_t index(mask_t mask)
+      {
+        return lowest_bit_index(mask);
+      }
+
+    private:
+
+      __m128i bytes;
+    };
+#else
+    //*************************************************************************
+    /// Eight control bytes, matched a word at a time.
+    /// Bit 8i+7 of a mask refers to control byte i.
+    /// match() may report a false match in the byte above a true one; the key
+    /// comparison rejects it.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      typedef uint64_t mask_t;
+
+      static const size_t WIDTH = 8;
+
+      explicit group(const uint8_t* control)
+        : bytes(0)
+      {
+        // Assemble little endian, so that byte i is always at bits 8i to 8i+7.
+        for (size_t i = 0; i < WIDTH; ++i)
+        {
+          bytes |= uint64_t(control[i]) << (i * 8);
+        }
+      }
+
+      /// The bytes equal to the tag.
+      mask_t match(uint8_t tag) const
+      {
+        const uint64_t x = bytes ^ (LSBS * tag);
+
+        return (x - LSBS) & ~x & MSBS;
+      }
+
+      /// The empty bytes.
+      mask_t match_empty() const
+      {
+        return bytes & MSBS;
+      }
+
+      /// The byte index of the lowest bit in a mask.
+      static size_t index(mask_t mask)
+      {
+        return lowest_bit_index(mask) >> 3;
+      }
+
+    private:
+
+      static const uint64_t LSBS = UINT64_C(0x0101010101010101);
+      static const uint64_t MSBS = UINT64_C(0x8080808080808080);
+
+      uint64_t bytes;
+    };
+#endif
+  }
+}
+
+#endif
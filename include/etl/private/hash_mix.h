@@ -0,0 +1,61 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HASH_MIX_INCLUDED
+#define ETL_HASH_MIX_INCLUDED
+
+#include <stdint.h>
+
+#include "../platform.h"
+
+namespace etl
+{
+  namespace private_hash
+  {
+    //*************************************************************************
+    /// The 64 bit finalisation mix from MurmurHash3.
+    /// Every bit of the input affects every bit of the result, so it is
+    /// used to spread hashes that only fill the low bits of a size_t before
+    /// some of the bits are taken as an index.
+    //*************************************************************************
+    inline uint64_t fmix_64(uint64_t k)
+    {
+      k ^= k >> 33U;
+      k *= UINT64_C(0xFF51AFD7ED558CCD);
+      k ^= k >> 33U;
+      k *= UINT64_C(0xC4CEB9FE1A85EC53);
+      k ^= k >> 33U;
+
+      return k;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,64 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_KEY_OF_INCLUDED
+#define ETL_KEY_OF_INCLUDED
+
+#include "../platform.h"
+
+namespace etl
+{
+  namespace private_container
+  {
+    //*************************************************************************
+    /// Gets the key from a stored value.
+    /// Maps store a pair, sets store the key.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_of
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    template <typename TKey>
+    struct key_of<TKey, TKey>
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,76 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PREFETCH_INCLUDED
+#define ETL_PREFETCH_INCLUDED
+
+#include "../platform.h"
+
+#if defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+  #include <xmmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_prefetch
+  {
+    //*************************************************************************
+    /// Hints that the cache line holding 'p' will soon be read.
+    /// Does nothing on compilers without a prefetch intrinsic.
+    //*************************************************************************
+    inline void prefetch_read(const void* p)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(p, 0, 3);
+#elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+      _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+      (void)p;
+#endif
+    }
+
+    //*************************************************************************
+    /// Hints that the cache line holding 'p' will soon be written.
+    /// Does nothing on compilers without a prefetch intrinsic.
+    //*************************************************************************
+    inline void prefetch_write(const void* p)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(p, 1, 3);
+#elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+      _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+      (void)p;
+#endif
+    }
+  }
+}
+
+#endif
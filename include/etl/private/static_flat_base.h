@@ -0,0 +1,734 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_BASE_INCLUDED
+#define ETL_STATIC_FLAT_BASE_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <algorithm>
+#include <new>
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../parameter_type.h"
+#include "../type_traits.h"
+#include "../exception.h"
+#include "../error_handler.h"
+#include "../debug_count.h"
+#include "key_of.h"
+#include "prefetch.h"
+
+#undef ETL_FILE
+#define ETL_FILE "53"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the static flat containers.
+  ///\ingroup static_flat
+  //***************************************************************************
+  class static_flat_exception : public etl::exception
+  {
+  public:
+
+    static_flat_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the static flat containers.
+  ///\ingroup static_flat
+  //***************************************************************************
+  class static_flat_full : public etl::static_flat_exception
+  {
+  public:
+
+    static_flat_full(string_type file_name_, numeric_type line_number_)
+      : etl::static_flat_exception(ETL_ERROR_TEXT("static_flat:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the static flat containers.
+  ///\ingroup static_flat
+  //***************************************************************************
+  class static_flat_out_of_bounds : public etl::static_flat_exception
+  {
+  public:
+
+    static_flat_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::static_flat_exception(ETL_ERROR_TEXT("static_flat:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_static_flat
+  {
+    //*************************************************************************
+    /// The storage shared by static_flat_map and static_flat_set.
+    /// The elements are held in key order, so iteration is a walk along an
+    /// array. A copy of the keys is held in Eytzinger (breadth first) order,
+    /// where the children of the key at index k are at 2k and 2k + 1.
+    /// A search descends that implicit tree without branching on the
+    /// comparison, and the top levels share the first few cache lines.
+    /// While a search compares one key it prefetches the descendants four
+    /// levels below, which for small keys lie together in one cache line.
+    /// The element for a key is found from its tree position by arithmetic.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyCompare>
+    class istatic_flat
+    {
+    public:
+
+      typedef TKey              key_type;
+      typedef TValue            value_type;
+      typedef TKeyCompare       key_compare;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+      typedef ptrdiff_t         difference_type;
+
+      typedef value_type*       iterator;
+      typedef const value_type* const_iterator;
+
+      typedef std::reverse_iterator<iterator>       reverse_iterator;
+      typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    protected:
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+      typedef etl::private_container::key_of<TKey, TValue> key_of_value;
+
+    public:
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the container.
+      //*********************************************************************
+      iterator begin()
+      {
+        return p_values;
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the container.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return p_values;
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the container.
+      //*********************************************************************
+      iterator end()
+      {
+        return p_values + current_size;
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the container.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return p_values + current_size;
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the container.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return p_values;
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the container.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return p_values + current_size;
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the container.
+      //*********************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the container.
+      //*********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the container.
+      //*********************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the container.
+      //*********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the container.
+      //*********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(cend());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the container.
+      //*********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(cbegin());
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator pointing to the element or end() if not found.
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        size_type index = lower_bound_index(key);
+
+        return is_match(index, key) ? p_values + index : end();
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A const_iterator pointing to the element or end() if not found.
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        size_type index = lower_bound_index(key);
+
+        return is_match(index, key) ? p_values + index : end();
+      }
+
+      //*********************************************************************
+      /// Counts the elements with a key.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_type count(key_parameter_t key) const
+      {
+        return is_match(lower_bound_index(key), key) ? 1 : 0;
+      }
+
+      //*********************************************************************
+      /// Finds the first element with a key not less than 'key'.
+      //*********************************************************************
+      iterator lower_bound(key_parameter_t key)
+      {
+        return p_values + lower_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the first element with a key not less than 'key'.
+      //*********************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        return p_values + lower_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the first element with a key greater than 'key'.
+      //*********************************************************************
+      iterator upper_bound(key_parameter_t key)
+      {
+        return p_values + upper_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the first element with a key greater than 'key'.
+      //*********************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        return p_values + upper_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the range of elements with a key.
+      //*********************************************************************
+      std::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        size_type index = lower_bound_index(key);
+        size_type n     = is_match(index, key) ? 1 : 0;
+
+        return std::pair<iterator, iterator>(p_values + index, p_values + index + n);
+      }
+
+      //*********************************************************************
+      /// Finds the range of elements with a key.
+      //*********************************************************************
+      std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        size_type index = lower_bound_index(key);
+        size_type n     = is_match(index, key) ? 1 : 0;
+
+        return std::pair<const_iterator, const_iterator>(p_values + index, p_values + index + n);
+      }
+
+      //*********************************************************************
+      /// Builds the container from a range, replacing any existing contents.
+      /// The range need not be sorted. If keys are repeated in the range then
+      /// it is unspecified which of the elements is kept.
+      /// If the range is larger than the capacity then the container holds
+      /// the elements that fitted and, if asserts or exceptions are enabled,
+      /// emits static_flat_full.
+      ///\param first The iterator to the first element.
+      ///\param last  The iterator to the last element + 1.
+      //*********************************************************************
+      template <typename TIterator>
+      void assign(TIterator first, TIterator last)
+      {
+        clear();
+
+        bool is_ordered = true;
+
+        while ((first != last) && !full())
+        {
+          ::new (static_cast<void*>(p_values + current_size)) value_type(*first);
+          ETL_INCREMENT_DEBUG_COUNT;
+
+          if ((current_size != 0) && !key_compare()(key(current_size - 1), key(current_size)))
+          {
+            is_ordered = false;
+          }
+
+          ++current_size;
+          ++first;
+        }
+
+        if (!is_ordered)
+        {
+          sort();
+          remove_duplicates();
+        }
+
+        build_index();
+
+        ETL_ASSERT(first == last, ETL_ERROR(static_flat_full));
+      }
+
+      //*********************************************************************
+      /// Clears the container.
+      //*********************************************************************
+      void clear()
+      {
+        if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<key_type>::value || !etl::is_trivially_destructible<value_type>::value)
+        {
+          for (size_type i = 0; i < current_size; ++i)
+          {
+            p_keys[i + 1].~key_type();
+            p_values[i].~value_type();
+          }
+        }
+
+        current_size = 0;
+        height       = 0;
+        last_level   = 0;
+        ETL_RESET_DEBUG_COUNT;
+      }
+
+      //*********************************************************************
+      /// Returns the key comparison functor.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return key_compare();
+      }
+
+      //*********************************************************************
+      /// Gets the size of the container.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the container.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return CAPACITY;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the container is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the container is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == CAPACITY;
+      }
+
+      //*********************************************************************
+      /// Returns the capacity of the container.
+      //*********************************************************************
+      size_type capacity() const
+      {
+        return CAPACITY;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return CAPACITY - current_size;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      ///\param p_keys_   Storage for max_size_ + 1 keys. The first is unused.
+      ///\param p_values_ Storage for max_size_ values.
+      //*********************************************************************
+      istatic_flat(key_type* p_keys_, value_type* p_values_, size_type max_size_)
+        : p_keys(p_keys_),
+          p_values(p_values_),
+          current_size(0),
+          CAPACITY(max_size_),
+          height(0),
+          last_level(0)
+      {
+      }
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~istatic_flat()
+      {
+      }
+
+    private:
+
+      // Disable copy construction.
+      istatic_flat(const istatic_flat&);
+
+      /// The number of keys that are prefetched together, four levels below.
+      static const size_t PREFETCH_SPAN = 16;
+
+      //*********************************************************************
+      /// Gets the key of the element at 'index'.
+      //*********************************************************************
+      const key_type& key(size_type index) const
+      {
+        return key_of_value::get(p_values[index]);
+      }
+
+      //*********************************************************************
+      /// Is the element at 'index' a match for 'key'?
+      /// 'index' must be the lower bound of 'key'.
+      //*********************************************************************
+      bool is_match(size_type index, key_parameter_t key_) const
+      {
+        return (index != current_size) && !key_compare()(key_, key(index));
+      }
+
+      //*********************************************************************
+      /// Finds the index of the first element with a key not less than 'key'.
+      //*********************************************************************
+      size_type lower_bound_index(key_parameter_t key_) const
+      {
+        key_compare compare;
+        size_type k     = 1;
+        size_type depth = 0;
+        size_type found = 0;
+        size_type found_depth = 0;
+
+        while (k <= current_size)
+        {
+          if ((k * PREFETCH_SPAN) <= current_size)
+          {
+            etl::private_prefetch::prefetch_read(p_keys + (k * PREFETCH_SPAN));
+          }
+
+          bool go_right = compare(p_keys[k], key_);
+
+          // The last node where the search went left is the lower bound.
+          found       = go_right ? found : k;
+          found_depth = go_right ? found_depth : depth;
+          k           = (2 * k) + (go_right ? 1 : 0);
+          ++depth;
+        }
+
+        return (found == 0) ? current_size : index_of(found, found_depth);
+      }
+
+      //*********************************************************************
+      /// Finds the index of the first element with a key greater than 'key'.
+      //*********************************************************************
+      size_type upper_bound_index(key_parameter_t key_) const
+      {
+        key_compare compare;
+        size_type k     = 1;
+        size_type depth = 0;
+        size_type found = 0;
+        size_type found_depth = 0;
+
+        while (k <= current_size)
+        {
+          if ((k * PREFETCH_SPAN) <= current_size)
+          {
+            etl::private_prefetch::prefetch_read(p_keys + (k * PREFETCH_SPAN));
+          }
+
+          bool go_right = !compare(key_, p_keys[k]);
+
+          found       = go_right ? found : k;
+          found_depth = go_right ? found_depth : depth;
+          k           = (2 * k) + (go_right ? 1 : 0);
+          ++depth;
+        }
+
+        return (found == 0) ? current_size : index_of(found, found_depth);
+      }
+
+      //*********************************************************************
+      /// Gets the sorted index of the key at tree position 'k', at 'depth'.
+      /// If the bottom level were full, the node that is 'j' from the left of
+      /// its level would have (2j + 1) * 2^(height - depth) - 1 nodes before it.
+      /// From that is subtracted the number of missing bottom level nodes
+      /// that would have come before it.
+      //*********************************************************************
+      size_type index_of(size_type k, size_type depth) const
+      {
+        size_type j       = k - (size_type(1) << depth);
+        size_type index   = (((2 * j) + 1) << (height - depth)) - 1;
+        size_type leaves  = (index + 1) / 2;
+
+        return (leaves > last_level) ? index - (leaves - last_level) : index;
+      }
+
+      //*********************************************************************
+      /// Gets the first tree position in key order.
+      //*********************************************************************
+      size_type first_position() const
+      {
+        size_type k = 1;
+
+        while ((2 * k) <= current_size)
+        {
+          k *= 2;
+        }
+
+        return k;
+      }
+
+      //*********************************************************************
+      /// Gets the tree position that follows 'k' in key order.
+      //*********************************************************************
+      size_type next_position(size_type k) const
+      {
+        if (((2 * k) + 1) <= current_size)
+        {
+          k = (2 * k) + 1;
+
+          while ((2 * k) <= current_size)
+          {
+            k *= 2;
+          }
+        }
+        else
+        {
+          while ((k & 1) != 0)
+          {
+            k /= 2;
+          }
+
+          k /= 2;
+        }
+
+        return k;
+      }
+
+      //*********************************************************************
+      /// Copies the keys of the sorted elements in to the tree.
+      //*********************************************************************
+      void build_index()
+      {
+        height = 0;
+
+        while ((size_type(2) << height) <= current_size)
+        {
+          ++height;
+        }
+
+        last_level = current_size - ((size_type(1) << height) - 1);
+
+        size_type k = first_position();
+
+        for (size_type i = 0; i < current_size; ++i)
+        {
+          ::new (static_cast<void*>(p_keys + k)) key_type(key(i));
+          k = next_position(k);
+        }
+      }
+
+      //*********************************************************************
+      /// Exchanges two elements.
+      /// The keys of map elements are const, so they are copied and rebuilt.
+      //*********************************************************************
+      void swap_values(size_type a, size_type b)
+      {
+        value_type temp(p_values[a]);
+        p_values[a].~value_type();
+        ::new (static_cast<void*>(p_values + a)) value_type(p_values[b]);
+        p_values[b].~value_type();
+        ::new (static_cast<void*>(p_values + b)) value_type(temp);
+      }
+
+      //*********************************************************************
+      /// Restores the heap property from 'root' downwards.
+      //*********************************************************************
+      void sift_down(size_type root, size_type n)
+      {
+        key_compare compare;
+        size_type child = (2 * root) + 1;
+
+        while (child < n)
+        {
+          if (((child + 1) < n) && compare(key(child), key(child + 1)))
+          {
+            ++child;
+          }
+
+          if (!compare(key(root), key(child)))
+          {
+            break;
+          }
+
+          swap_values(root, child);
+          root  = child;
+          child = (2 * root) + 1;
+        }
+      }
+
+      //*********************************************************************
+      /// Sorts the elements in place with a heap sort.
+      /// The elements cannot be assigned, as map keys are const.
+      //*********************************************************************
+      void sort()
+      {
+        for (size_type i = current_size / 2; i > 0; --i)
+        {
+          sift_down(i - 1, current_size);
+        }
+
+        for (size_type n = current_size; n > 1; --n)
+        {
+          swap_values(0, n - 1);
+          sift_down(0, n - 1);
+        }
+      }
+
+      //*********************************************************************
+      /// Removes the elements with repeated keys from the sorted elements.
+      //*********************************************************************
+      void remove_duplicates()
+      {
+        if (current_size == 0)
+        {
+          return;
+        }
+
+        size_type last = 0;
+
+        for (size_type i = 1; i < current_size; ++i)
+        {
+          if (key_compare()(key(last), key(i)))
+          {
+            ++last;
+
+            if (last != i)
+            {
+              ::new (static_cast<void*>(p_values + last)) value_type(p_values[i]);
+              p_values[i].~value_type();
+            }
+          }
+          else
+          {
+            p_values[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+
+        current_size = last + 1;
+      }
+
+      key_type*       p_keys;       ///< The keys in tree order, from index 1.
+      value_type*     p_values;     ///< The elements in key order.
+      size_type       current_size; ///< The number of elements.
+      const size_type CAPACITY;     ///< The maximum number of elements.
+      size_type       height;       ///< The depth of the bottom level of the tree.
+      size_type       last_level;   ///< The number of keys on the bottom level.
+
+      /// Internal debugging.
+      ETL_DECLARE_DEBUG_COUNT;
+    };
+  }
+}
+
+#undef ETL_FILE
+
+#endif
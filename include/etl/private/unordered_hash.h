@@ -0,0 +1,116 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_HASH_INCLUDED
+#define ETL_UNORDERED_HASH_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../power.h"
+#include "hash_mix.h"
+
+//*****************************************************************************
+// Options shared by unordered_map, unordered_multimap, unordered_set and
+// unordered_multiset.
+//
+// ETL_UNORDERED_POWER_OF_2_BUCKETS
+//   Rounds the number of buckets up to a power of two and selects the bucket
+//   with a mask instead of a divide. The hash is mixed first, so that weak
+//   hashes still spread over the buckets.
+//
+// ETL_UNORDERED_STORE_HASH
+//   Stores the hash in each node, so that most nodes with a different key are
+//   rejected without calling the key equality function.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// The number of buckets for a requested number.
+    //*************************************************************************
+    template <const size_t MAX_BUCKETS>
+    struct bucket_count
+    {
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      static const size_t value = (MAX_BUCKETS < 2) ? 1 : size_t(etl::power_of_2_round_up<(MAX_BUCKETS < 2) ? 2 : MAX_BUCKETS>::value);
+#else
+      static const size_t value = MAX_BUCKETS;
+#endif
+    };
+
+    //*************************************************************************
+    /// The bucket index for a hash.
+    //*************************************************************************
+    inline size_t bucket_index(size_t hash, size_t number_of_buckets)
+    {
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      return size_t(etl::private_hash::fmix_64(uint64_t(hash))) & (number_of_buckets - 1);
+#else
+      return hash % number_of_buckets;
+#endif
+    }
+
+    //*************************************************************************
+    /// The hash stored in a node.
+    /// Empty unless ETL_UNORDERED_STORE_HASH is defined.
+    //*************************************************************************
+    struct node_hash
+    {
+#if defined(ETL_UNORDERED_STORE_HASH)
+      void set_hash(size_t hash_)
+      {
+        hash = hash_;
+      }
+
+      bool hash_matches(size_t hash_) const
+      {
+        return hash == hash_;
+      }
+
+      size_t hash;
+#else
+      void set_hash(size_t)
+      {
+      }
+
+      bool hash_matches(size_t) const
+      {
+        return true;
+      }
+#endif
+    };
+  }
+}
+
+#endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include <stddef.h>
 #include <stdint.h>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -244,6 +245,9 @@ namespace etl
     typedef T                     value_type;      ///< The type stored in the queue.
     typedef T&                    reference;       ///< A reference to the type used in the queue.
     typedef const T&              const_reference; ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                   rvalue_reference; ///< An rvalue reference to the type used in the queue.
+#endif
     typedef T*                    pointer;         ///< A pointer to the type used in the queue.
     typedef const T*              const_pointer;   ///< A const pointer to the type used in the queue.
     typedef queue_base::size_type size_type;       ///< The type used for determining the size of the queue.
@@ -296,7 +300,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
     ///\param value The value to push to the queue.
     //*************************************************************************
-    void push(parameter_t value)
+    void push(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
@@ -305,6 +309,22 @@ namespace etl
       base_t::add_in();
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(rvalue_reference value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+#endif
+      ::new (&p_buffer[in]) T(std::move(value));
+      base_t::add_in();
+    }
+#endif
+
     //*************************************************************************
     /// Allows a possibly more efficient 'push' by moving to the next input value
     /// and returning a reference to it.
@@ -324,6 +344,22 @@ namespace etl
       return p_buffer[next];
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
+    ///\param args The arguments to use to construct the item to push to the queue.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+#endif
+      ::new (&p_buffer[in]) T(std::forward<Args>(args)...);
+      base_t::add_in();
+    }
+#else
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
     /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
@@ -383,6 +419,7 @@ namespace etl
       ::new (&p_buffer[in]) T(value1, value2, value3, value4);
       base_t::add_in();
     }
+#endif
 
     //*************************************************************************
     /// Clears the queue to the empty state.
@@ -457,6 +494,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iqueue& operator = (iqueue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -475,6 +527,29 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Make this a clone of the supplied queue, moving its values and
+    /// leaving it empty.
+    //*************************************************************************
+    void move_clone(iqueue&& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(queue_full));
+
+      clear();
+
+      size_t index = other.out;
+
+      for (size_t i = 0; i < other.size(); ++i)
+      {
+        push(std::move(other.p_buffer[index]));
+        index = (index == (other.CAPACITY - 1)) ? 0 : index + 1;
+      }
+
+      other.clear();
+    }
+#endif
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -538,6 +613,17 @@ namespace etl
       etl::iqueue<T>::clone(rhs);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor
+    //*************************************************************************
+    queue(queue&& rhs)
+      : etl::iqueue<T>(reinterpret_cast<T*>(&buffer[0]), SIZE)
+    {
+      etl::iqueue<T>::move_clone(std::move(rhs));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -559,6 +645,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    queue& operator = (queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::iqueue<T>::move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The uninitialised buffer of T used in the stack.
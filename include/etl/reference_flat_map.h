@@ -41,6 +41,7 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "exception.h"
 #include "static_assert.h"
+#include "private/flat_bulk.h"
 
 #undef ETL_FILE
 #define ETL_FILE "30"
@@ -576,6 +577,58 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the reference_flat_map in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values already in the map are kept. If a key is repeated in the range
+    /// then it is unspecified which of the repeats is referenced.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const size_type n_sorted = size();
+
+        while ((first != last) && !full())
+        {
+          append(*first++);
+        }
+
+        erase_from(merge_appended(n_sorted));
+
+        if (full())
+        {
+          // Only values that are already present can still be accepted.
+          while ((first != last) && (count((*first).first) != 0))
+          {
+            ++first;
+          }
+
+          break;
+        }
+      }
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_map_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the reference_flat_map in bulk.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -847,6 +900,34 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value without sorting, for a following merge_appended.
+    //*********************************************************************
+    void append(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n_sorted' and merges them.
+    /// The values whose keys were already present are moved to the end.
+    ///\return The number of values kept.
+    //*********************************************************************
+    size_type merge_appended(size_type n_sorted)
+    {
+      etl::private_flat_bulk::pointer_access<value_type, etl::private_flat_bulk::compare_first<key_compare> > access(lookup.data());
+
+      return etl::private_flat_bulk::merge_appended(access, n_sorted, lookup.size(), true);
+    }
+
+    //*********************************************************************
+    /// Removes the values from 'index' to the end.
+    //*********************************************************************
+    void erase_from(size_type index)
+    {
+      lookup.erase(lookup.begin() + index, lookup.end());
+    }
+
   private:
 
     // Disable copy construction and assignment.
@@ -43,6 +43,7 @@ SOFTWARE.
 #include "pool.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "private/flat_bulk.h"
 
 #undef ETL_FILE
 #define ETL_FILE "33"
@@ -507,6 +508,43 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the reference_flat_multiset in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values from the range follow any equal values already in the multiset.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      const size_type n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        append(*first++);
+      }
+
+      merge_appended(n_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multiset_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the reference_flat_multiset in bulk.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -773,6 +811,24 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value without sorting, for a following merge_appended.
+    //*********************************************************************
+    void append(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n_sorted' and merges them.
+    //*********************************************************************
+    void merge_appended(size_type n_sorted)
+    {
+      etl::private_flat_bulk::pointer_access<value_type, key_compare> access(lookup.data());
+
+      etl::private_flat_bulk::merge_appended(access, n_sorted, lookup.size(), false);
+    }
+
   private:
 
     // Disable copy construction.
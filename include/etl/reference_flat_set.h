@@ -43,6 +43,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "vector.h"
+#include "private/flat_bulk.h"
 
 #undef ETL_FILE
 #define ETL_FILE "32"
@@ -488,6 +489,58 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values to the reference_flat_set in bulk.
+    /// The values are appended, sorted once and merged with the existing
+    /// contents, rather than inserted one at a time.
+    /// Values already in the set are kept. If a value is repeated in the range
+    /// then it is unspecified which of the repeats is referenced.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const size_type n_sorted = size();
+
+        while ((first != last) && !full())
+        {
+          append(*first++);
+        }
+
+        erase_from(merge_appended(n_sorted));
+
+        if (full())
+        {
+          // Only values that are already present can still be accepted.
+          while ((first != last) && (count(*first) != 0))
+          {
+            ++first;
+          }
+
+          break;
+        }
+      }
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_set_full));
+    }
+
+    //*********************************************************************
+    /// Assigns an unsorted range of values to the reference_flat_set in bulk.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_unsorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_range(first, last);
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -755,6 +808,34 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value without sorting, for a following merge_appended.
+    //*********************************************************************
+    void append(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n_sorted' and merges them.
+    /// The values that were already present are moved to the end.
+    ///\return The number of values kept.
+    //*********************************************************************
+    size_type merge_appended(size_type n_sorted)
+    {
+      etl::private_flat_bulk::pointer_access<value_type, key_compare> access(lookup.data());
+
+      return etl::private_flat_bulk::merge_appended(access, n_sorted, lookup.size(), true);
+    }
+
+    //*********************************************************************
+    /// Removes the values from 'index' to the end.
+    //*********************************************************************
+    void erase_from(size_type index)
+    {
+      lookup.erase(lookup.begin() + index, lookup.end());
+    }
+
   private:
 
     // Disable copy construction.
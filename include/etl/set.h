@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -463,6 +464,9 @@ namespace etl
     typedef TCompare    key_compare;
     typedef TCompare    value_compare;
     typedef value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&         rvalue_reference;
+#endif
     typedef value_type* const_pointer;
     typedef size_t      size_type;
 
@@ -492,6 +496,7 @@ namespace etl
 
     //*************************************************************************
     /// The data node element in the set.
+    /// The value is not const, so that a moved set can move it out.
     //*************************************************************************
     struct Data_Node : public Node
     {
@@ -500,7 +505,7 @@ namespace etl
       {
       }
 
-      value_type value;
+      T value;
     };
 
     /// Defines the key value parameter type
@@ -795,6 +800,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iset& operator = (iset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the beginning of the set.
     //*************************************************************************
@@ -1096,6 +1117,82 @@ namespace etl
       return iterator(*this, inserted_node);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the set.
+    /// The value is left untouched if it is already in the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      Node* found = find_node(root_node, value);
+
+      if (found)
+      {
+        return std::make_pair(iterator(*this, found), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(set_full));
+
+      Data_Node& node = allocate_data_node(std::move(value));
+
+      return std::make_pair(iterator(*this, insert_node(root_node, node)), true);
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the set starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the set starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference value)
+    {
+      return insert(std::move(value)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the set.
+    /// If the value is already in the set the new one is discarded.
+    /// If asserts or exceptions are enabled, emits set_full if the set is full and the value is not in it.
+    ///\param args The arguments to construct the value from.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      if (full())
+      {
+        // There is no free node to build the value in, but it may
+        // already be in the set, so look it up before asserting.
+        const T value(std::forward<Args>(args)...);
+        Node* found = find_node(root_node, value);
+
+        ETL_ASSERT(found != nullptr, ETL_ERROR(set_full));
+
+        return std::make_pair(iterator(*this, found), false);
+      }
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return std::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the set.
     /// If asserts or exceptions are enabled, emits set_full if the set does not have enough free space.
@@ -1175,18 +1272,58 @@ namespace etl
       erase(begin(), end());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements of another set in to this one, leaving it empty.
+    /// The nodes live in each set's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(iset&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(set_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        insert_node(root_node, allocate_data_node(std::move(data_cast(itr.p_node)->value)));
+        ++itr;
+      }
+
+      // The moved from values may no longer be comparable, so the nodes
+      // are released by walking the tree rather than by erasing each key.
+      rhs.destroy_nodes(rhs.root_node);
+      rhs.root_node = nullptr;
+      rhs.current_size = 0;
+    }
+#endif
+
   private:
 
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
-    Data_Node& allocate_data_node(value_type value)
+    Data_Node& allocate_data_node(const_reference value)
+    {
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new ((void*)&node.value) T(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+      return node;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allocate a Data_Node, moving the value in to it.
+    //*************************************************************************
+    Data_Node& allocate_data_node(rvalue_reference value)
     {
       Data_Node& node = *p_node_pool->allocate<Data_Node>();
-      ::new ((void*)&node.value) value_type(value);
+      ::new ((void*)&node.value) T(std::move(value));
       ETL_INCREMENT_DEBUG_COUNT;
       return node;
     }
+#endif
 
     //*************************************************************************
     /// Destroy a Data_Node.
@@ -1198,6 +1335,21 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Destroy the Data_Node at position and all of the nodes below it.
+    //*************************************************************************
+    void destroy_nodes(Node* position)
+    {
+      if (position)
+      {
+        destroy_nodes(position->children[kLeft]);
+        destroy_nodes(position->children[kRight]);
+        destroy_data_node(*data_cast(position));
+      }
+    }
+#endif
+
     //*************************************************************************
     /// Find the value matching the node provided
     //*************************************************************************
@@ -1995,6 +2147,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    set(set&& other)
+      : etl::iset<T, TCompare>(node_pool, MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -2019,6 +2180,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    set& operator = (set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used for the set.
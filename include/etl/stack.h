@@ -34,6 +34,7 @@ SOFTWARE.
 #include <stddef.h>
 #include <stdint.h>
 #include <algorithm>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -226,6 +227,9 @@ namespace etl
     typedef T                     value_type;      ///< The type stored in the stack.
     typedef T&                    reference;       ///< A reference to the type used in the stack.
     typedef const T&              const_reference; ///< A const reference to the type used in the stack.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                   rvalue_reference; ///< An rvalue reference to the type used in the stack.
+#endif
     typedef T*                    pointer;         ///< A pointer to the type used in the stack.
     typedef const T*              const_pointer;   ///< A const pointer to the type used in the stack.
     typedef stack_base::size_type size_type;       ///< The type used for determining the size of the stack.
@@ -251,7 +255,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::stack_full if the stack is already full.
     ///\param value The value to push to the stack.
     //*************************************************************************
-    void push(parameter_t value)
+    void push(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(stack_full));
@@ -260,6 +264,38 @@ namespace etl
       ::new (&p_buffer[top_index]) T(value);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves a value to the stack.
+    /// If asserts or exceptions are enabled, throws an etl::stack_full if the stack is already full.
+    ///\param value The value to push to the stack.
+    //*************************************************************************
+    void push(rvalue_reference value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+#endif
+      base_t::add_in();
+      ::new (&p_buffer[top_index]) T(std::move(value));
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Constructs a value in the stack place'.
+    /// If asserts or exceptions are enabled, throws an etl::stack_full if the stack is already full.
+    ///\param args The arguments to use to construct the item to push to the stack.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(stack_full));
+#endif
+      base_t::add_in();
+      ::new (&p_buffer[top_index]) T(std::forward<Args>(args)...);
+    }
+#else
     //*************************************************************************
     /// Constructs a value in the stack place'.
     /// If asserts or exceptions are enabled, throws an etl::stack_full if the stack is already full.
@@ -319,6 +355,7 @@ namespace etl
       base_t::add_in();
       ::new (&p_buffer[top_index]) T(value1, value2, value3, value4);
     }
+#endif
 
     //*************************************************************************
     /// Allows a possibly more efficient 'push' by moving to the next input value
@@ -420,6 +457,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    istack& operator = (istack&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -435,6 +487,26 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Make this a clone of the supplied stack, moving its values and
+    /// leaving it empty.
+    //*************************************************************************
+    void move_clone(istack&& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(stack_full));
+
+      clear();
+
+      for (size_t i = 0; i < other.size(); ++i)
+      {
+        push(std::move(other.p_buffer[i]));
+      }
+
+      other.clear();
+    }
+#endif
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -498,6 +570,17 @@ namespace etl
       etl::istack<T>::clone(rhs);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor
+    //*************************************************************************
+    stack(stack&& rhs)
+      : etl::istack<T>(reinterpret_cast<T*>(&buffer[0]), SIZE)
+    {
+      etl::istack<T>::move_clone(std::move(rhs));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -519,6 +602,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    stack& operator = (stack&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::istack<T>::move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The unintitialised buffer of T used in the stack.
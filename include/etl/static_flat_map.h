@@ -0,0 +1,306 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_MAP_INCLUDED
+#define ETL_STATIC_FLAT_MAP_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "private/static_flat_base.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "53"
+
+//*****************************************************************************
+///\defgroup static_flat_map static_flat_map
+/// A read only map with the capacity defined at compile time.
+/// It is built once from a range and then searched in O(logN), using a copy
+/// of the keys laid out in Eytzinger order so that lookups are branch free
+/// and touch few cache lines. Elements cannot be inserted or erased singly.
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized static_flat_maps.
+  /// Can be used as a reference type for all static_flat_maps containing a specific type.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey> >
+  class istatic_flat_map : public etl::private_static_flat::istatic_flat<TKey, std::pair<const TKey, TMapped>, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_static_flat::istatic_flat<TKey, std::pair<const TKey, TMapped>, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::key_type        key_type;
+    typedef TMapped                        mapped_type;
+    typedef typename base::value_type      value_type;
+    typedef typename base::key_compare     key_compare;
+    typedef typename base::reference       reference;
+    typedef typename base::const_reference const_reference;
+    typedef typename base::pointer         pointer;
+    typedef typename base::const_pointer   const_pointer;
+    typedef typename base::size_type       size_type;
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+  protected:
+
+    typedef typename base::key_parameter_t key_parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    struct value_comp
+    {
+      bool operator ()(const value_type& value1, const value_type& value2) const
+      {
+        return key_compare()(value1.first, value2.first);
+      }
+    };
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::static_flat_out_of_bounds if the key is not in the map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(static_flat_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::static_flat_out_of_bounds if the key is not in the map.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(static_flat_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    istatic_flat_map& operator = (const istatic_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    istatic_flat_map(key_type* p_keys_, value_type* p_values_, size_type max_size_)
+      : base(p_keys_, p_values_, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    istatic_flat_map(const istatic_flat_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_STATIC_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~istatic_flat_map()
+    {
+    }
+#else
+  protected:
+    ~istatic_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first static_flat_map.
+  ///\param rhs Reference to the second static_flat_map.
+  ///\return <b>true</b> if the static_flat_maps are equal, otherwise <b>false</b>.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first static_flat_map.
+  ///\param rhs Reference to the second static_flat_map.
+  ///\return <b>true</b> if the static_flat_maps are not equal, otherwise <b>false</b>.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A static_flat_map implementation that uses fixed size buffers.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  ///\tparam TCompare The key comparison functor.
+  ///\ingroup static_flat_map
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
+  class static_flat_map : public etl::istatic_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::istatic_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    static_flat_map()
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    static_flat_map(const static_flat_map& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    static_flat_map(TIterator first, TIterator last)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    static_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<node_t*>(&value_buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~static_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    static_flat_map& operator = (const static_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    typedef typename base::value_type node_t;
+
+    /// The buffer for the keys in tree order. The first is unused.
+    typename etl::aligned_storage<sizeof(TKey) * (MAX_SIZE + 1), etl::alignment_of<TKey>::value>::type key_buffer;
+
+    /// The buffer for the elements.
+    typename etl::aligned_storage<sizeof(node_t) * MAX_SIZE, etl::alignment_of<node_t>::value>::type value_buffer;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
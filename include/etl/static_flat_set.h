@@ -0,0 +1,272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_SET_INCLUDED
+#define ETL_STATIC_FLAT_SET_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "private/static_flat_base.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "53"
+
+//*****************************************************************************
+///\defgroup static_flat_set static_flat_set
+/// A read only set with the capacity defined at compile time.
+/// It is built once from a range and then searched in O(logN), using a copy
+/// of the keys laid out in Eytzinger order so that lookups are branch free
+/// and touch few cache lines. Elements cannot be inserted or erased singly.
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized static_flat_sets.
+  /// Can be used as a reference type for all static_flat_sets containing a specific type.
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = std::less<TKey> >
+  class istatic_flat_set : public etl::private_static_flat::istatic_flat<TKey, TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_static_flat::istatic_flat<TKey, TKey, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::key_type        key_type;
+    typedef typename base::value_type      value_type;
+    typedef typename base::key_compare     key_compare;
+    typedef typename base::reference       reference;
+    typedef typename base::const_reference const_reference;
+    typedef typename base::pointer         pointer;
+    typedef typename base::const_pointer   const_pointer;
+    typedef typename base::size_type       size_type;
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+  protected:
+
+    typedef typename base::key_parameter_t key_parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    struct value_comp
+    {
+      bool operator ()(const value_type& value1, const value_type& value2) const
+      {
+        return key_compare()(value1, value2);
+      }
+    };
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    istatic_flat_set& operator = (const istatic_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    istatic_flat_set(key_type* p_keys_, value_type* p_values_, size_type max_size_)
+      : base(p_keys_, p_values_, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    istatic_flat_set(const istatic_flat_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_STATIC_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~istatic_flat_set()
+    {
+    }
+#else
+  protected:
+    ~istatic_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first static_flat_set.
+  ///\param rhs Reference to the second static_flat_set.
+  ///\return <b>true</b> if the static_flat_sets are equal, otherwise <b>false</b>.
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::istatic_flat_set<TKey, TKeyCompare>& lhs, const etl::istatic_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first static_flat_set.
+  ///\param rhs Reference to the second static_flat_set.
+  ///\return <b>true</b> if the static_flat_sets are not equal, otherwise <b>false</b>.
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::istatic_flat_set<TKey, TKeyCompare>& lhs, const etl::istatic_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A static_flat_set implementation that uses fixed size buffers.
+  /// The keys are held twice, in key order and in tree order.
+  ///\tparam TKey     The key type.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  ///\tparam TCompare The key comparison functor.
+  ///\ingroup static_flat_set
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
+  class static_flat_set : public etl::istatic_flat_set<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::istatic_flat_set<TKey, TCompare> base;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    static_flat_set()
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TKey*>(&value_buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    static_flat_set(const static_flat_set& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TKey*>(&value_buffer), MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    static_flat_set(TIterator first, TIterator last)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TKey*>(&value_buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    static_flat_set(std::initializer_list<typename base::value_type> init)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TKey*>(&value_buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~static_flat_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    static_flat_set& operator = (const static_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The buffer for the keys in tree order. The first is unused.
+    typename etl::aligned_storage<sizeof(TKey) * (MAX_SIZE + 1), etl::alignment_of<TKey>::value>::type key_buffer;
+
+    /// The buffer for the elements.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE, etl::alignment_of<TKey>::value>::type value_buffer;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "char_traits.h"
 #include "integral_limits.h"
 #include "hash.h"
+#include "basic_string.h"
 
 #include <algorithm>
 
@@ -118,7 +119,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    basic_string_view()
+    ETL_CONSTEXPR basic_string_view()
       : mbegin(nullptr),
         mend(nullptr)
     {
@@ -127,7 +128,7 @@ namespace etl
     //*************************************************************************
     /// Construct from T*.
     //*************************************************************************
-    basic_string_view(const T* begin_)
+    ETL_CONSTEXPR14 basic_string_view(const T* begin_)
       : mbegin(begin_),
         mend(begin_ + TTraits::length(begin_))
     {
@@ -136,7 +137,7 @@ namespace etl
     //*************************************************************************
     /// Construct from pointer range.
     //*************************************************************************
-    basic_string_view(const T* begin_, const T* end_)
+    ETL_CONSTEXPR basic_string_view(const T* begin_, const T* end_)
       : mbegin(begin_),
         mend(end_)
     {
@@ -146,7 +147,7 @@ namespace etl
     /// Construct from iterator/size.
     //*************************************************************************
     template <typename TSize, typename TDummy = typename etl::enable_if<etl::is_integral<TSize>::value, void>::type>
-    basic_string_view(const T* begin_, TSize size_)
+    ETL_CONSTEXPR basic_string_view(const T* begin_, TSize size_)
       : mbegin(begin_),
         mend(begin_ + size_)
     {
@@ -155,7 +156,7 @@ namespace etl
     //*************************************************************************
     /// Copy constructor
     //*************************************************************************
-    basic_string_view(const basic_string_view& other)
+    ETL_CONSTEXPR basic_string_view(const basic_string_view& other)
       : mbegin(other.mbegin),
         mend(other.mend)
     {
@@ -180,7 +181,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const pointer to the first element of the internal storage.
     //*************************************************************************
-    const_pointer data() const
+    ETL_CONSTEXPR const_pointer data() const
     {
       return mbegin;
     }
@@ -188,7 +189,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the beginning of the array.
     //*************************************************************************
-    const_iterator begin() const
+    ETL_CONSTEXPR const_iterator begin() const
     {
       return mbegin;
     }
@@ -196,7 +197,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the beginning of the array.
     //*************************************************************************
-    const_iterator cbegin() const
+    ETL_CONSTEXPR const_iterator cbegin() const
     {
       return mbegin;
     }
@@ -204,7 +205,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const iterator to the end of the array.
     //*************************************************************************
-    const_iterator end() const
+    ETL_CONSTEXPR const_iterator end() const
     {
       return mend;
     }
@@ -212,7 +213,7 @@ namespace etl
     //*************************************************************************
     // Returns a const iterator to the end of the array.
     //*************************************************************************
-    const_iterator cend() const
+    ETL_CONSTEXPR const_iterator cend() const
     {
       return mend;
     }
@@ -256,7 +257,7 @@ namespace etl
     //*************************************************************************
     /// Returns <b>true</b> if the array size is zero.
     //*************************************************************************
-    bool empty() const
+    ETL_CONSTEXPR bool empty() const
     {
       return (mbegin == mend);
     }
@@ -264,7 +265,7 @@ namespace etl
     //*************************************************************************
     /// Returns the size of the array.
     //*************************************************************************
-    size_t size() const
+    ETL_CONSTEXPR size_t size() const
     {
       return (mend - mbegin);
     }
@@ -272,7 +273,7 @@ namespace etl
     //*************************************************************************
     /// Returns the size of the array.
     //*************************************************************************
-    size_t length() const
+    ETL_CONSTEXPR size_t length() const
     {
       return size();
     }
@@ -288,7 +289,7 @@ namespace etl
     //*************************************************************************
     /// Assign from a view.
     //*************************************************************************
-    etl::basic_string_view<T, TTraits>& operator=(const etl::basic_string_view<T, TTraits>& other)
+    ETL_CONSTEXPR14 etl::basic_string_view<T, TTraits>& operator=(const etl::basic_string_view<T, TTraits>& other)
     {
       mbegin = other.mbegin;
       mend = other.mend;
@@ -321,7 +322,7 @@ namespace etl
     //*************************************************************************
     /// Returns a const reference to the indexed value.
     //*************************************************************************
-    const_reference operator[](size_t i) const
+    ETL_CONSTEXPR const_reference operator[](size_t i) const
     {
       return mbegin[i];
     }
@@ -749,16 +750,28 @@ namespace etl
     //*************************************************************************
     /// Equality for array views.
     //*************************************************************************
-    friend bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
-      return (lhs.size() == rhs.size()) &&
-        std::equal(lhs.begin(), lhs.end(), rhs.begin());
+      if (lhs.size() != rhs.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < lhs.size(); ++i)
+      {
+        if (lhs[i] != rhs[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
     }
 
     //*************************************************************************
     /// Inequality for array views.
     //*************************************************************************
-    friend bool operator != (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+    friend ETL_CONSTEXPR14 bool operator != (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return !(lhs == rhs);
     }
@@ -801,6 +814,33 @@ namespace etl
     const T* mend;
   };
 
+  //*************************************************************************
+  /// Equality and inequality with strings.
+  //*************************************************************************
+  template <typename T, typename TTraits>
+  bool operator ==(const etl::basic_string_view<T, TTraits>& lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return lhs == etl::basic_string_view<T, TTraits>(rhs.data(), rhs.size());
+  }
+
+  template <typename T, typename TTraits>
+  bool operator ==(const etl::ibasic_string<T>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return etl::basic_string_view<T, TTraits>(lhs.data(), lhs.size()) == rhs;
+  }
+
+  template <typename T, typename TTraits>
+  bool operator !=(const etl::basic_string_view<T, TTraits>& lhs, const etl::ibasic_string<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <typename T, typename TTraits>
+  bool operator !=(const etl::ibasic_string<T>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
   typedef etl::basic_string_view<char>     string_view;
   typedef etl::basic_string_view<wchar_t>  wstring_view;
   typedef etl::basic_string_view<char16_t> u16string_view;
@@ -808,46 +848,12 @@ namespace etl
 
   //*************************************************************************
   /// Hash function.
+  /// Gives the same value as etl::hash for strings with the same characters.
   //*************************************************************************
 #if ETL_8BIT_SUPPORT
-  template <>
-  struct hash<etl::string_view>
+  template <typename T, typename TTraits>
+  struct hash<etl::basic_string_view<T, TTraits> > : public etl::private_hash::text_hash<T>
   {
-    size_t operator()(const etl::string_view& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
-  template <>
-  struct hash<etl::wstring_view>
-  {
-    size_t operator()(const etl::wstring_view& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
-  template <>
-  struct hash<etl::u16string_view>
-  {
-    size_t operator()(const etl::u16string_view& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
-  template <>
-  struct hash<etl::u32string_view>
-  {
-    size_t operator()(const etl::u32string_view& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
   };
 #endif
 }
@@ -250,6 +250,15 @@ namespace etl
   ///\ingroup type_traits
   template <typename T> struct is_compound : integral_constant<bool, !is_fundamental<T>::value> {};
 
+  /// is_enum
+  /// For C++03, uses the compiler's intrinsic.
+  ///\ingroup type_traits
+#if ETL_CPP11_SUPPORTED
+  template <typename T> struct is_enum : std::is_enum<T> {};
+#else
+  template <typename T> struct is_enum : integral_constant<bool, __is_enum(T)> {};
+#endif
+
   /// is_array
   ///\ingroup type_traits
   template <typename T> struct is_array : false_type {};
@@ -314,6 +323,16 @@ namespace etl
   template <typename T> struct is_trivially_copy_assignable : etl::is_pod<T> {};
 #endif
 
+  /// is_trivially_relocatable
+  /// True if an object may be moved to new storage with memmove, with no
+  /// constructor or destructor call for the old location.
+  /// Defaults to trivially copy constructible and trivially destructible types.
+  /// Specialise for types that are safe to relocate but are not trivial,
+  /// i.e. types that do not hold pointers to themselves.
+  ///\ingroup type_traits
+  template <typename T> struct is_trivially_relocatable
+    : etl::integral_constant<bool, etl::is_trivially_copy_constructible<T>::value && etl::is_trivially_destructible<T>::value> {};
+
   /// conditional
   ///\ingroup type_traits
   template <bool B, typename T, typename F>  struct conditional { typedef T type; };
@@ -207,24 +207,9 @@ namespace etl
   /// Hash function.
   //*************************************************************************
 #if ETL_8BIT_SUPPORT
-  template <>
-  struct hash<etl::iu16string>
-  {
-    size_t operator()(const etl::iu16string& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
   template <const size_t SIZE>
-  struct hash<etl::u16string<SIZE> >
+  struct hash<etl::u16string<SIZE> > : public etl::private_hash::text_hash<char16_t>
   {
-    size_t operator()(const etl::u16string<SIZE>& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
   };
 #endif
 }
@@ -207,24 +207,9 @@ namespace etl
   /// Hash function.
   //*************************************************************************
 #if ETL_8BIT_SUPPORT
-  template <>
-  struct hash<etl::iu32string>
-  {
-    size_t operator()(const etl::iu32string& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
   template <const size_t SIZE>
-  struct hash<etl::u32string<SIZE> >
+  struct hash<etl::u32string<SIZE> > : public etl::private_hash::text_hash<char32_t>
   {
-    size_t operator()(const etl::u32string<SIZE>& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
   };
 #endif
 }
@@ -44,6 +44,7 @@ SOFTWARE.
 #include "array.h"
 #include "intrusive_forward_list.h"
 #include "hash.h"
+#include "functional.h"
 #include "type_traits.h"
 #include "parameter_type.h"
 #include "nullptr.h"
@@ -51,6 +52,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "debug_count.h"
+#include "private/unordered_hash.h"
 
 #undef ETL_FILE
 #define ETL_FILE "16"
@@ -136,6 +138,9 @@ namespace etl
     typedef TKeyEqual         key_equal;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -146,7 +151,7 @@ namespace etl
     typedef etl::forward_link<0> link_t; // Default link.
 
                                          // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public etl::private_unordered::node_hash
     {
       node_t(const value_type& key_value_pair_)
         : key_value_pair(key_value_pair_)
@@ -241,7 +246,7 @@ namespace etl
       }
 
       //*********************************
-      std::pair<const TKey, T> operator *()
+      reference operator *()
       {
         return inode->key_value_pair;
       }
@@ -486,7 +491,9 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -495,7 +502,9 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -504,7 +513,9 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -594,7 +605,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return etl::private_unordered::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -634,7 +645,8 @@ namespace etl
     mapped_type& operator [](key_parameter_t key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -643,7 +655,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_matches(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -657,11 +669,14 @@ namespace etl
       // Doesn't exist, so add a new one.
       // Get a new node.
       node_t& node = *pnodepool->allocate<node_t>();
+      node.set_hash(hash);
       ::new (&node.key_value_pair) value_type(key, T());
       ETL_INCREMENT_DEBUG_COUNT;
 
       pbucket->insert_after(pbucket->before_begin(), node);
 
+      adjust_first_last_markers(pbucket);
+
       return pbucket->begin()->key_value_pair.second;
     }
 
@@ -674,7 +689,8 @@ namespace etl
     mapped_type& at(key_parameter_t key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -683,7 +699,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_matches(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -709,7 +725,8 @@ namespace etl
     const mapped_type& at(key_parameter_t key) const
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -718,7 +735,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_matches(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -774,7 +791,8 @@ namespace etl
       const mapped_type& mapped = key_value_pair.second;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -787,6 +805,7 @@ namespace etl
       {
         // Get a new node.
         node_t& node = *pnodepool->allocate<node_t>();
+        node.set_hash(hash);
         ::new (&node.key_value_pair) value_type(key_value_pair);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -807,7 +826,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (inode->key_value_pair.first == key)
+          if (node_matches(*inode, hash, key))
           {
             break;
           }
@@ -821,6 +840,7 @@ namespace etl
         {
           // Get a new node.
           node_t& node = *pnodepool->allocate<node_t>();
+          node.set_hash(hash);
           ::new (&node.key_value_pair) value_type(key_value_pair);
           ETL_INCREMENT_DEBUG_COUNT;
 
@@ -847,6 +867,102 @@ namespace etl
       return insert(key_value_pair).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_map.
+    /// The value is left untouched if the key is already in the unordered_map.
+    /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      iterator itr = find(key_value_pair.first);
+
+      if (itr != end())
+      {
+        return std::pair<iterator, bool>(itr, false);
+      }
+
+      return emplace(std::move(key_value_pair));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the unordered_map.
+    /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference key_value_pair)
+    {
+      return insert(std::move(key_value_pair)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_map.
+    /// If the key is already in the unordered_map the new value is discarded.
+    /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map is full and the key is not in it.
+    ///\param args The arguments to construct the value_type from.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      if (full())
+      {
+        // There is no free node to build the value in, but the key may
+        // already be in the unordered_map, so look it up before asserting.
+        const value_type value(std::forward<Args>(args)...);
+        iterator itr = find(value.first);
+
+        ETL_ASSERT(itr != end(), ETL_ERROR(unordered_map_full));
+
+        return std::pair<iterator, bool>(itr, false);
+      }
+
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key_value_pair) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      const key_type& key = node.key_value_pair.first;
+
+      // Get the hash index.
+      const size_t hash = key_hash_function(key);
+      node.set_hash(hash);
+
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
+      bucket_t& bucket = *pbucket;
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (node_matches(*inode, hash, key))
+        {
+          // Discard the new node.
+          node.key_value_pair.~value_type();
+          pnodepool->release(&node);
+          ETL_DECREMENT_DEBUG_COUNT;
+
+          return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode), false);
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      // Add the node to the end of the bucket.
+      bucket.insert_after(inode_previous, node);
+      ++inode_previous;
+
+      adjust_first_last_markers(pbucket);
+
+      return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode_previous), true);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the unordered_map.
     /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map does not have enough free space.
@@ -871,7 +987,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[index];
 
@@ -879,7 +996,7 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (icurrent->key_value_pair.first != key))
+      while ((icurrent != bucket.end()) && !node_matches(*icurrent, hash, key))
       {
         ++iprevious;
         ++icurrent;
@@ -1006,7 +1123,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1021,7 +1139,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (node_matches(*inode, hash, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1040,7 +1158,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1055,7 +1174,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (node_matches(*inode, hash, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1109,6 +1228,139 @@ namespace etl
       return std::pair<const_iterator, const_iterator>(f, l);
     }
 
+    //*********************************************************************
+    /// Counts an element, using a key of another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, size_t>::type
+      count(const TOtherKey& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, iterator>::type
+      find(const TOtherKey& key)
+    {
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_matches(*inode, hash, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, const_iterator>::type
+      find(const TOtherKey& key) const
+    {
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_matches(*inode, hash, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of
+    /// another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, std::pair<iterator, iterator> >::type
+      equal_range(const TOtherKey& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of
+    /// another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const TOtherKey& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<const_iterator, const_iterator>(f, l);
+    }
+
     //*************************************************************************
     /// Gets the size of the unordered_map.
     //*************************************************************************
@@ -1191,6 +1443,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_map& operator = (iunordered_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1242,8 +1510,48 @@ namespace etl
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another unordered_map in to this one, leaving it empty.
+    /// The nodes live in each map's own pool, so the values are moved one by one.
+    //*********************************************************************
+    void move_container(iunordered_map&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(unordered_map_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        emplace(std::move(*itr));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Gets the first bucket that is not empty.
+    /// Erase does not move the first marker on, so it may point to empty
+    /// buckets before the first used one. They are skipped here and the
+    /// marker is moved past them, so each is only skipped once between
+    /// inserts and begin() is amortised constant time.
+    //*********************************************************************
+    bucket_t* get_first_bucket() const
+    {
+      while ((first != last) && first->empty())
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1259,6 +1567,17 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Checks whether a node holds a key.
+    /// If the hash is stored in the node then most other keys are rejected
+    /// without calling the key equality function.
+    //*********************************************************************
+    template <typename TOtherKey>
+    bool node_matches(const node_t& node, size_t hash, const TOtherKey& key) const
+    {
+      return node.hash_matches(hash) && key_equal_function(key, node.key_value_pair.first);
+    }
+
     // Disable copy construction.
     iunordered_map(const iunordered_map&);
 
@@ -1272,7 +1591,8 @@ namespace etl
     const size_t number_of_buckets;
 
     /// The first and last pointers to buckets with values.
-    bucket_t* first;
+    /// The first marker is moved on by begin(), so is mutable.
+    mutable bucket_t* first;
     bucket_t* last;
 
     /// The function that creates the hashes.
@@ -1339,13 +1659,13 @@ namespace etl
   public:
 
     static const size_t MAX_SIZE    = MAX_SIZE_;
-    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static const size_t MAX_BUCKETS = etl::private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     unordered_map()
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS)
     {
       base::initialise();
     }
@@ -1354,7 +1674,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS)
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -1367,11 +1687,22 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS)
     {
       base::assign(first_, last_);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_map(unordered_map&& other)
+      : base(node_pool, buckets, MAX_BUCKETS)
+    {
+      base::move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1394,13 +1725,29 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_map& operator = (unordered_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_map.
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS];
   };
 }
 
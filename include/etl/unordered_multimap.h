@@ -51,6 +51,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "debug_count.h"
+#include "private/unordered_hash.h"
 
 #undef ETL_FILE
 #define ETL_FILE "25"
@@ -136,6 +137,9 @@ namespace etl
     typedef TKeyEqual         key_equal;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -145,7 +149,7 @@ namespace etl
 
     typedef etl::forward_link<0> link_t; // Default link.
 
-    struct node_t : public link_t // The nodes that store the elements.
+    struct node_t : public link_t, public etl::private_unordered::node_hash // The nodes that store the elements.
     {
       node_t(const value_type& key_value_pair_)
         : key_value_pair(key_value_pair_)
@@ -240,7 +244,7 @@ namespace etl
       }
 
       //*********************************
-      std::pair<const TKey, T> operator *()
+      reference operator *()
       {
         return inode->key_value_pair;
       }
@@ -486,7 +490,9 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -495,7 +501,9 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -504,7 +512,9 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -594,7 +604,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return etl::private_unordered::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -665,7 +675,8 @@ namespace etl
       const mapped_type& mapped = key_value_pair.second;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -676,6 +687,7 @@ namespace etl
       {
         // Get a new node.
         node_t& node = *pnodepool->allocate<node_t>();
+        node.set_hash(hash);
         ::new (&node.key_value_pair) value_type(key_value_pair);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -695,7 +707,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (inode->key_value_pair.first == key)
+          if (node_matches(*inode, hash, key))
           {
             break;
           }
@@ -706,6 +718,7 @@ namespace etl
 
         // Get a new node.
         node_t& node = *pnodepool->allocate<node_t>();
+        node.set_hash(hash);
         ::new (&node.key_value_pair) value_type(key_value_pair);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -730,6 +743,78 @@ namespace etl
       return insert(key_value_pair);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(rvalue_reference key_value_pair)
+    {
+      return emplace(std::move(key_value_pair));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference key_value_pair)
+    {
+      return insert(std::move(key_value_pair));
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param args The arguments to construct the value from.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
+
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key_value_pair) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      const key_type& key = node.key_value_pair.first;
+
+      // Get the hash index.
+      const size_t hash = key_hash_function(key);
+      node.set_hash(hash);
+
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
+      bucket_t& bucket = *pbucket;
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (node_matches(*inode, hash, key))
+        {
+          break;
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      // Add the node in front of any with the same key.
+      bucket.insert_after(inode_previous, node);
+      ++inode_previous;
+
+      adjust_first_last_markers(pbucket);
+
+      return iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the unordered_multimap.
     /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap does not have enough free space.
@@ -754,7 +839,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t bucket_id = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -763,7 +849,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (icurrent->key_value_pair.first == key)
+        if (node_matches(*icurrent, hash, key))
         {
           bucket.erase_after(iprevious);          // Unlink from the bucket.
           icurrent->key_value_pair.~value_type(); // Destroy the value.
@@ -907,7 +993,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -922,7 +1009,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (node_matches(*inode, hash, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -941,7 +1028,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -956,7 +1044,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (node_matches(*inode, hash, key))
           {
             return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1102,6 +1190,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_multimap& operator = (iunordered_multimap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1152,8 +1256,48 @@ namespace etl
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another unordered_multimap in to this one, leaving it empty.
+    /// The nodes live in each unordered_multimap's own pool, so the values are moved one by one.
+    //*********************************************************************
+    void move_container(iunordered_multimap&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(unordered_multimap_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        emplace(std::move(*itr));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Gets the first bucket that is not empty.
+    /// Erase does not move the first marker on, so it may point to empty
+    /// buckets before the first used one. They are skipped here and the
+    /// marker is moved past them, so each is only skipped once between
+    /// inserts and begin() is amortised constant time.
+    //*********************************************************************
+    bucket_t* get_first_bucket() const
+    {
+      while ((first != last) && first->empty())
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1169,6 +1313,17 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Checks whether a node holds a key.
+    /// If the hash is stored in the node then most other keys are rejected
+    /// without calling the key equality function.
+    //*********************************************************************
+    template <typename TOtherKey>
+    bool node_matches(const node_t& node, size_t hash, const TOtherKey& key) const
+    {
+      return node.hash_matches(hash) && key_equal_function(key, node.key_value_pair.first);
+    }
+
     // Disable copy construction.
     iunordered_multimap(const iunordered_multimap&);
 
@@ -1182,7 +1337,8 @@ namespace etl
     const size_t number_of_buckets;
 
     /// The first and last iterators to buckets with values.
-    bucket_t* first;
+    /// The first marker is moved on by begin(), so is mutable.
+    mutable bucket_t* first;
     bucket_t* last;
 
     /// The function that creates the hashes.
@@ -1249,7 +1405,7 @@ namespace etl
   public:
 
     static const size_t MAX_SIZE    = MAX_SIZE_;
-    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static const size_t MAX_BUCKETS = etl::private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
@@ -1282,6 +1438,17 @@ namespace etl
       base::assign(first_, last_);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_multimap(unordered_multimap&& other)
+      : base(node_pool, buckets, MAX_BUCKETS)
+    {
+      base::move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1304,13 +1471,29 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_multimap& operator = (unordered_multimap&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_multimap.
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS];
   };
 }
 
@@ -50,6 +50,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "debug_count.h"
+#include "private/unordered_hash.h"
 
 #undef ETL_FILE
 #define ETL_FILE "26"
@@ -133,6 +134,9 @@ namespace etl
     typedef TKeyEqual         key_equal;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -142,7 +146,7 @@ namespace etl
     typedef etl::forward_link<0> link_t;
 
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public etl::private_unordered::node_hash
     {
       node_t(const value_type& key_)
         : key(key_)
@@ -481,7 +485,9 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -490,7 +496,9 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -499,7 +507,9 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -589,7 +599,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return etl::private_unordered::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -657,7 +667,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -668,6 +679,7 @@ namespace etl
       {
         // Get a new node.
         node_t& node = *pnodepool->allocate<node_t>();
+        node.set_hash(hash);
         ::new (&node.key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -688,7 +700,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (inode->key == key)
+          if (node_matches(*inode, hash, key))
           {
             break;
           }
@@ -699,6 +711,7 @@ namespace etl
 
         // Get a new node.
         node_t& node = *pnodepool->allocate<node_t>();
+        node.set_hash(hash);
         ::new (&node.key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -724,6 +737,78 @@ namespace etl
       return insert(key).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_multiset.
+    /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      return emplace(std::move(key));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the unordered_multiset.
+    /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference key)
+    {
+      return insert(std::move(key)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multiset.
+    /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset is already full.
+    ///\param args The arguments to construct the value from.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
+
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      const key_type& key = node.key;
+
+      // Get the hash index.
+      const size_t hash = key_hash_function(key);
+      node.set_hash(hash);
+
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
+      bucket_t& bucket = *pbucket;
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (node_matches(*inode, hash, key))
+        {
+          break;
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      // Add the node in front of any with the same key.
+      bucket.insert_after(inode_previous, node);
+      ++inode_previous;
+
+      adjust_first_last_markers(pbucket);
+
+      return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode_previous), true);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the unordered_multiset.
     /// If asserts or exceptions are enabled, emits unordered_multiset_full if the unordered_multiset does not have enough free space.
@@ -748,7 +833,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t bucket_id = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -757,7 +843,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (icurrent->key == key)
+        if (node_matches(*icurrent, hash, key))
         {
           bucket.erase_after(iprevious);  // Unlink from the bucket.
           icurrent->key.~value_type();    // Destroy the value.
@@ -901,7 +987,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -916,7 +1003,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (node_matches(*inode, hash, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -935,7 +1022,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -950,7 +1038,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (node_matches(*inode, hash, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1096,6 +1184,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_multiset& operator = (iunordered_multiset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1146,8 +1250,48 @@ namespace etl
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another unordered_multiset in to this one, leaving it empty.
+    /// The nodes live in each unordered_multiset's own pool, so the values are moved one by one.
+    //*********************************************************************
+    void move_container(iunordered_multiset&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(unordered_multiset_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        emplace(std::move(*itr));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Gets the first bucket that is not empty.
+    /// Erase does not move the first marker on, so it may point to empty
+    /// buckets before the first used one. They are skipped here and the
+    /// marker is moved past them, so each is only skipped once between
+    /// inserts and begin() is amortised constant time.
+    //*********************************************************************
+    bucket_t* get_first_bucket() const
+    {
+      while ((first != last) && first->empty())
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1163,6 +1307,17 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Checks whether a node holds a key.
+    /// If the hash is stored in the node then most other keys are rejected
+    /// without calling the key equality function.
+    //*********************************************************************
+    template <typename TOtherKey>
+    bool node_matches(const node_t& node, size_t hash, const TOtherKey& key) const
+    {
+      return node.hash_matches(hash) && key_equal_function(key, node.key);
+    }
+
     // Disable copy construction.
     iunordered_multiset(const iunordered_multiset&);
 
@@ -1176,7 +1331,8 @@ namespace etl
     const size_t number_of_buckets;
 
     /// The first and last iterators to buckets with values.
-    bucket_t* first;
+    /// The first marker is moved on by begin(), so is mutable.
+    mutable bucket_t* first;
     bucket_t* last;
 
     /// The function that creates the hashes.
@@ -1243,7 +1399,7 @@ namespace etl
   public:
 
     static const size_t MAX_SIZE = MAX_SIZE_;
-    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static const size_t MAX_BUCKETS = etl::private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
 
     //*************************************************************************
@@ -1277,6 +1433,17 @@ namespace etl
       base::assign(first_, last_);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_multiset(unordered_multiset&& other)
+      : base(node_pool, buckets, MAX_BUCKETS)
+    {
+      base::move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1299,13 +1466,29 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_multiset& operator = (unordered_multiset&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_multiset.
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS];
   };
 }
 
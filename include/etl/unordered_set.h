@@ -44,6 +44,7 @@ SOFTWARE.
 #include "vector.h"
 #include "intrusive_forward_list.h"
 #include "hash.h"
+#include "functional.h"
 #include "type_traits.h"
 #include "parameter_type.h"
 #include "nullptr.h"
@@ -51,6 +52,7 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
+#include "private/unordered_hash.h"
 
 #undef ETL_FILE
 #define ETL_FILE "23"
@@ -134,6 +136,9 @@ namespace etl
     typedef TKeyEqual         key_equal;
     typedef value_type&       reference;
     typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
     typedef value_type*       pointer;
     typedef const value_type* const_pointer;
     typedef size_t            size_type;
@@ -143,7 +148,7 @@ namespace etl
     typedef etl::forward_link<0> link_t;
 
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public etl::private_unordered::node_hash
     {
       node_t(const value_type& key_)
         : key(key_)
@@ -482,7 +487,9 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator(pbuckets + number_of_buckets, first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -491,7 +498,9 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -500,7 +509,9 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      bucket_t* pbucket = get_first_bucket();
+
+      return const_iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
     }
 
     //*********************************************************************
@@ -590,7 +601,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return etl::private_unordered::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -658,7 +669,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -669,6 +681,7 @@ namespace etl
       {
         // Get a new node.
         node_t& node = *pnodepool->allocate<node_t>();
+        node.set_hash(hash);
         ::new (&node.key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -689,7 +702,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (inode->key == key)
+          if (node_matches(*inode, hash, key))
           {
             break;
           }
@@ -703,6 +716,7 @@ namespace etl
         {
           // Get a new node.
           node_t& node = *pnodepool->allocate<node_t>();
+          node.set_hash(hash);
           ::new (&node.key) value_type(key);
           ETL_INCREMENT_DEBUG_COUNT;
 
@@ -729,6 +743,102 @@ namespace etl
       return insert(key).first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the unordered_set.
+    /// The value is left untouched if it is already in the unordered_set.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      iterator itr = find(key);
+
+      if (itr != end())
+      {
+        return std::pair<iterator, bool>(itr, false);
+      }
+
+      return emplace(std::move(key));
+    }
+
+    //*********************************************************************
+    /// Moves a value in to the unordered_set.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference key)
+    {
+      return insert(std::move(key)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// If the value is already in the unordered_set the new one is discarded.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is full and the value is not in it.
+    ///\param args The arguments to construct the value from.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args && ... args)
+    {
+      if (full())
+      {
+        // There is no free node to build the value in, but it may
+        // already be in the unordered_set, so look it up before asserting.
+        const value_type value(std::forward<Args>(args)...);
+        iterator itr = find(value);
+
+        ETL_ASSERT(itr != end(), ETL_ERROR(unordered_set_full));
+
+        return std::pair<iterator, bool>(itr, false);
+      }
+
+      // Get a new node.
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      const key_type& key = node.key;
+
+      // Get the hash index.
+      const size_t hash = key_hash_function(key);
+      node.set_hash(hash);
+
+      bucket_t* pbucket = pbuckets + etl::private_unordered::bucket_index(hash, number_of_buckets);
+      bucket_t& bucket = *pbucket;
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (node_matches(*inode, hash, key))
+        {
+          // Discard the new node.
+          node.key.~value_type();
+          pnodepool->release(&node);
+          ETL_DECREMENT_DEBUG_COUNT;
+
+          return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode), false);
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      // Add the node to the end of the bucket.
+      bucket.insert_after(inode_previous, node);
+      ++inode_previous;
+
+      adjust_first_last_markers(pbucket);
+
+      return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode_previous), true);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the unordered_set.
     /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set does not have enough free space.
@@ -753,7 +863,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[index];
 
@@ -761,7 +872,7 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (icurrent->key != key))
+      while ((icurrent != bucket.end()) && !node_matches(*icurrent, hash, key))
       {
         ++iprevious;
         ++icurrent;
@@ -888,7 +999,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -903,7 +1015,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (node_matches(*inode, hash, key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -922,7 +1034,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -937,7 +1050,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (node_matches(*inode, hash, key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -991,6 +1104,139 @@ namespace etl
       return std::pair<const_iterator, const_iterator>(f, l);
     }
 
+    //*********************************************************************
+    /// Counts an element, using a key of another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, size_t>::type
+      count(const TOtherKey& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, iterator>::type
+      find(const TOtherKey& key)
+    {
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_matches(*inode, hash, key))
+          {
+            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Finds an element, using a key of another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, const_iterator>::type
+      find(const TOtherKey& key) const
+    {
+      const size_t hash = key_hash_function(key);
+      size_t index = etl::private_unordered::bucket_index(hash, number_of_buckets);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_matches(*inode, hash, key))
+          {
+            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of
+    /// another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, std::pair<iterator, iterator> >::type
+      equal_range(const TOtherKey& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of
+    /// another type.
+    /// Only available if the hash and key equality functions are both transparent.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename TOtherKey>
+    typename private_functional::enable_if_transparent<hasher, key_equal, TOtherKey, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const TOtherKey& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<const_iterator, const_iterator>(f, l);
+    }
+
     //*************************************************************************
     /// Gets the size of the unordered_set.
     //*************************************************************************
@@ -1073,6 +1319,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_set& operator = (iunordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1123,8 +1385,48 @@ namespace etl
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves the elements of another unordered_set in to this one, leaving it empty.
+    /// The nodes live in each unordered_set's own pool, so the values are moved one by one.
+    //*********************************************************************
+    void move_container(iunordered_set&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= max_size(), ETL_ERROR(unordered_set_full));
+
+      initialise();
+
+      iterator itr = rhs.begin();
+
+      while (itr != rhs.end())
+      {
+        emplace(std::move(*itr));
+        ++itr;
+      }
+
+      rhs.initialise();
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Gets the first bucket that is not empty.
+    /// Erase does not move the first marker on, so it may point to empty
+    /// buckets before the first used one. They are skipped here and the
+    /// marker is moved past them, so each is only skipped once between
+    /// inserts and begin() is amortised constant time.
+    //*********************************************************************
+    bucket_t* get_first_bucket() const
+    {
+      while ((first != last) && first->empty())
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1140,6 +1442,17 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Checks whether a node holds a key.
+    /// If the hash is stored in the node then most other keys are rejected
+    /// without calling the key equality function.
+    //*********************************************************************
+    template <typename TOtherKey>
+    bool node_matches(const node_t& node, size_t hash, const TOtherKey& key) const
+    {
+      return node.hash_matches(hash) && key_equal_function(key, node.key);
+    }
+
     // Disable copy construction.
     iunordered_set(const iunordered_set&);
 
@@ -1153,7 +1466,8 @@ namespace etl
     const size_t number_of_buckets;
 
     /// The first and last iterators to buckets with values.
-    bucket_t* first;
+    /// The first marker is moved on by begin(), so is mutable.
+    mutable bucket_t* first;
     bucket_t* last;
 
     /// The function that creates the hashes.
@@ -1220,7 +1534,7 @@ namespace etl
   public:
 
     static const size_t MAX_SIZE    = MAX_SIZE_;
-    static const size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static const size_t MAX_BUCKETS = etl::private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
@@ -1253,6 +1567,17 @@ namespace etl
       base::assign(first_, last_);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_set(unordered_set&& other)
+      : base(node_pool, buckets, MAX_BUCKETS)
+    {
+      base::move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1275,13 +1600,29 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_set& operator = (unordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_set.
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS];
   };
 }
 
@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_VARIANT_INCLUDED
 
 #include <stdint.h>
+#include <utility>
 
 #include "platform.h"
 #include "array.h"
@@ -711,6 +712,27 @@ namespace etl
       type_id = other.type_id;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Constructor from a moved value of one of the supported types.
+    //***************************************************************************
+    template <typename T, typename = typename etl::enable_if<Type_Is_Supported<T>::value>::type>
+    variant(T&& value)
+    {
+      ::new (static_cast<T*>(data)) T(std::move(value));
+      type_id = Type_Id_Lookup<T>::type_id;
+    }
+
+    //***************************************************************************
+    /// Move constructor.
+    ///\param other The other variant object to move from.
+    //***************************************************************************
+    variant(variant&& other)
+    {
+      move_construct(std::move(other));
+    }
+#endif
+
 #if !ETL_CPP11_SUPPORTED
     //***************************************************************************
     /// Emplace with one constructor parameter.
@@ -834,6 +856,37 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Move assignment operator for one of the supported types.
+    ///\param value The value to move from.
+    //***************************************************************************
+    template <typename T, typename = typename etl::enable_if<Type_Is_Supported<T>::value>::type>
+    variant& operator =(T&& value)
+    {
+      destruct_current();
+      ::new (static_cast<T*>(data)) T(std::move(value));
+      type_id = Type_Id_Lookup<T>::type_id;
+
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Move assignment operator for variant type.
+    ///\param other The variant to move from.
+    //***************************************************************************
+    variant& operator =(variant&& other)
+    {
+      if (this != &other)
+      {
+        destruct_current();
+        move_construct(std::move(other));
+      }
+
+      return *this;
+    }
+#endif
+
     //***************************************************************************
     /// Checks if the type is the same as the current stored type.
     /// For variants with the same type declarations.
@@ -1018,6 +1071,30 @@ namespace etl
       type_id = UNSUPPORTED_TYPE_ID;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Move constructs the occupant of another variant.
+    /// There must be no current occupant.
+    //***************************************************************************
+    void move_construct(variant&& other)
+    {
+      switch (other.type_id)
+      {
+        case 0:  ::new (static_cast<T1*>(data)) T1(std::move(other.get<T1>())); break;
+        case 1:  ::new (static_cast<T2*>(data)) T2(std::move(other.get<T2>())); break;
+        case 2:  ::new (static_cast<T3*>(data)) T3(std::move(other.get<T3>())); break;
+        case 3:  ::new (static_cast<T4*>(data)) T4(std::move(other.get<T4>())); break;
+        case 4:  ::new (static_cast<T5*>(data)) T5(std::move(other.get<T5>())); break;
+        case 5:  ::new (static_cast<T6*>(data)) T6(std::move(other.get<T6>())); break;
+        case 6:  ::new (static_cast<T7*>(data)) T7(std::move(other.get<T7>())); break;
+        case 7:  ::new (static_cast<T8*>(data)) T8(std::move(other.get<T8>())); break;
+        default: break;
+      }
+
+      type_id = other.type_id;
+    }
+#endif
+
     //***************************************************************************
     /// The internal storage.
     /// Aligned on a suitable boundary, which should be good for all types.
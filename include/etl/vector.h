@@ -35,9 +35,11 @@ SOFTWARE.
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include <stddef.h>
 
 #include "platform.h"
@@ -90,6 +92,9 @@ namespace etl
     typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
     typedef size_t                                size_type;
     typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                                   rvalue_reference;
+#endif
 
   protected:
 
@@ -369,7 +374,7 @@ namespace etl
       initialise();
 
       p_end = etl::uninitialized_copy(first, last, p_buffer);
-      ETL_ADD_DEBUG_COUNT(uint32_t(std::distance(first, last)));
+      ETL_ADD_DEBUG_COUNT(int32_t(std::distance(first, last)));
     }
 
     //*********************************************************************
@@ -385,7 +390,7 @@ namespace etl
       initialise();
 
       p_end = etl::uninitialized_fill_n(p_buffer, n, value);
-      ETL_ADD_DEBUG_COUNT(uint32_t(n));
+      ETL_ADD_DEBUG_COUNT(int32_t(n));
     }
 
     //*************************************************************************
@@ -414,7 +419,7 @@ namespace etl
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
     ///\param value The value to add.
     //*********************************************************************
-    void push_back(parameter_t value)
+    void push_back(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
@@ -422,6 +427,38 @@ namespace etl
       create_back(value);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value to the end of the vector.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(rvalue_reference value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+      create_back(std::move(value));
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    ///\param args The arguments to the constructor.
+    //*********************************************************************
+    template <typename ... Args>
+    void emplace_back(Args && ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+      ::new (p_end) T(std::forward<Args>(args)...);
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#else
     //*********************************************************************
     /// Constructs a value at the end of the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -485,6 +522,7 @@ namespace etl
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
     }
+#endif
 
     //*************************************************************************
     /// Removes an element from the end of the vector.
@@ -504,7 +542,7 @@ namespace etl
     ///\param position The position to insert before.
     ///\param value    The value to insert.
     //*********************************************************************
-    iterator insert(iterator position, parameter_t value)
+    iterator insert(iterator position, const_reference value)
     {
       ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
 
@@ -514,14 +552,90 @@ namespace etl
       }
       else
       {
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
-        *position = value;
+        // The value may be an element of this vector, which the shift would move.
+        const T copy(value);
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          open_gap(position);
+          ::new (position) T(copy);
+        }
+        else
+        {
+          create_back(back());
+          std::copy_backward(position, p_end - 1, p_end);
+          *position = copy;
+        }
       }
 
       return position;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value in to the vector.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    ///\param position The position to insert before.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator position, rvalue_reference value)
+    {
+      ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
+
+      if (position == end())
+      {
+        create_back(std::move(value));
+      }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position);
+        ::new (position) T(std::move(value));
+      }
+      else
+      {
+        create_back(std::move(back()));
+        std::move_backward(position, p_end - 2, p_end - 1);
+        *position = std::move(value);
+      }
+
+      return position;
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Emplaces a value to the vector at the specified position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(iterator position, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+
+      void* p;
+
+      if (position == end())
+      {
+        p = p_end++;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position);
+        open_gap(position);
+      }
+      else
+      {
+        p = etl::addressof(*position);
+        create_back(std::move(back()));
+        std::move_backward(position, p_end - 2, p_end - 1);
+        (*position).~T();
+      }
+
+      ::new (p) T(std::forward<Args>(args)...);
+
+      return position;
+    }
+#else
     //*************************************************************************
     /// Emplaces a value to the vextor at the specified position.
     //*************************************************************************
@@ -537,6 +651,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position);
+        open_gap(position);
+      }
       else
       {
         p = etl::addressof(*position);
@@ -565,6 +684,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position);
+        open_gap(position);
+      }
       else
       {
         p = etl::addressof(*position);
@@ -593,6 +717,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position);
+        open_gap(position);
+      }
       else
       {
         p = etl::addressof(*position);
@@ -621,6 +750,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position);
+        open_gap(position);
+      }
       else
       {
         p = etl::addressof(*position);
@@ -633,6 +767,7 @@ namespace etl
 
       return position;
     }
+#endif
 
     //*********************************************************************
     /// Inserts 'n' values to the vector.
@@ -751,8 +886,16 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element);
+        close_gap(i_element, 1);
+      }
+      else
+      {
+        std::copy(i_element + 1, end(), i_element);
+        destroy_back();
+      }
 
       return i_element;
     }
@@ -771,6 +914,11 @@ namespace etl
       {
         clear();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy(first, last);
+        close_gap(first, std::distance(first, last));
+      }
       else
       {
         std::copy(last, end(), first);
@@ -798,6 +946,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    /// The elements are moved, as the storage cannot be exchanged.
+    //*************************************************************************
+    ivector& operator = (ivector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the vector.
     ///\return The current size of the vector.
@@ -864,6 +1028,26 @@ namespace etl
       p_end = p_buffer;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Replaces the contents with the moved elements of 'rhs', leaving 'rhs'
+    /// empty.
+    //*************************************************************************
+    void move_container(ivector&& rhs)
+    {
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(vector_full));
+
+      clear();
+
+      for (iterator itr = rhs.begin(); itr != rhs.end(); ++itr)
+      {
+        create_back(std::move(*itr));
+      }
+
+      rhs.initialise();
+    }
+#endif
+
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
     //*************************************************************************
@@ -893,7 +1077,7 @@ namespace etl
     //*********************************************************************
     /// Create a new element with a value at the back
     //*********************************************************************
-    inline void create_back(parameter_t value)
+    inline void create_back(const_reference value)
     {
       etl::create_copy_at(p_end, value);
       ETL_INCREMENT_DEBUG_COUNT;
@@ -901,6 +1085,19 @@ namespace etl
       ++p_end;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Create a new element with a moved value at the back
+    //*********************************************************************
+    inline void create_back(rvalue_reference value)
+    {
+      ::new (p_end) T(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      ++p_end;
+    }
+#endif
+
     //*********************************************************************
     /// Destroy an element at the back.
     //*********************************************************************
@@ -912,6 +1109,30 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Relocates the elements from 'position' one place towards the back,
+    /// leaving unconstructed storage at 'position'.
+    /// Only for trivially relocatable types.
+    //*********************************************************************
+    void open_gap(iterator position)
+    {
+      memmove(static_cast<void*>(position + 1), static_cast<const void*>(position), (p_end - position) * sizeof(T));
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Relocates the elements after the 'n' destroyed elements at 'position'
+    /// down to fill the gap.
+    /// Only for trivially relocatable types.
+    //*********************************************************************
+    void close_gap(iterator position, size_t n)
+    {
+      memmove(static_cast<void*>(position), static_cast<const void*>(position + n), (p_end - (position + n)) * sizeof(T));
+      p_end -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+    }
+
     // Disable copy construction.
     ivector(const ivector&);
 
@@ -1087,6 +1308,17 @@ namespace etl
       this->assign(other.begin(), other.end());
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    vector(vector&& other)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1108,6 +1340,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    vector& operator = (vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
     //*************************************************************************
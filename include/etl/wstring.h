@@ -208,24 +208,9 @@ namespace etl
   /// Hash function.
   //*************************************************************************
 #if ETL_8BIT_SUPPORT
-  template <>
-  struct hash<etl::iwstring>
-  {
-    size_t operator()(const etl::iwstring& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
-  };
-
   template <const size_t SIZE>
-  struct hash<etl::wstring<SIZE> >
+  struct hash<etl::wstring<SIZE> > : public etl::private_hash::text_hash<wchar_t>
   {
-    size_t operator()(const etl::wstring<SIZE>& text) const
-    {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                         reinterpret_cast<const uint8_t*>(&text[text.size()]));
-    }
   };
 #endif
 }
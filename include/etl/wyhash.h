@@ -0,0 +1,367 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <iterator>
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#if defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+  #include <intrin.h>
+#endif
+
+///\defgroup wyhash wyhash 64 bit hash calculation
+/// A streaming implementation of wyhash (final version 4).
+/// See https://github.com/wangyi-fudan/wyhash for more details.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The full 128 bit product of a and b.
+    /// The low half is returned in a and the high half in b.
+    //*************************************************************************
+    inline void multiply(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      uint128_t r = uint128_t(a) * b;
+
+      a = uint64_t(r);
+      b = uint64_t(r >> 64U);
+#elif defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+      a = _umul128(a, b, &b);
+#else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = uint32_t(a);
+      const uint64_t lb = uint32_t(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+#endif
+    }
+
+    //*************************************************************************
+    /// Multiplies and folds the 128 bit product.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Little endian reads from any alignment.
+    //*************************************************************************
+    inline uint64_t read_32(const uint8_t* p)
+    {
+      return  uint64_t(p[0])         | (uint64_t(p[1]) << 8U) |
+             (uint64_t(p[2]) << 16U) | (uint64_t(p[3]) << 24U);
+    }
+
+    inline uint64_t read_64(const uint8_t* p)
+    {
+      return read_32(p) | (read_32(p + 4U) << 32U);
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read_3(const uint8_t* p, size_t length)
+    {
+      return (uint64_t(p[0]) << 16U) | (uint64_t(p[length >> 1U]) << 8U) | uint64_t(p[length - 1U]);
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the wyhash 64 bit hash.
+  /// The result is the same as the one shot reference function, however the
+  /// data is split between calls to 'add'.
+  /// Data given by pointers is read directly, 48 bytes at a time.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    wyhash(value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    wyhash(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      state[0]   = seed ^ private_wyhash::mix(seed ^ SECRET0, SECRET1);
+      state[1]   = state[0];
+      state[2]   = state[0];
+      char_count = 0;
+      block_fill = 0;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      STATIC_ASSERT(sizeof(typename std::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      add_range(begin, end, typename etl::is_pointer<TIterator>::type());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // A full block is only added once more data follows it.
+      if (block_fill == BLOCK)
+      {
+        add_buffered_block();
+      }
+
+      buffer[HISTORY + block_fill] = value_;
+      ++block_fill;
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    /// More data may be added afterwards.
+    //*************************************************************************
+    value_type value() const
+    {
+      const uint8_t* p      = buffer + HISTORY;
+      size_t         length = block_fill;
+      uint64_t       s      = state[0];
+      uint64_t       a;
+      uint64_t       b;
+
+      if (char_count <= 16U)
+      {
+        if (length >= 4U)
+        {
+          const size_t offset = (length >> 3U) << 2U;
+
+          a = (private_wyhash::read_32(p) << 32U)               | private_wyhash::read_32(p + offset);
+          b = (private_wyhash::read_32(p + length - 4U) << 32U) | private_wyhash::read_32(p + length - 4U - offset);
+        }
+        else if (length > 0U)
+        {
+          a = private_wyhash::read_3(p, length);
+          b = 0U;
+        }
+        else
+        {
+          a = 0U;
+          b = 0U;
+        }
+      }
+      else
+      {
+        if (char_count > BLOCK)
+        {
+          s ^= state[1] ^ state[2];
+        }
+
+        while (length > 16U)
+        {
+          s = private_wyhash::mix(private_wyhash::read_64(p) ^ SECRET1, private_wyhash::read_64(p + 8U) ^ s);
+          p      += 16U;
+          length -= 16U;
+        }
+
+        // May reach back in to the previous block's history.
+        a = private_wyhash::read_64(p + length - 16U);
+        b = private_wyhash::read_64(p + length - 8U);
+      }
+
+      a ^= SECRET1;
+      b ^= s;
+      private_wyhash::multiply(a, b);
+
+      return private_wyhash::mix(a ^ SECRET0 ^ uint64_t(char_count), b ^ SECRET1);
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    /// Tops up the buffered block, then reads whole blocks directly from the
+    /// range, always keeping back at least one byte for 'value'.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* data   = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = static_cast<size_t>(end - begin);
+
+      size_t n = BLOCK - block_fill;
+
+      if (n > length)
+      {
+        n = length;
+      }
+
+      memcpy(buffer + HISTORY + block_fill, data, n);
+      block_fill += n;
+      char_count += n;
+      data       += n;
+      length     -= n;
+
+      if (length != 0U)
+      {
+        add_buffered_block();
+
+        if (length > BLOCK)
+        {
+          do
+          {
+            add_block(data);
+            data       += BLOCK;
+            length     -= BLOCK;
+            char_count += BLOCK;
+          } while (length > BLOCK);
+
+          memcpy(buffer, data - HISTORY, HISTORY);
+        }
+
+        memcpy(buffer + HISTORY, data, length);
+        block_fill  = length;
+        char_count += length;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a 48 byte block.
+    //*************************************************************************
+    void add_block(const uint8_t* p)
+    {
+      state[0] = private_wyhash::mix(private_wyhash::read_64(p)       ^ SECRET1, private_wyhash::read_64(p + 8U)  ^ state[0]);
+      state[1] = private_wyhash::mix(private_wyhash::read_64(p + 16U) ^ SECRET2, private_wyhash::read_64(p + 24U) ^ state[1]);
+      state[2] = private_wyhash::mix(private_wyhash::read_64(p + 32U) ^ SECRET3, private_wyhash::read_64(p + 40U) ^ state[2]);
+    }
+
+    //*************************************************************************
+    /// Adds the buffered block and keeps its last 16 bytes.
+    //*************************************************************************
+    void add_buffered_block()
+    {
+      add_block(buffer + HISTORY);
+      memcpy(buffer, buffer + BLOCK, HISTORY);
+      block_fill = 0;
+    }
+
+    static const size_t   BLOCK   = 48U;
+    static const size_t   HISTORY = 16U;
+
+    static const uint64_t SECRET0 = 0x2D358DCCAA6C78A5ULL;
+    static const uint64_t SECRET1 = 0x8BB84B93962EACC9ULL;
+    static const uint64_t SECRET2 = 0x4B33A62ED433D4A3ULL;
+    static const uint64_t SECRET3 = 0x4D5A2DA51DE1AA47ULL;
+
+    uint64_t   state[3];
+    size_t     char_count;
+    size_t     block_fill;
+    uint8_t    buffer[HISTORY + BLOCK];
+    value_type seed;
+  };
+}
+
+#endif
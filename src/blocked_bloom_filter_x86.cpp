@@ -0,0 +1,163 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "blocked_bloom_filter.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define ETL_BLOOM_FILTER_X86_TARGET
+
+  #if defined(ETL_COMPILER_MICROSOFT)
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+
+  #include "private/blocked_bloom_filter_x86.h"
+#endif
+
+#if defined(ETL_BLOOM_FILTER_X86_TARGET)
+namespace
+{
+  //***************************************************************************
+  /// CPUID feature bits.
+  //***************************************************************************
+  const uint32_t CPUID_1_ECX_OSXSAVE = (1UL << 27);
+  const uint32_t CPUID_1_ECX_AVX     = (1UL << 28);
+  const uint32_t CPUID_7_EBX_AVX2    = (1UL << 5);
+  const uint32_t XCR0_SSE_AVX        = 0x06; // The OS saves the XMM and YMM registers.
+
+  void cpuid(uint32_t leaf, uint32_t registers[4])
+  {
+#if defined(ETL_COMPILER_MICROSOFT)
+    int info[4];
+    __cpuidex(info, int(leaf), 0);
+
+    for (int i = 0; i < 4; ++i)
+    {
+      registers[i] = static_cast<uint32_t>(info[i]);
+    }
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if (leaf <= __get_cpuid_max(0, 0))
+    {
+      __cpuid_count(leaf, 0, eax, ebx, ecx, edx);
+    }
+
+    registers[0] = eax;
+    registers[1] = ebx;
+    registers[2] = ecx;
+    registers[3] = edx;
+#endif
+  }
+
+  uint32_t get_xcr0()
+  {
+#if defined(ETL_COMPILER_MICROSOFT)
+    return static_cast<uint32_t>(_xgetbv(0));
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return eax;
+#endif
+  }
+
+  bool get_has_avx2()
+  {
+    uint32_t registers[4];
+
+    cpuid(1, registers);
+
+    const uint32_t OSXSAVE_AVX = CPUID_1_ECX_OSXSAVE | CPUID_1_ECX_AVX;
+
+    if (((registers[2] & OSXSAVE_AVX) == OSXSAVE_AVX) && ((get_xcr0() & XCR0_SSE_AVX) == XCR0_SSE_AVX))
+    {
+      cpuid(7, registers);
+
+      return (registers[1] & CPUID_7_EBX_AVX2) != 0;
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  /// Read once at startup.
+  /// Any filter used before this is initialised uses the scalar code.
+  //***************************************************************************
+  const bool has_avx2 = get_has_avx2();
+}
+
+namespace etl
+{
+  namespace private_blocked_bloom_filter
+  {
+    //*************************************************************************
+    /// Sets one bit in each of the eight words of a block.
+    /// With AVX2 the eight bit masks are built with one 32 bit multiply per
+    /// lane and or-ed in with two 256 bit stores. The block must be 64 byte
+    /// aligned, which the filter's storage guarantees.
+    //*************************************************************************
+    void set_block_x86(uint64_t* block, uint32_t key)
+    {
+      if (has_avx2)
+      {
+        set_block_avx2(block, key);
+      }
+      else
+      {
+        set_block_scalar(block, key);
+      }
+    }
+
+    //*************************************************************************
+    /// Tests whether all eight of the key's bits are set in a block.
+    /// With AVX2 both halves of the block are checked with 'vptest', so there
+    /// is no early exit; the scalar code stops at the first clear bit.
+    /// The block must be 64 byte aligned.
+    //*************************************************************************
+    bool test_block_x86(const uint64_t* block, uint32_t key)
+    {
+      if (has_avx2)
+      {
+        return test_block_avx2(block, key);
+      }
+      else
+      {
+        return test_block_scalar(block, key);
+      }
+    }
+  }
+}
+#endif
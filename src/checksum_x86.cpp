@@ -0,0 +1,297 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "checksum.h"
+#include "private/checksum_x86.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define ETL_CHECKSUM_X86_TARGET
+
+  #if defined(ETL_COMPILER_MICROSOFT)
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+
+  #include <emmintrin.h> // SSE2
+  #include <immintrin.h> // AVX2
+
+  // GCC and Clang need the instruction set enabling per function.
+  #if defined(__GNUC__)
+    #define ETL_CHECKSUM_TARGET(features) __attribute__((target(features)))
+  #else
+    #define ETL_CHECKSUM_TARGET(features)
+  #endif
+#endif
+
+namespace
+{
+#if defined(ETL_CHECKSUM_X86_TARGET)
+  //***************************************************************************
+  /// Instruction sets.
+  //***************************************************************************
+  const uint32_t FEATURE_SSE2 = (1UL << 0);
+  const uint32_t FEATURE_AVX2 = (1UL << 1);
+
+  //***************************************************************************
+  /// CPUID feature bits.
+  //***************************************************************************
+  const uint32_t CPUID_1_EDX_SSE2    = (1UL << 26);
+  const uint32_t CPUID_1_ECX_OSXSAVE = (1UL << 27);
+  const uint32_t CPUID_1_ECX_AVX     = (1UL << 28);
+  const uint32_t CPUID_7_EBX_AVX2    = (1UL << 5);
+  const uint32_t XCR0_SSE_AVX        = 0x06; // The OS saves the XMM and YMM registers.
+
+  void cpuid(uint32_t leaf, uint32_t registers[4])
+  {
+#if defined(ETL_COMPILER_MICROSOFT)
+    int info[4];
+    __cpuidex(info, int(leaf), 0);
+
+    for (int i = 0; i < 4; ++i)
+    {
+      registers[i] = static_cast<uint32_t>(info[i]);
+    }
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if (leaf <= __get_cpuid_max(0, 0))
+    {
+      __cpuid_count(leaf, 0, eax, ebx, ecx, edx);
+    }
+
+    registers[0] = eax;
+    registers[1] = ebx;
+    registers[2] = ecx;
+    registers[3] = edx;
+#endif
+  }
+
+  uint32_t get_xcr0()
+  {
+#if defined(ETL_COMPILER_MICROSOFT)
+    return static_cast<uint32_t>(_xgetbv(0));
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return eax;
+#endif
+  }
+
+  uint32_t get_cpu_features()
+  {
+    uint32_t features = 0;
+    uint32_t registers[4];
+
+    cpuid(1, registers);
+
+    if ((registers[3] & CPUID_1_EDX_SSE2) != 0)
+    {
+      features |= FEATURE_SSE2;
+    }
+
+    const uint32_t OSXSAVE_AVX = CPUID_1_ECX_OSXSAVE | CPUID_1_ECX_AVX;
+
+    if (((registers[2] & OSXSAVE_AVX) == OSXSAVE_AVX) && ((get_xcr0() & XCR0_SSE_AVX) == XCR0_SSE_AVX))
+    {
+      cpuid(7, registers);
+
+      if ((registers[1] & CPUID_7_EBX_AVX2) != 0)
+      {
+        features |= FEATURE_AVX2;
+      }
+    }
+
+    return features;
+  }
+
+  //***************************************************************************
+  /// Read once at startup.
+  /// Any checksum calculated before this is initialised uses the portable code.
+  //***************************************************************************
+  const uint32_t cpu_features = get_cpu_features();
+
+  bool has_feature(uint32_t feature)
+  {
+    return (cpu_features & feature) != 0;
+  }
+
+  //***************************************************************************
+  /// Sum using SSE2. 'psadbw' against zero adds eight bytes into a 64 bit lane.
+  //***************************************************************************
+  ETL_CHECKSUM_TARGET("sse2")
+  uint64_t sum_sse2(const uint8_t* data, size_t length)
+  {
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i sum0 = zero;
+    __m128i sum1 = zero;
+
+    while (length >= 32)
+    {
+      sum0 = _mm_add_epi64(sum0, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), zero));
+      sum1 = _mm_add_epi64(sum1, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), zero));
+
+      data   += 32;
+      length -= 32;
+    }
+
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(sum0, sum1));
+
+    return lanes[0] + lanes[1] + etl::private_checksum::sum_block(data, length);
+  }
+
+  //***************************************************************************
+  /// Sum using AVX2.
+  //***************************************************************************
+  ETL_CHECKSUM_TARGET("avx2")
+  uint64_t sum_avx2(const uint8_t* data, size_t length)
+  {
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i sum0 = zero;
+    __m256i sum1 = zero;
+
+    while (length >= 64)
+    {
+      sum0 = _mm256_add_epi64(sum0, _mm256_sad_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), zero));
+      sum1 = _mm256_add_epi64(sum1, _mm256_sad_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)), zero));
+
+      data   += 64;
+      length -= 64;
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(sum0, sum1));
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + etl::private_checksum::sum_block(data, length);
+  }
+
+  //***************************************************************************
+  /// Xor using SSE2.
+  //***************************************************************************
+  ETL_CHECKSUM_TARGET("sse2")
+  uint8_t xor_sse2(const uint8_t* data, size_t length)
+  {
+    __m128i xor0 = _mm_setzero_si128();
+    __m128i xor1 = _mm_setzero_si128();
+
+    while (length >= 32)
+    {
+      xor0 = _mm_xor_si128(xor0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+      xor1 = _mm_xor_si128(xor1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)));
+
+      data   += 32;
+      length -= 32;
+    }
+
+    uint8_t lanes[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_xor_si128(xor0, xor1));
+
+    return etl::private_checksum::xor_block(lanes, sizeof(lanes)) ^ etl::private_checksum::xor_block(data, length);
+  }
+
+  //***************************************************************************
+  /// Xor using AVX2.
+  //***************************************************************************
+  ETL_CHECKSUM_TARGET("avx2")
+  uint8_t xor_avx2(const uint8_t* data, size_t length)
+  {
+    __m256i xor0 = _mm256_setzero_si256();
+    __m256i xor1 = _mm256_setzero_si256();
+
+    while (length >= 64)
+    {
+      xor0 = _mm256_xor_si256(xor0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
+      xor1 = _mm256_xor_si256(xor1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)));
+
+      data   += 64;
+      length -= 64;
+    }
+
+    uint8_t lanes[32];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_xor_si256(xor0, xor1));
+
+    return etl::private_checksum::xor_block(lanes, sizeof(lanes)) ^ etl::private_checksum::xor_block(data, length);
+  }
+#endif
+}
+
+namespace etl
+{
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// Sum
+    //*************************************************************************
+    uint64_t sum_x86(const uint8_t* data, size_t length)
+    {
+#if defined(ETL_CHECKSUM_X86_TARGET)
+      if ((length >= 64) && has_feature(FEATURE_AVX2))
+      {
+        return sum_avx2(data, length);
+      }
+
+      if ((length >= 32) && has_feature(FEATURE_SSE2))
+      {
+        return sum_sse2(data, length);
+      }
+#endif
+
+      return sum_block(data, length);
+    }
+
+    //*************************************************************************
+    /// Xor
+    //*************************************************************************
+    uint8_t xor_x86(const uint8_t* data, size_t length)
+    {
+#if defined(ETL_CHECKSUM_X86_TARGET)
+      if ((length >= 64) && has_feature(FEATURE_AVX2))
+      {
+        return xor_avx2(data, length);
+      }
+
+      if ((length >= 32) && has_feature(FEATURE_SSE2))
+      {
+        return xor_sse2(data, length);
+      }
+#endif
+
+      return xor_block(data, length);
+    }
+  }
+}
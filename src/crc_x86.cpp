@@ -0,0 +1,333 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "platform.h"
+#include "crc32.h"
+#include "crc32_c.h"
+#include "crc64_ecma.h"
+#include "private/crc_x86.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define ETL_CRC_X86_TARGET
+
+  #if defined(ETL_COMPILER_MICROSOFT)
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+
+  #include <tmmintrin.h> // SSSE3
+  #include <nmmintrin.h> // SSE4.2
+  #include <wmmintrin.h> // PCLMULQDQ
+
+  // GCC and Clang need the instruction set enabling per function.
+  #if defined(__GNUC__)
+    #define ETL_CRC_TARGET(features) __attribute__((target(features)))
+  #else
+    #define ETL_CRC_TARGET(features)
+  #endif
+#endif
+
+namespace
+{
+  //***************************************************************************
+  /// The software fallbacks.
+  //***************************************************************************
+  typedef etl::crc_policy<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, ETL_CRC_TABLE_SIZE> crc32_software_t;
+  typedef etl::crc_policy<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, ETL_CRC_TABLE_SIZE> crc32_c_software_t;
+  typedef etl::crc_policy<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, 0x0000000000000000, false, ETL_CRC_TABLE_SIZE> crc64_ecma_software_t;
+
+  uint32_t crc32_table(uint32_t crc, const uint8_t* data, size_t length)
+  {
+    return crc32_software_t().add_block(crc, data, length);
+  }
+
+  uint32_t crc32_c_table(uint32_t crc, const uint8_t* data, size_t length)
+  {
+    return crc32_c_software_t().add_block(crc, data, length);
+  }
+
+  uint64_t crc64_ecma_table(uint64_t crc, const uint8_t* data, size_t length)
+  {
+    return crc64_ecma_software_t().add_block(crc, data, length);
+  }
+
+#if defined(ETL_CRC_X86_TARGET)
+  //***************************************************************************
+  /// CPUID leaf 1, ECX feature bits.
+  //***************************************************************************
+  const uint32_t CPUID_PCLMULQDQ = (1UL << 1);
+  const uint32_t CPUID_SSSE3     = (1UL << 9);
+  const uint32_t CPUID_SSE4_2    = (1UL << 20);
+
+  uint32_t get_cpu_features()
+  {
+#if defined(ETL_COMPILER_MICROSOFT)
+    int info[4];
+    __cpuid(info, 1);
+
+    return static_cast<uint32_t>(info[2]);
+#else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+    {
+      return 0;
+    }
+
+    return ecx;
+#endif
+  }
+
+  //***************************************************************************
+  /// Read once at startup.
+  /// Any CRC calculated before this is initialised uses the table fallback.
+  //***************************************************************************
+  const uint32_t cpu_features = get_cpu_features();
+
+  bool has_features(uint32_t features)
+  {
+    return (cpu_features & features) == features;
+  }
+
+  //***************************************************************************
+  /// CRC32_C using the SSE4.2 'crc32' instruction.
+  //***************************************************************************
+  ETL_CRC_TARGET("sse4.2")
+  uint32_t crc32_c_sse42(uint32_t crc, const uint8_t* data, size_t length)
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t crc64 = crc;
+
+    while (length >= 8)
+    {
+      uint64_t value;
+      memcpy(&value, data, sizeof(value));
+      crc64 = _mm_crc32_u64(crc64, value);
+
+      data   += 8;
+      length -= 8;
+    }
+
+    crc = static_cast<uint32_t>(crc64);
+#endif
+
+    while (length >= 4)
+    {
+      uint32_t value;
+      memcpy(&value, data, sizeof(value));
+      crc = _mm_crc32_u32(crc, value);
+
+      data   += 4;
+      length -= 4;
+    }
+
+    while (length-- != 0)
+    {
+      crc = _mm_crc32_u8(crc, *data++);
+    }
+
+    return crc;
+  }
+
+  //***************************************************************************
+  /// Loads 16 bytes so that bit 127 is the first bit of the message.
+  /// Reflected CRCs already have the first bit in bit 0, so need no swap.
+  //***************************************************************************
+  template <bool REFLECTED>
+  ETL_CRC_TARGET("pclmul,ssse3")
+  inline __m128i load_16(const uint8_t* data)
+  {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+    if (!REFLECTED)
+    {
+      value = _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    }
+
+    return value;
+  }
+
+  //***************************************************************************
+  /// Multiplies the 128 bit value by x^d mod P, where k holds the constants for d.
+  //***************************************************************************
+  ETL_CRC_TARGET("pclmul,ssse3")
+  inline __m128i fold(__m128i value, __m128i k)
+  {
+    return _mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11));
+  }
+
+  //***************************************************************************
+  /// Folds a message, a multiple of 16 bytes and at least 64, down to 16 bytes
+  /// that have the same CRC from a zero initial value.
+  /// 'initial' is xored in to the start of the message.
+  /// The remainder is written in message byte order.
+  //***************************************************************************
+  template <bool REFLECTED>
+  ETL_CRC_TARGET("pclmul,ssse3")
+  void fold_to_16(const uint8_t* data, size_t length, __m128i initial, __m128i k512, __m128i k128, uint8_t* remainder)
+  {
+    // Four independent streams hide the latency of the multiplier.
+    __m128i x0 = _mm_xor_si128(load_16<REFLECTED>(data), initial);
+    __m128i x1 = load_16<REFLECTED>(data + 16);
+    __m128i x2 = load_16<REFLECTED>(data + 32);
+    __m128i x3 = load_16<REFLECTED>(data + 48);
+
+    data   += 64;
+    length -= 64;
+
+    while (length >= 64)
+    {
+      x0 = _mm_xor_si128(fold(x0, k512), load_16<REFLECTED>(data));
+      x1 = _mm_xor_si128(fold(x1, k512), load_16<REFLECTED>(data + 16));
+      x2 = _mm_xor_si128(fold(x2, k512), load_16<REFLECTED>(data + 32));
+      x3 = _mm_xor_si128(fold(x3, k512), load_16<REFLECTED>(data + 48));
+
+      data   += 64;
+      length -= 64;
+    }
+
+    // Combine the streams.
+    __m128i x = _mm_xor_si128(fold(x0, k128), x1);
+    x = _mm_xor_si128(fold(x, k128), x2);
+    x = _mm_xor_si128(fold(x, k128), x3);
+
+    while (length >= 16)
+    {
+      x = _mm_xor_si128(fold(x, k128), load_16<REFLECTED>(data));
+
+      data   += 16;
+      length -= 16;
+    }
+
+    if (!REFLECTED)
+    {
+      x = _mm_shuffle_epi8(x, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(remainder), x);
+  }
+
+  //***************************************************************************
+  /// CRC32 using PCLMULQDQ folding.
+  /// The constants are bit reflected x^(d-1) and x^(d+63) mod P for d = 512 and 128.
+  //***************************************************************************
+  ETL_CRC_TARGET("pclmul,ssse3")
+  uint32_t crc32_pclmul(uint32_t crc, const uint8_t* data, size_t length)
+  {
+    const __m128i k512 = _mm_set_epi64x(int64_t(0xCAD38E8F00000000ULL), int64_t(0x653D982200000000ULL));
+    const __m128i k128 = _mm_set_epi64x(int64_t(0x9BA54C6F00000000ULL), int64_t(0x65673B4600000000ULL));
+
+    const size_t folded = length & ~size_t(15);
+    uint8_t remainder[16];
+
+    fold_to_16<true>(data, folded, _mm_cvtsi32_si128(int(crc)), k512, k128, remainder);
+
+    crc = crc32_table(0, remainder, sizeof(remainder));
+
+    return crc32_table(crc, data + folded, length - folded);
+  }
+
+  //***************************************************************************
+  /// CRC64_ECMA using PCLMULQDQ folding.
+  /// The constants are x^(d+64) and x^d mod P for d = 512 and 128.
+  //***************************************************************************
+  ETL_CRC_TARGET("pclmul,ssse3")
+  uint64_t crc64_ecma_pclmul(uint64_t crc, const uint8_t* data, size_t length)
+  {
+    const __m128i k512 = _mm_set_epi64x(int64_t(0xDDF4B6981205B83FULL), int64_t(0x5F6843CA540DF020ULL));
+    const __m128i k128 = _mm_set_epi64x(int64_t(0x4EB938A7D257740EULL), int64_t(0x05F5C3C7EB52FAB6ULL));
+
+    const size_t folded = length & ~size_t(15);
+    uint8_t remainder[16];
+
+    fold_to_16<false>(data, folded, _mm_set_epi64x(int64_t(crc), 0), k512, k128, remainder);
+
+    crc = crc64_ecma_table(0, remainder, sizeof(remainder));
+
+    return crc64_ecma_table(crc, data + folded, length - folded);
+  }
+#endif
+}
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// CRC32
+    //*************************************************************************
+    uint32_t crc32_x86(uint32_t crc, const uint8_t* data, size_t length)
+    {
+#if defined(ETL_CRC_X86_TARGET)
+      if ((length >= 64) && has_features(CPUID_PCLMULQDQ | CPUID_SSSE3))
+      {
+        return crc32_pclmul(crc, data, length);
+      }
+#endif
+
+      return crc32_table(crc, data, length);
+    }
+
+    //*************************************************************************
+    /// CRC32_C
+    //*************************************************************************
+    uint32_t crc32_c_x86(uint32_t crc, const uint8_t* data, size_t length)
+    {
+#if defined(ETL_CRC_X86_TARGET)
+      if (has_features(CPUID_SSE4_2))
+      {
+        return crc32_c_sse42(crc, data, length);
+      }
+#endif
+
+      return crc32_c_table(crc, data, length);
+    }
+
+    //*************************************************************************
+    /// CRC64_ECMA
+    //*************************************************************************
+    uint64_t crc64_ecma_x86(uint64_t crc, const uint8_t* data, size_t length)
+    {
+#if defined(ETL_CRC_X86_TARGET)
+      if ((length >= 64) && has_features(CPUID_PCLMULQDQ | CPUID_SSSE3))
+      {
+        return crc64_ecma_pclmul(crc, data, length);
+      }
+#endif
+
+      return crc64_ecma_table(crc, data, length);
+    }
+  }
+}
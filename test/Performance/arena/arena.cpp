@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Per-request scratch memory for a tokeniser: token strings taken from an
+// arena and freed by one rewind, against strings taken from a pool and
+// released one by one, and against the heap.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl arena.cpp -o arena
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "arena.h"
+#include "pool.h"
+#include "vector.h"
+#include "cstring.h"
+
+const char   REQUEST[]  = "GET /index.html?user=someone&session=0123456789abcdef&lang=en HTTP/1.1";
+const size_t MAX_TOKENS = 16;
+const size_t MAX_TOKEN  = 32;
+const size_t LOOPS      = 1000000;
+
+volatile size_t sink;
+
+//*****************************************************************************
+// Calls 'add' for each token separated by ' ', '?', '&' or '='.
+template <typename TAdd>
+void Tokenise(TAdd& add)
+{
+  const char* begin = REQUEST;
+  const char* end   = REQUEST + sizeof(REQUEST) - 1;
+
+  while (begin != end)
+  {
+    const char* token_end = begin + strcspn(begin, " ?&=");
+
+    add(begin, token_end);
+
+    begin = (token_end == end) ? end : token_end + 1;
+  }
+}
+
+//*****************************************************************************
+etl::arena<(MAX_TOKENS * (MAX_TOKEN + 1)) + 1024> arena;
+
+struct ArenaAdd
+{
+  ArenaAdd()
+    : tokens(arena, MAX_TOKENS)
+  {
+  }
+
+  void operator()(const char* begin, const char* end)
+  {
+    etl::arena_string* p = arena.create<etl::arena_string>(arena, size_t(end - begin));
+    p->assign(begin, end);
+    tokens.push_back(p);
+  }
+
+  etl::arena_vector<etl::arena_string*> tokens;
+};
+
+double Arena()
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    etl::arena_scope scope(arena);
+
+    ArenaAdd add;
+    Tokenise(add);
+
+    sink = add.tokens.size() + add.tokens.back()->size();
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / LOOPS;
+}
+
+//*****************************************************************************
+typedef etl::string<MAX_TOKEN> Token;
+
+etl::pool<Token, MAX_TOKENS> pool;
+
+struct PoolAdd
+{
+  void operator()(const char* begin, const char* end)
+  {
+    tokens.push_back(pool.create<Token>(begin, size_t(end - begin)));
+  }
+
+  etl::vector<Token*, MAX_TOKENS> tokens;
+};
+
+double Pool()
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    PoolAdd add;
+    Tokenise(add);
+
+    sink = add.tokens.size() + add.tokens.back()->size();
+
+    for (size_t j = 0; j < add.tokens.size(); ++j)
+    {
+      pool.destroy<Token>(add.tokens[j]);
+    }
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / LOOPS;
+}
+
+//*****************************************************************************
+struct HeapAdd
+{
+  void operator()(const char* begin, const char* end)
+  {
+    tokens.push_back(std::string(begin, end));
+  }
+
+  std::vector<std::string> tokens;
+};
+
+double Heap()
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    HeapAdd add;
+    Tokenise(add);
+
+    sink = add.tokens.size() + add.tokens.back().size();
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / LOOPS;
+}
+
+int main()
+{
+  std::cout << "ns per request\n";
+  std::cout << "arena : " << std::setw(10) << Arena() << "\n";
+  std::cout << "pool  : " << std::setw(10) << Pool()  << "\n";
+  std::cout << "heap  : " << std::setw(10) << Heap()  << "\n";
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Allocate/release throughput of atomic_pool against a pool guarded by a
+// mutex, shared between 1 to N threads.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -pthread -I../.. -I../../../include/etl atomic_pool.cpp -o atomic_pool
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <mutex>
+
+#include "pool.h"
+#include "atomic_pool.h"
+
+struct Message
+{
+  uint32_t id;
+  uint8_t  data[28];
+};
+
+const size_t MAX_THREADS = 8;
+const size_t HELD        = 4;       // Items held by each thread at a time.
+const size_t LOOPS       = 1000000; // Per thread.
+
+etl::atomic_pool<Message, MAX_THREADS * HELD> atomic_pool;
+etl::pool<Message, MAX_THREADS * HELD>        locked_pool;
+std::mutex                                    mutex;
+
+//*****************************************************************************
+struct Atomic
+{
+  static Message* allocate()
+  {
+    return atomic_pool.allocate<Message>();
+  }
+
+  static void release(Message* p)
+  {
+    atomic_pool.release(p);
+  }
+};
+
+//*****************************************************************************
+struct Locked
+{
+  static Message* allocate()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return locked_pool.allocate<Message>();
+  }
+
+  static void release(Message* p)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    locked_pool.release(p);
+  }
+};
+
+//*****************************************************************************
+template <typename TPool>
+void Work()
+{
+  Message* items[HELD];
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    for (size_t j = 0; j < HELD; ++j)
+    {
+      items[j] = TPool::allocate();
+      items[j]->id = uint32_t(i);
+    }
+
+    for (size_t j = 0; j < HELD; ++j)
+    {
+      TPool::release(items[j]);
+    }
+  }
+}
+
+//*****************************************************************************
+template <typename TPool>
+double Run(size_t n_threads)
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  std::vector<std::thread> threads;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads.push_back(std::thread(&Work<TPool>));
+  }
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads[t].join();
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  // Nanoseconds per allocate/release pair, across all threads.
+  return time.count() * 1e9 / (n_threads * LOOPS * HELD);
+}
+
+int main()
+{
+  size_t max_threads = std::thread::hardware_concurrency();
+  max_threads = (max_threads == 0) ? 1 : max_threads;
+  max_threads = (max_threads > MAX_THREADS) ? MAX_THREADS : max_threads;
+
+  std::cout << "threads : atomic_pool   mutex + pool  (ns per allocate/release)\n";
+
+  for (size_t n = 1; n <= max_threads; n *= 2)
+  {
+    double atomic_time = Run<Atomic>(n);
+    double locked_time = Run<Locked>(n);
+
+    std::cout << std::setw(7)  << n << " : "
+              << std::setw(11) << atomic_time << "   "
+              << std::setw(12) << locked_time << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Burst allocate/release of packets: one item per call against allocate_n and
+// release_n, for pool, atomic_pool and bitmap_pool.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl bitmap_pool.cpp ../../../src/binary.cpp -o bitmap_pool
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+#include "pool.h"
+#include "atomic_pool.h"
+#include "bitmap_pool.h"
+
+struct Packet
+{
+  uint32_t id;
+  uint8_t  data[60];
+};
+
+const size_t POOL_SIZE = 256;
+const size_t BURST     = 32;
+const size_t LOOPS     = 200000;
+
+etl::pool<Packet, POOL_SIZE>        pool;
+etl::atomic_pool<Packet, POOL_SIZE> atomic_pool;
+etl::bitmap_pool<Packet, POOL_SIZE> bitmap_pool;
+
+Packet* burst[BURST];
+Packet* held[POOL_SIZE / 2];
+
+//*****************************************************************************
+// Half the pool is held, scattered, so that the free items are not in order.
+template <typename TPool>
+void Scatter(TPool& p)
+{
+  Packet* all[POOL_SIZE];
+
+  for (size_t i = 0; i < POOL_SIZE; ++i)
+  {
+    all[i] = p.template allocate<Packet>();
+  }
+
+  for (size_t i = 0; i < POOL_SIZE; ++i)
+  {
+    if ((i % 2) == 0)
+    {
+      held[i / 2] = all[i];
+    }
+    else
+    {
+      p.release(all[i]);
+    }
+  }
+}
+
+//*****************************************************************************
+template <typename TPool>
+double Single(TPool& p)
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    for (size_t j = 0; j < BURST; ++j)
+    {
+      burst[j] = p.template allocate<Packet>();
+      burst[j]->id = uint32_t(i);
+    }
+
+    for (size_t j = 0; j < BURST; ++j)
+    {
+      p.release(burst[j]);
+    }
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / (LOOPS * BURST);
+}
+
+//*****************************************************************************
+template <typename TPool>
+double Bulk(TPool& p)
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    p.template allocate_n<Packet>(burst, BURST);
+
+    for (size_t j = 0; j < BURST; ++j)
+    {
+      burst[j]->id = uint32_t(i);
+    }
+
+    p.release_n(burst, burst + BURST);
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / (LOOPS * BURST);
+}
+
+//*****************************************************************************
+template <typename TPool>
+void Report(const char* name, TPool& p)
+{
+  Scatter(p);
+
+  double single_time = Single(p);
+  double bulk_time   = Bulk(p);
+
+  std::cout << std::setw(12) << name << " : "
+            << std::setw(10) << single_time << "   "
+            << std::setw(10) << bulk_time << "\n";
+}
+
+int main()
+{
+  std::cout << "             :     single         bulk  (ns per allocate/release)\n";
+
+  Report("pool", pool);
+  Report("atomic_pool", atomic_pool);
+  Report("bitmap_pool", bitmap_pool);
+
+  return 0;
+}
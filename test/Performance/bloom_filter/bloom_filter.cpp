@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Query throughput of bloom_filter with three hashes against
+// blocked_bloom_filter, with single and batched queries, for a filter much
+// larger than the L2 cache.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl bloom_filter.cpp ../../../src/blocked_bloom_filter_x86.cpp -o bloom_filter
+//*****************************************************************************
+
+#define ETL_BLOOM_FILTER_HARDWARE_X86
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "bloom_filter.h"
+#include "blocked_bloom_filter.h"
+
+const size_t   WIDTH   = 64 * 1024 * 1024; // Bits
+const uint32_t KEYS    = 4 * 1024 * 1024;
+const uint32_t QUERIES = 8 * 1024 * 1024;
+
+//*****************************************************************************
+template <uint64_t SEED>
+struct key_hash
+{
+  typedef uint32_t argument_type;
+
+  size_t operator ()(uint32_t key) const
+  {
+    uint64_t hash = (key + SEED) * UINT64_C(0x9E3779B97F4A7C15);
+    return size_t(hash ^ (hash >> 29));
+  }
+};
+
+typedef etl::bloom_filter<WIDTH, key_hash<1>, key_hash<2>, key_hash<3> > Bloom;
+typedef etl::blocked_bloom_filter<WIDTH, key_hash<1> >                   Blocked;
+
+Bloom   bloom;
+Blocked blocked;
+
+std::vector<uint32_t> queries(QUERIES);
+std::vector<bool>     results(QUERIES);
+
+//*****************************************************************************
+void Report(const char* name, std::chrono::duration<double> time, size_t found)
+{
+  std::cout << std::setw(24) << name << " : "
+            << std::setw(8) << (time.count() * 1e9 / QUERIES) << " ns/query ("
+            << found << " found)\n";
+}
+
+int main()
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  // Half of the queries are keys that were added.
+  for (uint32_t i = 0; i < QUERIES; ++i)
+  {
+    queries[i] = (i * 2654435761U) % (2 * KEYS);
+  }
+
+  for (uint32_t key = 0; key < KEYS; ++key)
+  {
+    bloom.add(key);
+  }
+
+  std::vector<uint32_t> keys(KEYS);
+
+  for (uint32_t key = 0; key < KEYS; ++key)
+  {
+    keys[key] = key;
+  }
+
+  clock::time_point begin = clock::now();
+  blocked.add_batch(keys.begin(), keys.end());
+  std::chrono::duration<double> add_time = clock::now() - begin;
+
+  std::cout << "blocked add_batch : " << (add_time.count() * 1e9 / KEYS) << " ns/key\n";
+
+  size_t found = 0;
+  begin = clock::now();
+
+  for (uint32_t i = 0; i < QUERIES; ++i)
+  {
+    found += bloom.exists(queries[i]) ? 1 : 0;
+  }
+
+  Report("bloom_filter exists", clock::now() - begin, found);
+
+  found = 0;
+  begin = clock::now();
+
+  for (uint32_t i = 0; i < QUERIES; ++i)
+  {
+    found += blocked.exists(queries[i]) ? 1 : 0;
+  }
+
+  Report("blocked exists", clock::now() - begin, found);
+
+  begin = clock::now();
+  found = blocked.exists_batch(queries.begin(), queries.end(), results.begin());
+
+  Report("blocked exists_batch", clock::now() - begin, found);
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Lookup and in-order iteration time of btree_map against map, for a 50k
+// entry ordered index.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl btree_map.cpp ../../../src/binary.cpp -o btree_map
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "map.h"
+#include "btree_map.h"
+
+const size_t SIZE    = 50000;
+const size_t LOOKUPS = 10000000;
+const size_t SCANS   = 200;
+
+typedef etl::map<uint32_t, uint32_t, SIZE>       Avl;
+typedef etl::btree_map<uint32_t, uint32_t, SIZE> BTree;
+
+Avl   avl;
+BTree btree;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, const TMap& map, const std::vector<uint32_t>& keys)
+{
+  uint64_t sum = 0;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.lower_bound(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  std::chrono::duration<double> lookup_time = clock_type::now() - begin;
+
+  begin = clock_type::now();
+
+  for (size_t i = 0; i < SCANS; ++i)
+  {
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      sum += itr->second;
+    }
+  }
+
+  std::chrono::duration<double> scan_time = clock_type::now() - begin;
+
+  std::cout << std::setw(10) << name << " : "
+            << "lower_bound " << std::setw(8) << (lookup_time.count() * 1e9 / keys.size()) << " ns, "
+            << "iteration " << std::setw(8) << (scan_time.count() * 1e9 / (SCANS * map.size())) << " ns/element ("
+            << sum << ")\n";
+}
+
+int main()
+{
+  // Scattered keys, inserted in a scattered order.
+  std::vector<uint32_t> keys(SIZE);
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    keys[i] = uint32_t(i * 2654435761U);
+
+    avl.insert(std::make_pair(keys[i], uint32_t(i)));
+    btree.insert(std::make_pair(keys[i], uint32_t(i)));
+  }
+
+  std::vector<uint32_t> lookups(LOOKUPS);
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    lookups[i] = keys[(seed >> 8) % SIZE];
+  }
+
+  std::cout << "btree_map depth " << btree.depth() << "\n";
+
+  Run("map", avl, lookups);
+  Run("btree_map", btree, lookups);
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Checksum throughput: byte at a time versus the word at a time and x86 SIMD
+// block paths.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl checksum.cpp ../../../src/checksum_x86.cpp -o checksum
+//*****************************************************************************
+
+#define ETL_CHECKSUM_HARDWARE_X86
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "checksum.h"
+
+const size_t TESTSIZE        = 9 * 1024;
+const size_t TESTINTERATIONS = 20000;
+
+std::vector<uint8_t> data(TESTSIZE);
+
+//*****************************************************************************
+// Runs the test and reports the throughput in MB/s.
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* name, TFunction function)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  uint64_t result = 0;
+
+  clock::time_point begin = clock::now();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    result += function(data.data(), data.data() + data.size());
+  }
+
+  std::chrono::duration<double> time = clock::now() - begin;
+
+  double megabytes = double(TESTSIZE) * TESTINTERATIONS / (1024.0 * 1024.0);
+
+  std::cout << name << " : " << (megabytes / time.count()) << " MB/s (" << std::hex << result << std::dec << ")\n";
+}
+
+//*****************************************************************************
+// The original byte at a time loop.
+//*****************************************************************************
+template <typename TPolicy>
+typename TPolicy::value_type ByteLoop(const uint8_t* begin, const uint8_t* end)
+{
+  TPolicy policy;
+  typename TPolicy::value_type sum = policy.initial();
+
+  while (begin != end)
+  {
+    sum = policy.add(sum, *begin++);
+  }
+
+  return policy.final(sum);
+}
+
+//*****************************************************************************
+// The portable word at a time functions.
+//*****************************************************************************
+uint32_t WordSum(const uint8_t* begin, const uint8_t* end)
+{
+  return uint32_t(etl::private_checksum::sum_block(begin, size_t(end - begin)));
+}
+
+uint32_t WordXor(const uint8_t* begin, const uint8_t* end)
+{
+  return etl::private_checksum::xor_block(begin, size_t(end - begin));
+}
+
+//*****************************************************************************
+// The block path selected by etl::frame_check_sequence.
+//*****************************************************************************
+template <typename TChecksum>
+typename TChecksum::value_type Block(const uint8_t* begin, const uint8_t* end)
+{
+  return TChecksum(begin, end).value();
+}
+
+int main()
+{
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = uint8_t((i * 131) + (i >> 7));
+  }
+
+  Run("sum        byte    ", ByteLoop<etl::checksum_policy_sum<uint32_t> >);
+  Run("sum        word    ", WordSum);
+  Run("sum        hardware", Block<etl::checksum<uint32_t> >);
+  Run("xor        byte    ", ByteLoop<etl::checksum_policy_xor<uint32_t> >);
+  Run("xor        word    ", WordXor);
+  Run("xor        hardware", Block<etl::xor_checksum<uint32_t> >);
+  Run("xor_rotate byte    ", ByteLoop<etl::checksum_policy_xor_rotate<uint32_t> >);
+  Run("xor_rotate word    ", Block<etl::xor_rotate_checksum<uint32_t> >);
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Keyword lookup time of const_map against flat_map and unordered_map, for a
+// constant table of string_view keys.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++14 -I../.. -I../../../include/etl const_map.cpp ../../../src/binary.cpp -o const_map
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "const_map.h"
+#include "flat_map.h"
+#include "unordered_map.h"
+#include "string_view.h"
+#include "hash.h"
+
+const size_t SIZE    = 16;
+const size_t LOOKUPS = 10000000;
+
+typedef etl::const_map<etl::string_view, int, SIZE>     Const;
+typedef etl::flat_map<etl::string_view, int, SIZE>      Flat;
+typedef etl::unordered_map<etl::string_view, int, SIZE> Unordered;
+
+constexpr Const keywords({ { "if", 0 },      { "else", 1 },     { "while", 2 },    { "for", 3 },
+                           { "do", 4 },      { "return", 5 },   { "break", 6 },    { "continue", 7 },
+                           { "switch", 8 },  { "case", 9 },     { "default", 10 }, { "goto", 11 },
+                           { "struct", 12 }, { "union", 13 },   { "enum", 14 },    { "typedef", 15 } });
+
+Flat      flat;
+Unordered unordered;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, const TMap& map, const std::vector<etl::string_view>& keys)
+{
+  uint64_t sum = 0;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.find(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  std::chrono::duration<double> lookup_time = clock_type::now() - begin;
+
+  std::cout << std::setw(14) << name << " : "
+            << "find " << std::setw(8) << (lookup_time.count() * 1e9 / keys.size()) << " ns ("
+            << sum << ")\n";
+}
+
+int main()
+{
+  for (Const::const_iterator itr = keywords.begin(); itr != keywords.end(); ++itr)
+  {
+    flat.insert(std::make_pair(itr->first, itr->second));
+    unordered.insert(std::make_pair(itr->first, itr->second));
+  }
+
+  // One lookup in four misses.
+  const etl::string_view misses[] = { "iff", "whilst", "unit", "casey" };
+
+  std::vector<etl::string_view> lookups(LOOKUPS);
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+
+    const uint32_t r = seed >> 8;
+
+    lookups[i] = ((r & 3U) == 0U) ? misses[(r >> 2) & 3U] : keywords.begin()[(r >> 4) % SIZE].first;
+  }
+
+  Run("unordered_map", unordered, lookups);
+  Run("flat_map", flat, lookups);
+  Run("const_map", keywords, lookups);
+
+  return 0;
+}
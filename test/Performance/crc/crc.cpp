@@ -0,0 +1,102 @@
+//*****************************************************************************
+// CRC throughput: byte at a time versus the table sizes of etl::crc_type and
+// the x86 hardware paths.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl crc.cpp ../../../src/crc_x86.cpp -o crc
+//*****************************************************************************
+
+#define ETL_CRC_SLICE_BY_8
+#define ETL_CRC_HARDWARE_X86
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "crc32.h"
+#include "crc32_c.h"
+#include "crc64_ecma.h"
+#include "crc.h"
+
+const size_t TESTSIZE        = 9 * 1024;
+const size_t TESTINTERATIONS = 20000;
+
+std::vector<uint8_t> data(TESTSIZE);
+
+//*****************************************************************************
+// Runs the test and reports the throughput in MB/s.
+//*****************************************************************************
+template <typename TFunction>
+void Run(const char* name, TFunction function)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  uint64_t result = 0;
+
+  clock::time_point begin = clock::now();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    result += function(data.data(), data.data() + data.size());
+  }
+
+  std::chrono::duration<double> time = clock::now() - begin;
+
+  double megabytes = double(TESTSIZE) * TESTINTERATIONS / (1024.0 * 1024.0);
+
+  std::cout << name << " : " << (megabytes / time.count()) << " MB/s (" << std::hex << result << std::dec << ")\n";
+}
+
+//*****************************************************************************
+// The original byte at a time loop.
+//*****************************************************************************
+template <typename TPolicy>
+typename TPolicy::value_type ByteLoop(const uint8_t* begin, const uint8_t* end)
+{
+  TPolicy policy;
+  typename TPolicy::value_type crc = policy.initial();
+
+  while (begin != end)
+  {
+    crc = policy.add(crc, *begin++);
+  }
+
+  return policy.final(crc);
+}
+
+//*****************************************************************************
+// The block path selected by etl::frame_check_sequence.
+//*****************************************************************************
+template <typename TCrc>
+typename TCrc::value_type Block(const uint8_t* begin, const uint8_t* end)
+{
+  return TCrc(begin, end).value();
+}
+
+typedef etl::crc_type<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, 1024> crc32_slice_4;
+typedef etl::crc_type<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, 2048> crc32_slice_8;
+typedef etl::crc_type<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, 2048> crc32_c_slice_8;
+typedef etl::crc_type<64, 0x42F0E1EBA9EA3693ULL, 0, 0, false, 2048>       crc64_ecma_slice_8;
+
+int main()
+{
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = uint8_t(i * 131);
+  }
+
+  Run("crc32      byte    ", ByteLoop<etl::crc_policy_32>);
+  Run("crc32      slice 4 ", Block<crc32_slice_4>);
+  Run("crc32      slice 8 ", Block<crc32_slice_8>);
+  Run("crc32      hardware", Block<etl::crc32>);
+  Run("crc32_c    byte    ", ByteLoop<etl::crc_policy_32_c>);
+  Run("crc32_c    slice 8 ", Block<crc32_c_slice_8>);
+  Run("crc32_c    hardware", Block<etl::crc32_c>);
+  Run("crc64_ecma byte    ", ByteLoop<etl::crc_policy_64_ecma>);
+  Run("crc64_ecma slice 8 ", Block<crc64_ecma_slice_8>);
+  Run("crc64_ecma hardware", Block<etl::crc64_ecma>);
+
+  return 0;
+}
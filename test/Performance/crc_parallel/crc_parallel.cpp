@@ -0,0 +1,71 @@
+//*****************************************************************************
+// etl::crc_parallel throughput from one thread up to the number of cores.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -pthread -I../.. -I../../../include/etl crc_parallel.cpp ../../../src/crc_x86.cpp -o crc_parallel
+//*****************************************************************************
+
+#define ETL_CRC_SLICE_BY_8
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "crc32.h"
+#include "crc64_ecma.h"
+#include "crc_parallel.h"
+
+const size_t TESTSIZE        = 256 * 1024 * 1024;
+const size_t TESTINTERATIONS = 4;
+
+std::vector<uint8_t> data(TESTSIZE);
+
+//*****************************************************************************
+// Runs the test and reports the throughput in MB/s.
+//*****************************************************************************
+template <typename TCrc>
+void Run(const char* name, size_t threads)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  uint64_t result = 0;
+
+  clock::time_point begin = clock::now();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    result += etl::crc_parallel<TCrc>(data.data(), data.data() + data.size(), threads);
+  }
+
+  std::chrono::duration<double> time = clock::now() - begin;
+
+  double megabytes = double(TESTSIZE) * TESTINTERATIONS / (1024.0 * 1024.0);
+
+  std::cout << name << " " << threads << " threads : " << (megabytes / time.count()) << " MB/s (" << std::hex << result << std::dec << ")\n";
+}
+
+int main()
+{
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = uint8_t(i * 131);
+  }
+
+  size_t cores = std::thread::hardware_concurrency();
+
+  if (cores == 0)
+  {
+    cores = 1;
+  }
+
+  for (size_t threads = 1; threads <= cores; ++threads)
+  {
+    Run<etl::crc32>("crc32     ", threads);
+    Run<etl::crc64_ecma>("crc64_ecma", threads);
+  }
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+//*****************************************************************************
+// False positive rate and lookup throughput of cuckoo_filter against
+// bloom_filter, for filters using the same amount of memory.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl cuckoo_filter.cpp -o cuckoo_filter
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "bloom_filter.h"
+#include "cuckoo_filter.h"
+
+const uint32_t KEYS    = 1000000;
+const uint32_t QUERIES = 8 * 1024 * 1024;
+
+//*****************************************************************************
+template <uint64_t SEED>
+struct key_hash
+{
+  typedef uint32_t argument_type;
+
+  size_t operator ()(uint32_t key) const
+  {
+    uint64_t hash = (key + SEED) * UINT64_C(0x9E3779B97F4A7C15);
+    return size_t(hash ^ (hash >> 29));
+  }
+};
+
+typedef etl::cuckoo_filter<KEYS, 16, key_hash<1> > Cuckoo;
+
+// The same number of bits as the cuckoo filter's slots.
+typedef etl::bloom_filter<Cuckoo::NUMBER_OF_SLOTS * 16, key_hash<1>, key_hash<2>, key_hash<3> > Bloom;
+
+Cuckoo cuckoo;
+Bloom  bloom;
+
+std::vector<uint32_t> queries(QUERIES);
+
+//*****************************************************************************
+template <typename TFilter>
+void Run(const char* name, const TFilter& filter)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  // Keys at or above KEYS were never added.
+  size_t false_positives = 0;
+
+  for (uint32_t key = KEYS; key < (KEYS + 10000000); ++key)
+  {
+    false_positives += filter.exists(key) ? 1 : 0;
+  }
+
+  size_t found = 0;
+
+  clock::time_point begin = clock::now();
+
+  for (uint32_t i = 0; i < QUERIES; ++i)
+  {
+    found += filter.exists(queries[i]) ? 1 : 0;
+  }
+
+  std::chrono::duration<double> time = clock::now() - begin;
+
+  std::cout << std::setw(14) << name << " : "
+            << std::setw(10) << sizeof(TFilter) << " bytes "
+            << std::setw(10) << (100.0 * false_positives / 10000000.0) << " % false positives "
+            << std::setw(8) << (time.count() * 1e9 / QUERIES) << " ns/query ("
+            << found << " found)\n";
+}
+
+int main()
+{
+  // Half of the queries are keys that were added.
+  for (uint32_t i = 0; i < QUERIES; ++i)
+  {
+    queries[i] = (i * 2654435761U) % (2 * KEYS);
+  }
+
+  for (uint32_t key = 0; key < KEYS; ++key)
+  {
+    bloom.add(key);
+
+    if (!cuckoo.add(key))
+    {
+      std::cout << "cuckoo_filter full after " << key << " keys\n";
+      break;
+    }
+  }
+
+  std::cout << "cuckoo_filter load factor " << cuckoo.load_factor() << "\n";
+
+  Run("bloom_filter", bloom);
+  Run("cuckoo_filter", cuckoo);
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Time to reload flat containers with 20k unsorted entries, one insert at a
+// time against assign_unsorted.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl flat_bulk.cpp ../../../src/binary.cpp -o flat_bulk
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "flat_map.h"
+#include "flat_set.h"
+#include "reference_flat_map.h"
+
+const size_t SIZE    = 20000;
+const size_t RELOADS = 5;
+
+typedef etl::flat_map<uint32_t, uint32_t, SIZE>           Map;
+typedef etl::flat_set<uint32_t, SIZE>                     Set;
+typedef etl::reference_flat_map<uint32_t, uint32_t, SIZE> RefMap;
+
+Map    map;
+Set    set;
+RefMap ref_map;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+//*****************************************************************************
+template <typename TContainer, typename TIterator>
+void Run(const char* name, TContainer& container, TIterator first, TIterator last)
+{
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < RELOADS; ++i)
+  {
+    container.clear();
+    container.insert(first, last);
+  }
+
+  std::chrono::duration<double> insert_time = clock_type::now() - begin;
+
+  begin = clock_type::now();
+
+  for (size_t i = 0; i < RELOADS; ++i)
+  {
+    container.assign_unsorted(first, last);
+  }
+
+  std::chrono::duration<double> bulk_time = clock_type::now() - begin;
+
+  std::cout << std::setw(18) << name << " : "
+            << "insert " << std::setw(8) << (insert_time.count() * 1e3 / RELOADS) << " ms, "
+            << "assign_unsorted " << std::setw(8) << (bulk_time.count() * 1e3 / RELOADS) << " ms ("
+            << container.size() << ")\n";
+}
+
+int main()
+{
+  // Scattered keys.
+  std::vector<std::pair<const uint32_t, uint32_t> > elements;
+  std::vector<uint32_t> keys;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    uint32_t key = uint32_t(i * 2654435761U);
+
+    elements.push_back(std::make_pair(key, uint32_t(i)));
+    keys.push_back(key);
+  }
+
+  Run("flat_map", map, elements.begin(), elements.end());
+  Run("flat_set", set, keys.begin(), keys.end());
+  Run("reference_flat_map", ref_map, elements.begin(), elements.end());
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Lookup time of flat_map against reference_flat_map, for a read mostly
+// configuration table.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl flat_map.cpp ../../../src/binary.cpp -o flat_map
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "flat_map.h"
+#include "reference_flat_map.h"
+
+const size_t SIZE    = 4096;
+const size_t LOOKUPS = 10000000;
+
+struct Setting
+{
+  uint32_t value;
+  uint32_t flags;
+  char     name[24];
+};
+
+typedef std::pair<const uint32_t, Setting> Element;
+
+typedef etl::flat_map<uint32_t, Setting, SIZE> Flat;
+
+Flat flat;
+
+// The reference map only holds pointers, so the elements live in a separate array.
+etl::reference_flat_map<uint32_t, Setting, SIZE> reference;
+std::vector<Element> elements;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, const TMap& map, const std::vector<uint32_t>& keys)
+{
+  uint64_t sum = 0;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.find(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second.value;
+    }
+  }
+
+  std::chrono::duration<double> lookup_time = clock_type::now() - begin;
+
+  std::cout << std::setw(20) << name << " : "
+            << "find " << std::setw(8) << (lookup_time.count() * 1e9 / keys.size()) << " ns ("
+            << sum << ")\n";
+}
+
+int main()
+{
+  std::vector<uint32_t> keys(SIZE);
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    keys[i] = uint32_t(i * 2654435761U);
+
+    Setting setting = { uint32_t(i), 0, "" };
+    elements.push_back(Element(keys[i], setting));
+    flat.insert(elements.back());
+  }
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    reference.insert(elements[i]);
+  }
+
+  std::vector<uint32_t> lookups(LOOKUPS);
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    lookups[i] = keys[(seed >> 8) % SIZE];
+  }
+
+  Run("reference_flat_map", reference, lookups);
+  Run("flat_map", flat, lookups);
+
+  return 0;
+}
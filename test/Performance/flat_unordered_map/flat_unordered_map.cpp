@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Lookup time of flat_unordered_map against unordered_map, for 100k
+// entries, with keys that are found and keys that are not.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl flat_unordered_map.cpp ../../../src/binary.cpp -o flat_unordered_map
+//*****************************************************************************
+
+#define ETL_FLAT_HASH_HARDWARE_X86
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "unordered_map.h"
+#include "flat_unordered_map.h"
+
+const size_t SIZE    = 100000;
+const size_t LOOKUPS = 10000000;
+
+typedef etl::unordered_map<uint32_t, uint32_t, SIZE>    Chained;
+typedef etl::flat_unordered_map<uint32_t, uint32_t, SIZE> Flat;
+
+Chained chained;
+Flat    flat;
+
+std::vector<uint32_t> hits(LOOKUPS);
+std::vector<uint32_t> misses(LOOKUPS);
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, const TMap& map, const std::vector<uint32_t>& keys)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  uint64_t sum = 0;
+
+  clock::time_point begin = clock::now();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.find(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  std::chrono::duration<double> time = clock::now() - begin;
+
+  std::cout << std::setw(24) << name << " : "
+            << std::setw(8) << (time.count() * 1e9 / keys.size()) << " ns/lookup ("
+            << sum << ")\n";
+}
+
+int main()
+{
+  // Scattered keys, as symbol table hashes would be.
+  // An xorshift sequence, so there are no repeats. Multiples of a constant
+  // would be spread with no collisions at all by a multiplicative hash.
+  std::vector<uint32_t> keys(SIZE);
+  uint32_t key = 1;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    key ^= key << 13;
+    key ^= key >> 17;
+    key ^= key << 5;
+    keys[i] = key;
+
+    chained.insert(std::make_pair(keys[i], uint32_t(i)));
+    flat.insert(std::make_pair(keys[i], uint32_t(i)));
+  }
+
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    hits[i]   = keys[(seed >> 8) % SIZE];
+    misses[i] = hits[i] + 1;
+  }
+
+  Run("unordered_map hit", chained, hits);
+  Run("flat_unordered_map hit", flat, hits);
+  Run("unordered_map miss", chained, misses);
+  Run("flat_unordered_map miss", flat, misses);
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Hash throughput for key sizes from 4 bytes to 4 kilobytes.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl hash.cpp -o hash
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "fnv_1.h"
+#include "murmur3.h"
+#include "jenkins.h"
+#include "wyhash.h"
+
+const size_t TESTBYTES = 64 * 1024 * 1024;
+
+std::vector<uint8_t> data(8192);
+
+//*****************************************************************************
+// Hashes TESTBYTES bytes as keys of 'key_size' and reports the throughput in
+// MB/s and the time per key in ns.
+//*****************************************************************************
+template <typename THash>
+void Run(const char* name, size_t key_size)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  const size_t keys = TESTBYTES / key_size;
+
+  uint64_t result = 0;
+
+  clock::time_point begin = clock::now();
+
+  for (size_t i = 0; i < keys; ++i)
+  {
+    // Vary the start of the key so that the hash is not hoisted out of the loop.
+    const uint8_t* key = data.data() + (i & 63);
+
+    result += uint64_t(THash(key, key + key_size).value());
+  }
+
+  std::chrono::duration<double> time = clock::now() - begin;
+
+  double megabytes = double(keys * key_size) / (1024.0 * 1024.0);
+
+  std::cout << std::setw(10) << name << std::setw(6) << key_size << " bytes : "
+            << std::setw(10) << (megabytes / time.count()) << " MB/s "
+            << std::setw(8) << (time.count() * 1e9 / keys) << " ns/key ("
+            << std::hex << result << std::dec << ")\n";
+}
+
+int main()
+{
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = uint8_t((i * 131) + (i >> 7));
+  }
+
+  for (size_t key_size = 4; key_size <= 4096; key_size *= 4)
+  {
+    Run<etl::fnv_1a_64>("fnv_1a_64", key_size);
+    Run<etl::murmur3<uint32_t> >("murmur3", key_size);
+    Run<etl::jenkins>("jenkins", key_size);
+    Run<etl::wyhash>("wyhash", key_size);
+    std::cout << "\n";
+  }
+
+  return 0;
+}
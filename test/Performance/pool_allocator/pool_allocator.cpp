@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Insert/erase churn in std::map, std::list and std::unordered_map with the
+// default allocator (malloc), etl::pool_allocator, and std::pmr containers on
+// an etl::pool_memory_resource.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++17 -I../.. -I../../../include/etl pool_allocator.cpp -o pool_allocator
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <list>
+#include <unordered_map>
+#include <functional>
+
+#include "pool_allocator.h"
+
+const size_t ITEMS = 1000;
+const size_t LOOPS = 2000;
+
+volatile size_t sink;
+
+//*****************************************************************************
+// Fills the map, then erases and re-inserts every item.
+template <typename TMap>
+double MapChurn(TMap& data)
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    for (size_t j = 0; j < ITEMS; ++j)
+    {
+      data[int((j * 7919) % ITEMS)] = int(j);
+    }
+
+    sink = data.size();
+
+    for (size_t j = 0; j < ITEMS; ++j)
+    {
+      data.erase(int(j));
+    }
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / (LOOPS * ITEMS);
+}
+
+//*****************************************************************************
+template <typename TList>
+double ListChurn(TList& data)
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    for (size_t j = 0; j < ITEMS; ++j)
+    {
+      data.push_back(int(j));
+    }
+
+    sink = data.size();
+
+    while (!data.empty())
+    {
+      data.pop_front();
+    }
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  return time.count() * 1e9 / (LOOPS * ITEMS);
+}
+
+//*****************************************************************************
+typedef std::pair<const int, int> Pair;
+
+typedef std::map<int, int>                                                          Map;
+typedef std::map<int, int, std::less<int>, etl::pool_allocator<Pair, ITEMS + 1> >   PoolMap;
+typedef std::list<int>                                                              List;
+typedef std::list<int, etl::pool_allocator<int, ITEMS + 1> >                        PoolList;
+typedef std::unordered_map<int, int>                                                HashMap;
+typedef std::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                           etl::pool_allocator<Pair, ITEMS + 1> >                   PoolHashMap;
+
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+// Room for the largest of the node types.
+etl::pool_memory_resource<64, 16, (3 * ITEMS) + 8> resource;
+#endif
+
+int main()
+{
+  std::cout << "ns per insert/erase        malloc    pool_allocator";
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+  std::cout << "    pool_memory_resource";
+#endif
+  std::cout << "\n";
+
+  {
+    Map     malloc_map;
+    PoolMap pool_map;
+
+    std::cout << "std::map           : " << std::setw(10) << MapChurn(malloc_map)
+              << "    " << std::setw(14) << MapChurn(pool_map);
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+    std::pmr::map<int, int> pmr_map(&resource);
+    std::cout << "    " << std::setw(20) << MapChurn(pmr_map);
+#endif
+    std::cout << "\n";
+  }
+
+  {
+    List     malloc_list;
+    PoolList pool_list;
+
+    std::cout << "std::list          : " << std::setw(10) << ListChurn(malloc_list)
+              << "    " << std::setw(14) << ListChurn(pool_list);
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+    std::pmr::list<int> pmr_list(&resource);
+    std::cout << "    " << std::setw(20) << ListChurn(pmr_list);
+#endif
+    std::cout << "\n";
+  }
+
+  {
+    HashMap     malloc_hash;
+    PoolHashMap pool_hash;
+
+    std::cout << "std::unordered_map : " << std::setw(10) << MapChurn(malloc_hash)
+              << "    " << std::setw(14) << MapChurn(pool_hash);
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+    std::pmr::unordered_map<int, int> pmr_hash(&resource);
+    std::cout << "    " << std::setw(20) << MapChurn(pmr_hash);
+#endif
+    std::cout << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Allocate/release throughput from 1 to N threads sharing one pool: directly
+// from an atomic_pool, and through a pool_cache per thread in front of an
+// atomic_pool and in front of a pool behind a mutex.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -pthread -I../.. -I../../../include/etl pool_cache.cpp -o pool_cache
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <mutex>
+
+#include "pool.h"
+#include "atomic_pool.h"
+#include "pool_cache.h"
+
+struct Message
+{
+  uint32_t id;
+  uint8_t  data[60];
+};
+
+const size_t MAX_THREADS   = 16;
+const size_t HELD          = 4;       // Items held by each thread at a time.
+const size_t LOOPS         = 1000000; // Per thread.
+const size_t MAGAZINE_SIZE = 16;
+const size_t POOL_SIZE     = MAX_THREADS * (HELD + MAGAZINE_SIZE);
+
+etl::atomic_pool<Message, POOL_SIZE> atomic_pool;
+etl::pool<Message, POOL_SIZE>        locked_pool;
+std::mutex                           mutex;
+
+struct MutexAccess
+{
+  static void lock()   { mutex.lock(); }
+  static void unlock() { mutex.unlock(); }
+};
+
+typedef etl::pool_cache<Message, MAGAZINE_SIZE, etl::iatomic_pool>       AtomicCache;
+typedef etl::pool_cache<Message, MAGAZINE_SIZE, etl::ipool, MutexAccess> LockedCache;
+
+//*****************************************************************************
+template <typename TAllocator>
+void Work(TAllocator& allocator)
+{
+  Message* items[HELD];
+
+  for (size_t i = 0; i < LOOPS; ++i)
+  {
+    for (size_t j = 0; j < HELD; ++j)
+    {
+      items[j] = allocator.template allocate<Message>();
+      items[j]->id = uint32_t(i);
+    }
+
+    for (size_t j = 0; j < HELD; ++j)
+    {
+      allocator.release(items[j]);
+    }
+  }
+}
+
+void Direct()
+{
+  Work(atomic_pool);
+}
+
+void CachedAtomic()
+{
+  AtomicCache cache(atomic_pool);
+  Work(cache);
+}
+
+void CachedLocked()
+{
+  LockedCache cache(locked_pool);
+  Work(cache);
+}
+
+//*****************************************************************************
+double Run(void (*work)(), size_t n_threads)
+{
+  typedef std::chrono::high_resolution_clock clock_type;
+
+  std::vector<std::thread> threads;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads.push_back(std::thread(work));
+  }
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads[t].join();
+  }
+
+  std::chrono::duration<double> time = clock_type::now() - begin;
+
+  // Nanoseconds per allocate/release pair, across all threads.
+  return time.count() * 1e9 / (n_threads * LOOPS * HELD);
+}
+
+int main()
+{
+  size_t max_threads = std::thread::hardware_concurrency();
+  max_threads = (max_threads == 0) ? 1 : max_threads;
+  max_threads = (max_threads > MAX_THREADS) ? MAX_THREADS : max_threads;
+
+  std::cout << "threads : atomic_pool   cache + atomic_pool   cache + mutex pool  (ns per allocate/release)\n";
+
+  for (size_t n = 1; n <= max_threads; n *= 2)
+  {
+    double direct_time = Run(&Direct, n);
+    double atomic_time = Run(&CachedAtomic, n);
+    double locked_time = Run(&CachedLocked, n);
+
+    std::cout << std::setw(7)  << n << " : "
+              << std::setw(11) << direct_time << "   "
+              << std::setw(19) << atomic_time << "   "
+              << std::setw(18) << locked_time << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Lookup time of static_flat_map against flat_map and reference_flat_map,
+// for read only tables of 1k to 1M entries.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl static_flat_map.cpp ../../../src/binary.cpp -o static_flat_map
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <map>
+
+#include "flat_map.h"
+#include "reference_flat_map.h"
+#include "static_flat_map.h"
+
+const size_t LOOKUPS = 10000000;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, const TMap& map, const std::vector<uint32_t>& keys)
+{
+  uint64_t sum = 0;
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.find(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  std::chrono::duration<double> lookup_time = clock_type::now() - begin;
+
+  std::cout << std::setw(20) << name << " : "
+            << "find " << std::setw(8) << (lookup_time.count() * 1e9 / keys.size()) << " ns ("
+            << sum << ")\n";
+}
+
+//*****************************************************************************
+template <size_t SIZE>
+void Run_Size()
+{
+  typedef std::pair<const uint32_t, uint32_t> Element;
+
+  static etl::flat_map<uint32_t, uint32_t, SIZE>           flat;
+  static etl::reference_flat_map<uint32_t, uint32_t, SIZE> reference;
+  static etl::static_flat_map<uint32_t, uint32_t, SIZE>    eytzinger;
+
+  // Scattered keys.
+  std::vector<uint32_t> keys(SIZE);
+  std::map<uint32_t, uint32_t> sorted;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    keys[i] = uint32_t(i * 2654435761U);
+    sorted[keys[i]] = uint32_t(i);
+  }
+
+  // The flat maps are filled in key order, to avoid quadratic insertion.
+  std::vector<Element> elements(sorted.begin(), sorted.end());
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    flat.insert(elements[i]);
+    reference.insert(elements[i]);
+  }
+
+  clock_type::time_point begin = clock_type::now();
+  std::vector<std::pair<uint32_t, uint32_t> > unsorted;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    unsorted.push_back(std::make_pair(keys[i], uint32_t(i)));
+  }
+
+  eytzinger.assign(unsorted.begin(), unsorted.end());
+  std::chrono::duration<double> build_time = clock_type::now() - begin;
+
+  std::vector<uint32_t> lookups(LOOKUPS);
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    lookups[i] = keys[(seed >> 8) % SIZE];
+  }
+
+  std::cout << SIZE << " keys, static_flat_map built from unsorted keys in " << (build_time.count() * 1e3) << " ms\n";
+
+  Run("reference_flat_map", reference, lookups);
+  Run("flat_map", flat, lookups);
+  Run("static_flat_map", eytzinger, lookups);
+}
+
+int main()
+{
+  Run_Size<1024>();
+  Run_Size<16384>();
+  Run_Size<262144>();
+  Run_Size<1048576>();
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Time to fill and drain 4k element containers of a small POD by inserting and
+// erasing at the middle, for etl::vector and etl::deque against std::vector.
+//
+// Build from this directory, for example:
+// g++ -O2 -std=c++11 -I../.. -I../../../include/etl vector_insert.cpp ../../../src/binary.cpp -o vector_insert
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "vector.h"
+#include "deque.h"
+
+struct Element
+{
+  uint32_t a;
+  uint32_t b;
+  uint32_t c;
+  uint32_t d;
+};
+
+// The unit test profile only recognises fundamental types as trivial.
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Element> : etl::true_type {};
+}
+
+const size_t SIZE   = 4096;
+const size_t ROUNDS = 50;
+
+typedef etl::vector<Element, SIZE> Vector;
+typedef etl::deque<Element, SIZE>  Deque;
+
+Vector vector;
+Deque  deque;
+
+std::vector<Element> std_vector;
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+//*****************************************************************************
+template <typename TContainer>
+void Run(const char* name, TContainer& container)
+{
+  Element element = { 1, 2, 3, 4 };
+
+  clock_type::time_point begin = clock_type::now();
+
+  for (size_t i = 0; i < ROUNDS; ++i)
+  {
+    container.clear();
+
+    while (container.size() < SIZE)
+    {
+      container.insert(container.begin() + (container.size() / 2), element);
+    }
+  }
+
+  std::chrono::duration<double> insert_time = clock_type::now() - begin;
+
+  begin = clock_type::now();
+
+  for (size_t i = 0; i < ROUNDS; ++i)
+  {
+    while (container.size() < SIZE)
+    {
+      container.push_back(element);
+    }
+
+    while (!container.empty())
+    {
+      container.erase(container.begin() + (container.size() / 2));
+    }
+  }
+
+  std::chrono::duration<double> erase_time = clock_type::now() - begin;
+
+  std::cout << std::setw(11) << name << " : "
+            << "insert " << std::setw(8) << (insert_time.count() * 1e9 / (ROUNDS * SIZE)) << " ns, "
+            << "erase "  << std::setw(8) << (erase_time.count()  * 1e9 / (ROUNDS * SIZE)) << " ns\n";
+}
+
+int main()
+{
+  std_vector.reserve(SIZE);
+
+  Run("std::vector", std_vector);
+  Run("etl::vector", vector);
+  Run("etl::deque",  deque);
+
+  return 0;
+}
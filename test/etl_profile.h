@@ -40,15 +40,32 @@ SOFTWARE.
 #define ETL_IN_UNIT_TEST
 #define ETL_DEBUG_COUNT
 
+// The opt-in implementations are tested by a separate build configuration
+// so that the default ones are still covered by the normal build.
+#if defined(ETL_TEST_OPTIONS)
+  #define ETL_CRC_SLICE_BY_8
+  #define ETL_CRC_HARDWARE_X86
+  #define ETL_CHECKSUM_HARDWARE_X86
+  #define ETL_BLOOM_FILTER_HARDWARE_X86
+  #define ETL_FLAT_HASH_HARDWARE_X86
+  #define ETL_HASH_USE_WYHASH
+  #define ETL_UNORDERED_POWER_OF_2_BUCKETS
+  #define ETL_UNORDERED_STORE_HASH
+#endif
+
 #define ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
 #define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
 
 #define ETL_POLYMORPHIC_BITSET
+#define ETL_POLYMORPHIC_BTREE_MAP
+#define ETL_POLYMORPHIC_BTREE_MULTIMAP
+#define ETL_POLYMORPHIC_BTREE_SET
 #define ETL_POLYMORPHIC_DEQUE
 #define ETL_POLYMORPHIC_FLAT_MAP
 #define ETL_POLYMORPHIC_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_FLAT_SET
 #define ETL_POLYMORPHIC_FLAT_MULTISET
+#define ETL_POLYMORPHIC_FLAT_UNORDERED_MAP
 #define ETL_POLYMORPHIC_FORWARD_LIST
 #define ETL_POLYMORPHIC_LIST
 #define ETL_POLYMORPHIC_MAP
@@ -57,6 +74,8 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_MULTISET
 #define ETL_POLYMORPHIC_QUEUE
 #define ETL_POLYMORPHIC_STACK
+#define ETL_POLYMORPHIC_STATIC_FLAT_MAP
+#define ETL_POLYMORPHIC_STATIC_FLAT_SET
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_MAP
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_REFERENCE_FLAT_SET
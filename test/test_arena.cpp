@@ -0,0 +1,207 @@
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include <string>
+#include <stdint.h>
+
+#include "arena.h"
+
+namespace
+{
+  struct D2
+  {
+    D2(int a_, double b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    int    a;
+    double b;
+  };
+
+  SUITE(test_arena)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::arena<64> arena;
+
+      CHECK(arena.empty());
+      CHECK_EQUAL(64U, arena.max_size());
+
+      char* p1 = static_cast<char*>(arena.allocate(1, 1));
+      char* p2 = static_cast<char*>(arena.allocate(1, 1));
+
+      CHECK(p2 == p1 + 1);
+      CHECK_EQUAL(2U, arena.size());
+
+      // The next allocation is padded to the alignment.
+      uint32_t* p3 = arena.allocate<uint32_t>();
+
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(p3) % etl::alignment_of<uint32_t>::value);
+      CHECK_EQUAL(4U + sizeof(uint32_t), arena.size());
+      CHECK_EQUAL(64U - arena.size(), arena.available());
+
+      uint8_t* p4 = arena.allocate<uint8_t>(arena.available());
+
+      CHECK(p4 != nullptr);
+      CHECK(arena.full());
+      CHECK_THROW(arena.allocate(1, 1), etl::arena_full);
+      CHECK_THROW(arena.allocate<uint32_t>(size_t(-1) / 2), etl::arena_full);
+    }
+
+    //*************************************************************************
+    TEST(test_create)
+    {
+      etl::arena<64> arena;
+
+      D2* p = arena.create<D2>(1, 2.5);
+
+      CHECK_EQUAL(1, p->a);
+      CHECK_EQUAL(2.5, p->b);
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(p) % etl::alignment_of<D2>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_rewind_reset)
+    {
+      etl::arena<64> arena;
+
+      arena.allocate<uint32_t>(2);
+
+      etl::iarena::marker_t marker = arena.get_marker();
+      uint32_t* p1 = arena.allocate<uint32_t>(4);
+
+      arena.rewind(marker);
+      CHECK_EQUAL(8U, arena.size());
+
+      // The memory is reused.
+      CHECK(arena.allocate<uint32_t>(4) == p1);
+
+      // Cannot rewind forwards.
+      arena.rewind(marker);
+      CHECK_THROW(arena.rewind(marker + 1), etl::arena_invalid_marker);
+      CHECK_EQUAL(8U, arena.size());
+
+      arena.reset();
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_arena_scope)
+    {
+      etl::arena<64> arena;
+
+      arena.allocate<uint32_t>();
+
+      {
+        etl::arena_scope scope(arena);
+
+        arena.allocate<uint32_t>(8);
+        CHECK_EQUAL(36U, arena.size());
+
+        {
+          etl::arena_scope inner(arena);
+          arena.allocate<uint32_t>(4);
+          CHECK_EQUAL(52U, arena.size());
+        }
+
+        CHECK_EQUAL(36U, arena.size());
+      }
+
+      CHECK_EQUAL(4U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_arena_vector)
+    {
+      etl::arena<256> arena;
+
+      {
+        etl::arena_scope scope(arena);
+
+        etl::arena_vector<int> tokens(arena, 10);
+        etl::arena_vector<int*> pointers(arena, 4);
+
+        CHECK(tokens.empty());
+        CHECK_EQUAL(10U, tokens.max_size());
+        CHECK(arena.size() >= (10 * sizeof(int)) + (4 * sizeof(int*)));
+
+        for (int i = 0; i < 10; ++i)
+        {
+          tokens.push_back(i);
+        }
+
+        CHECK(tokens.full());
+        CHECK_EQUAL(9, tokens.back());
+        CHECK_THROW(tokens.push_back(10), etl::vector_full);
+
+        pointers.push_back(&tokens[0]);
+        CHECK_EQUAL(0, *pointers[0]);
+
+        etl::ivector<int>& itokens = tokens;
+        itokens.erase(itokens.begin());
+        CHECK_EQUAL(1, itokens.front());
+
+        CHECK_THROW(etl::arena_vector<int> too_big(arena, 1000), etl::arena_full);
+      }
+
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_arena_string)
+    {
+      etl::arena<64> arena;
+
+      etl::arena_string text(arena, 10, "Hello");
+
+      CHECK_EQUAL(11U, arena.size());
+      CHECK_EQUAL(10U, text.max_size());
+      CHECK_EQUAL(std::string("Hello"), std::string(text.c_str()));
+
+      text.append(" World");
+
+      // Truncated to the capacity.
+      CHECK_EQUAL(std::string("Hello Worl"), std::string(text.c_str()));
+      CHECK(text.truncated());
+
+      etl::arena_string copy(arena, 10);
+      copy = text;
+
+      CHECK(copy == text);
+
+      CHECK_THROW(etl::arena_string too_big(arena, 100), etl::arena_full);
+    }
+  };
+}
@@ -0,0 +1,361 @@
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include "data.h"
+
+#include <set>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <thread>
+
+#include "atomic_pool.h"
+
+typedef TestDataDC<std::string> Test_Data;
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, int b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    std::string a;
+    int         b;
+  };
+
+  SUITE(test_atomic_pool)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::atomic_pool<Test_Data, 4> pool;
+
+      std::set<Test_Data*> allocated;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        Test_Data* p = nullptr;
+        CHECK_NO_THROW(p = pool.allocate<Test_Data>());
+        CHECK(pool.is_in_pool(p));
+        allocated.insert(p);
+      }
+
+      CHECK_EQUAL(4U, allocated.size());
+      CHECK_THROW(pool.allocate<Test_Data>(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::atomic_pool<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate<Test_Data>();
+      Test_Data* p2 = pool.allocate<Test_Data>();
+      Test_Data* p3 = pool.allocate<Test_Data>();
+      Test_Data* p4 = pool.allocate<Test_Data>();
+
+      CHECK_EQUAL(0U, pool.available());
+      CHECK(pool.full());
+
+      CHECK_NO_THROW(pool.release(p2));
+      CHECK_NO_THROW(pool.release(p3));
+
+      CHECK_EQUAL(2U, pool.available());
+      CHECK_EQUAL(2U, pool.size());
+      CHECK(!pool.full());
+
+      // Freed items are reused, most recent first.
+      CHECK(pool.allocate<Test_Data>() == p3);
+      CHECK(pool.allocate<Test_Data>() == p2);
+
+      CHECK_NO_THROW(pool.release(p1));
+      CHECK_NO_THROW(pool.release(p2));
+      CHECK_NO_THROW(pool.release(p3));
+      CHECK_NO_THROW(pool.release(p4));
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.available());
+
+      Test_Data not_in_pool;
+
+      CHECK(!pool.is_in_pool(&not_in_pool));
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      etl::atomic_pool<Test_Data, 4> pool;
+
+      Test_Data* items[4] = { nullptr, nullptr, nullptr, nullptr };
+
+      Test_Data** p_end = pool.allocate_n<Test_Data>(items, 3);
+
+      CHECK(p_end == (items + 3));
+      CHECK_EQUAL(3U, pool.size());
+      CHECK(items[3] == nullptr);
+
+      std::set<Test_Data*> allocated(items, items + 3);
+      CHECK_EQUAL(3U, allocated.size());
+
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(pool.is_in_pool(items[i]));
+      }
+
+      // All or none.
+      CHECK_THROW(pool.allocate_n<Test_Data>(items, 2), etl::pool_no_allocation);
+      CHECK_EQUAL(3U, pool.size());
+
+      Test_Data not_in_pool;
+      Test_Data* mixed[2] = { items[0], &not_in_pool };
+
+      CHECK_THROW(pool.release_n(mixed, mixed + 2), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(3U, pool.size());
+
+      CHECK_NO_THROW(pool.release_n(items, items + 3));
+      CHECK(pool.empty());
+
+      p_end = pool.allocate_n<Test_Data>(items, 4);
+
+      CHECK(p_end == (items + 4));
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_up_to)
+    {
+      etl::atomic_pool<Test_Data, 4> pool;
+
+      Test_Data* items[4] = { nullptr, nullptr, nullptr, nullptr };
+
+      Test_Data** p_end = pool.allocate_n<Test_Data>(items, 3);
+      CHECK(p_end == (items + 3));
+
+      // Takes only what is left.
+      Test_Data* more[2] = { nullptr, nullptr };
+
+      p_end = pool.allocate_up_to<Test_Data>(more, 2);
+
+      CHECK(p_end == (more + 1));
+      CHECK(more[1] == nullptr);
+      CHECK(pool.is_in_pool(more[0]));
+      CHECK(std::find(items, items + 3, more[0]) == (items + 3));
+      CHECK(pool.full());
+
+      // Nothing left is not an error.
+      CHECK_NO_THROW(p_end = pool.allocate_up_to<Test_Data>(more + 1, 1));
+      CHECK(p_end == (more + 1));
+
+      pool.release_n(items, items + 3);
+      pool.release_n(more, more + 1);
+      CHECK(pool.empty());
+
+      p_end = pool.allocate_up_to<Test_Data>(items, 4);
+
+      CHECK(p_end == (items + 4));
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      etl::atomic_pool<Test_Data, 4> pool;
+
+      pool.allocate<Test_Data>();
+      pool.allocate<Test_Data>();
+      pool.allocate<Test_Data>();
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.max_size());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_NO_THROW(pool.allocate<Test_Data>());
+      }
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::atomic_pool<D2, 4> pool;
+
+      D2* p = pool.create<D2>("1", 2);
+
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(2, p->b);
+
+      pool.destroy<D2>(p);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      const int THREADS = 4;
+      const int LOOPS   = 20000;
+      const int HELD    = 3;
+
+      static etl::atomic_pool<uint64_t, THREADS * HELD> pool;
+
+      bool ok[THREADS];
+
+      struct Worker
+      {
+        static void run(int id, bool* result)
+        {
+          bool good = true;
+
+          for (int i = 0; i < LOOPS; ++i)
+          {
+            uint64_t* items[HELD];
+
+            for (int j = 0; j < HELD; ++j)
+            {
+              items[j] = pool.allocate<uint64_t>();
+              *items[j] = (uint64_t(id) << 32) | uint32_t(i * HELD + j);
+            }
+
+            // No other thread may have been given the same items.
+            for (int j = 0; j < HELD; ++j)
+            {
+              good = good && (*items[j] == ((uint64_t(id) << 32) | uint32_t(i * HELD + j)));
+              pool.release(items[j]);
+            }
+          }
+
+          *result = good;
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < THREADS; ++t)
+      {
+        threads.push_back(std::thread(&Worker::run, t, &ok[t]));
+      }
+
+      for (int t = 0; t < THREADS; ++t)
+      {
+        threads[t].join();
+        CHECK(ok[t]);
+      }
+
+      CHECK(pool.empty());
+
+      for (int i = 0; i < THREADS * HELD; ++i)
+      {
+        CHECK(pool.allocate<uint64_t>() != nullptr);
+      }
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_size_bounded_under_contention)
+    {
+      const int THREADS = 3;
+      const int LOOPS   = 20000;
+      const int HELD    = 2;
+
+      // Just big enough for every thread to hold its items, so the pool is
+      // repeatedly emptied and refilled.
+      static etl::atomic_pool<uint64_t, THREADS * HELD> pool;
+
+      static etl::atomic_uint32_t done(0);
+
+      struct Worker
+      {
+        static void run()
+        {
+          for (int i = 0; i < LOOPS; ++i)
+          {
+            uint64_t* items[HELD];
+
+            pool.allocate_n<uint64_t>(items, HELD);
+            pool.release_n(items, items + HELD);
+          }
+        }
+      };
+
+      struct Observer
+      {
+        static void run(bool* result)
+        {
+          bool good = true;
+
+          while (done.load() == 0)
+          {
+            good = good && (pool.size() <= pool.max_size());
+            good = good && (pool.available() <= pool.max_size());
+          }
+
+          *result = good;
+        }
+      };
+
+      bool ok = false;
+
+      std::thread observer(&Observer::run, &ok);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < THREADS; ++t)
+      {
+        threads.push_back(std::thread(&Worker::run));
+      }
+
+      for (int t = 0; t < THREADS; ++t)
+      {
+        threads[t].join();
+      }
+
+      done.store(1);
+      observer.join();
+
+      CHECK(ok);
+      CHECK(pool.empty());
+      CHECK_EQUAL(pool.max_size(), pool.available());
+    }
+  };
+}
@@ -0,0 +1,207 @@
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include "data.h"
+
+#include <vector>
+#include <string>
+
+#include "bitmap_pool.h"
+
+typedef TestDataDC<std::string> Test_Data;
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, int b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    std::string a;
+    int         b;
+  };
+
+  SUITE(test_bitmap_pool)
+  {
+    //*************************************************************************
+    TEST(test_allocate_lowest_address)
+    {
+      etl::bitmap_pool<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate<Test_Data>();
+      Test_Data* p2 = pool.allocate<Test_Data>();
+      Test_Data* p3 = pool.allocate<Test_Data>();
+      Test_Data* p4 = pool.allocate<Test_Data>();
+
+      CHECK(p2 == p1 + 1);
+      CHECK(p3 == p1 + 2);
+      CHECK(p4 == p1 + 3);
+      CHECK(pool.full());
+      CHECK_THROW(pool.allocate<Test_Data>(), etl::pool_no_allocation);
+
+      pool.release(p3);
+      pool.release(p2);
+
+      CHECK_EQUAL(2U, pool.available());
+
+      // The lowest free address is always taken first.
+      CHECK(pool.allocate<Test_Data>() == p2);
+      CHECK(pool.allocate<Test_Data>() == p3);
+    }
+
+    //*************************************************************************
+    TEST(test_is_in_pool)
+    {
+      etl::bitmap_pool<Test_Data, 4> pool;
+      Test_Data not_in_pool;
+
+      Test_Data* p1 = pool.allocate<Test_Data>();
+      Test_Data* p2 = pool.allocate<Test_Data>();
+
+      CHECK(pool.is_in_pool(p1));
+      CHECK(pool.is_in_pool(p2));
+      CHECK(!pool.is_in_pool(&not_in_pool));
+      CHECK(!pool.is_in_pool(reinterpret_cast<char*>(p1) + 1));
+
+      // Released items are no longer in the pool.
+      pool.release(p1);
+      CHECK(!pool.is_in_pool(p1));
+
+      // So a double release is detected.
+      CHECK_THROW(pool.release(p1), etl::pool_object_not_in_pool);
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      etl::bitmap_pool<Test_Data, 4> pool;
+
+      Test_Data* items[4] = { nullptr, nullptr, nullptr, nullptr };
+
+      Test_Data** p_end = pool.allocate_n<Test_Data>(items, 3);
+
+      CHECK(p_end == (items + 3));
+      CHECK_EQUAL(3U, pool.size());
+      CHECK(items[1] == items[0] + 1);
+      CHECK(items[2] == items[0] + 2);
+
+      // All or none.
+      CHECK_THROW(pool.allocate_n<Test_Data>(items, 2), etl::pool_no_allocation);
+      CHECK_EQUAL(3U, pool.size());
+
+      Test_Data not_in_pool;
+      Test_Data* mixed[2] = { items[0], &not_in_pool };
+
+      CHECK_THROW(pool.release_n(mixed, mixed + 2), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(3U, pool.size());
+
+      CHECK_NO_THROW(pool.release_n(items, items + 3));
+      CHECK(pool.empty());
+
+      p_end = pool.allocate_n<Test_Data>(items, 4);
+
+      CHECK(p_end == (items + 4));
+      CHECK(pool.full());
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+      CHECK(pool.allocate<Test_Data>() == items[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      etl::bitmap_pool<int, 70> pool;
+
+      std::vector<int*> items;
+
+      for (int i = 0; i < 70; ++i)
+      {
+        int* p = pool.create<int>(i);
+        items.push_back(p);
+      }
+
+      // Leave every third item, spanning the bitset's element boundaries.
+      for (int i = 0; i < 70; ++i)
+      {
+        if ((i % 3) != 0)
+        {
+          pool.release(items[i]);
+        }
+      }
+
+      std::vector<int> expected;
+
+      for (int i = 0; i < 70; i += 3)
+      {
+        expected.push_back(i);
+      }
+
+      std::vector<int> compare(pool.begin(), pool.end());
+
+      CHECK_EQUAL(expected.size(), pool.size());
+      CHECK(compare == expected);
+
+      const etl::ibitmap_pool<int>& cpool = pool;
+      etl::ibitmap_pool<int>::const_iterator itr = cpool.begin();
+
+      CHECK_EQUAL(0, *itr);
+      CHECK_EQUAL(3, *++itr);
+
+      pool.release_all();
+
+      CHECK(pool.begin() == pool.end());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::bitmap_pool<D2, 4> pool;
+
+      D2* p = pool.create<D2>("1", 2);
+
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(2, p->b);
+      CHECK_EQUAL(1U, pool.size());
+
+      pool.destroy<D2>(p);
+
+      CHECK(pool.empty());
+    }
+  };
+}
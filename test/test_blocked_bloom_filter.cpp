@@ -0,0 +1,299 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <algorithm>
+#include <vector>
+#include <stdint.h>
+
+#include "blocked_bloom_filter.h"
+
+#include "fnv_1.h"
+#include "char_traits.h"
+
+namespace
+{
+  struct text_hash_t
+  {
+    typedef const char* argument_type;
+
+    size_t operator ()(argument_type text) const
+    {
+      return etl::fnv_1a_32(text, text + etl::char_traits<char>::length(text));
+    }
+  };
+
+  // Deliberately weak, to check that the filter mixes the hash.
+  struct int_hash_t
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(argument_type value) const
+    {
+      return value;
+    }
+  };
+
+  const char* exist_words[]     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
+  const char* not_exist_words[] = { "My", "hovercraft", "is", "full", "of", "eels" };
+
+  const size_t N_EXIST     = sizeof(exist_words) / sizeof(exist_words[0]);
+  const size_t N_NOT_EXIST = sizeof(not_exist_words) / sizeof(not_exist_words[0]);
+
+  SUITE(test_blocked_bloom_filter)
+  {
+    //*************************************************************************
+    TEST(test_width)
+    {
+      typedef etl::blocked_bloom_filter<1000, text_hash_t> Bloom;
+
+      Bloom bloom;
+
+      CHECK_EQUAL(2U, size_t(Bloom::NUMBER_OF_BLOCKS));
+      CHECK_EQUAL(1024U, size_t(Bloom::WIDTH));
+      CHECK_EQUAL(1024U, bloom.width());
+    }
+
+    //*************************************************************************
+    TEST(test_add_exists)
+    {
+      etl::blocked_bloom_filter<1024, text_hash_t> bloom;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        bloom.add(exist_words[i]);
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_words[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0; i < N_NOT_EXIST; ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_words[i]);
+      }
+
+      CHECK(!any_exist);
+
+      // Eight bits per key.
+      CHECK(bloom.count() > 0U);
+      CHECK(bloom.count() <= (8U * N_EXIST));
+    }
+
+    //*************************************************************************
+    TEST(test_add_batch_exists_batch)
+    {
+      etl::blocked_bloom_filter<1024, text_hash_t> bloom;
+
+      bloom.add_batch(exist_words, exist_words + N_EXIST);
+
+      bool   results[N_EXIST];
+      size_t found = bloom.exists_batch(exist_words, exist_words + N_EXIST, results);
+
+      CHECK_EQUAL(N_EXIST, found);
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        CHECK(results[i]);
+      }
+
+      bool not_results[N_NOT_EXIST];
+      found = bloom.exists_batch(not_exist_words, not_exist_words + N_NOT_EXIST, not_results);
+
+      CHECK_EQUAL(0U, found);
+
+      for (size_t i = 0; i < N_NOT_EXIST; ++i)
+      {
+        CHECK(!not_results[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_batch_matches_single)
+    {
+      // More keys than the batch size, and not a multiple of it.
+      const size_t N_KEYS = (3 * etl::blocked_bloom_filter<1, int_hash_t>::BATCH_SIZE) + 5;
+
+      std::vector<uint32_t> keys;
+
+      for (uint32_t i = 0; i < N_KEYS; ++i)
+      {
+        keys.push_back(i * 7);
+      }
+
+      etl::blocked_bloom_filter<4096, int_hash_t> single;
+      etl::blocked_bloom_filter<4096, int_hash_t> batch;
+
+      for (size_t i = 0; i < keys.size(); ++i)
+      {
+        single.add(keys[i]);
+      }
+
+      batch.add_batch(keys.begin(), keys.end());
+
+      CHECK_EQUAL(single.count(), batch.count());
+
+      std::vector<uint32_t> queries;
+
+      for (uint32_t i = 0; i < 1000; ++i)
+      {
+        queries.push_back(i);
+      }
+
+      std::vector<bool> results;
+      size_t found = batch.exists_batch(queries.begin(), queries.end(), std::back_inserter(results));
+
+      size_t expected_found = 0;
+
+      for (size_t i = 0; i < queries.size(); ++i)
+      {
+        bool exists = single.exists(queries[i]);
+        expected_found += exists ? 1 : 0;
+
+        CHECK_EQUAL(exists, bool(results[i]));
+      }
+
+      CHECK_EQUAL(expected_found, found);
+    }
+
+    //*************************************************************************
+    TEST(test_block_matches_scalar)
+    {
+      // Whichever block code is selected must set and test the same bits as the scalar code.
+      uint64_t storage[24] = { 0 };
+
+      uint64_t* block  = reinterpret_cast<uint64_t*>((reinterpret_cast<uintptr_t>(storage) + 63) & ~uintptr_t(63));
+      uint64_t* scalar = block + 8;
+
+      for (uint32_t i = 0; i < 64; ++i)
+      {
+        const uint32_t key = i * 0x9E3779B9UL;
+
+        etl::private_blocked_bloom_filter::set_block(block, key);
+        etl::private_blocked_bloom_filter::set_block_scalar(scalar, key);
+
+        CHECK(std::equal(block, block + 8, scalar));
+        CHECK(etl::private_blocked_bloom_filter::test_block(block, key));
+        CHECK_EQUAL(etl::private_blocked_bloom_filter::test_block_scalar(scalar, key + 1),
+                    etl::private_blocked_bloom_filter::test_block(block, key + 1));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_false_positive_rate)
+    {
+      // 16 bits per key.
+      const uint32_t N_KEYS = 2000;
+
+      etl::blocked_bloom_filter<N_KEYS * 16, int_hash_t> bloom;
+
+      for (uint32_t i = 0; i < N_KEYS; ++i)
+      {
+        bloom.add(i);
+      }
+
+      bool all_exist = true;
+
+      for (uint32_t i = 0; i < N_KEYS; ++i)
+      {
+        all_exist = all_exist && bloom.exists(i);
+      }
+
+      CHECK(all_exist);
+
+      // Sequential keys from a weak hash must still spread over the blocks.
+      size_t false_positives = 0;
+
+      for (uint32_t i = N_KEYS; i < (N_KEYS + 100000); ++i)
+      {
+        false_positives += bloom.exists(i) ? 1 : 0;
+      }
+
+      CHECK(false_positives < 1000); // Less than 1%
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      etl::blocked_bloom_filter<1024, text_hash_t> bloom;
+
+      bloom.add_batch(exist_words, exist_words + N_EXIST);
+
+      etl::blocked_bloom_filter<1024, text_hash_t> copy(bloom);
+
+      CHECK_EQUAL(bloom.count(), copy.count());
+
+      bool all_exist = true;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        all_exist = all_exist && copy.exists(exist_words[i]);
+      }
+
+      CHECK(all_exist);
+    }
+
+    //*************************************************************************
+    TEST(test_usage_clear)
+    {
+      etl::blocked_bloom_filter<64, text_hash_t> bloom;
+
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0U, bloom.count());
+
+      bloom.add_batch(exist_words, exist_words + N_EXIST);
+
+      CHECK(bloom.usage() > 0U);
+      CHECK(bloom.count() > 0U);
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0U, bloom.count());
+
+      bool any_exist = false;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        any_exist = any_exist || bloom.exists(exist_words[i]);
+      }
+
+      CHECK(!any_exist);
+    }
+  };
+}
@@ -0,0 +1,576 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "data.h"
+
+#include "btree_map.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef TestDataDC<std::string>  DC;
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef etl::btree_map<int, int, SIZE>                           Data;
+  typedef etl::ibtree_map<int, int>                                IData;
+  typedef etl::btree_map<std::string, NDC, SIZE>                   DataNDC;
+  typedef etl::ibtree_map<std::string, NDC>                        IDataNDC;
+  typedef etl::btree_map<int, int, SIZE, std::greater<int> >       DataGreater;
+  typedef etl::btree_map<int, DC, 10>                              DataDC;
+
+  typedef std::map<int, int>               Compare_Data;
+  typedef std::map<std::string, NDC>       Compare_DataNDC;
+
+  //*************************************************************************
+  std::string make_key(int i)
+  {
+    // Long enough to defeat the small string optimisation, and sorted by i.
+    char text[64];
+    sprintf(text, "key_with_a_long_prefix_%06d", i);
+    return std::string(text);
+  }
+
+  //*************************************************************************
+  // A scattered order for 0 to SIZE - 1.
+  int scatter(int i)
+  {
+    return int((size_t(i) * 7919U) % SIZE);
+  }
+
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Same(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(0U, data.depth());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_destruct_via_ibtree_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        pdata->insert(DataNDC::value_type(make_key(i), NDC("A")));
+      }
+
+      CHECK(NDC::get_instance_count() > current_count);
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        compare[scatter(i)] = i;
+      }
+
+      std::vector<std::pair<int, int> > values(compare.begin(), compare.end());
+      std::reverse(values.begin(), values.end());
+
+      Data data(values.begin(), values.end());
+
+      CHECK(data.full());
+      CHECK(Check_Same(data, compare));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      Data data = { { 3, 30 }, { 1, 10 }, { 2, 20 } };
+
+      Compare_Data compare = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+
+      CHECK(Check_Same(data, compare));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_copy_constructor_and_assignment)
+    {
+      Data data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data[scatter(i)] = i;
+      }
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data other;
+      other[1] = 1;
+      other = data;
+      CHECK(other == data);
+
+      IData& idata = other;
+      idata = idata;
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_index)
+    {
+      Data data;
+
+      data[5] = 50;
+      data[1] = 10;
+      data[5] = 55;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(55, data[5]);
+      CHECK_EQUAL(10, data[1]);
+      CHECK_EQUAL(0,  data[3]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      data[5] = 50;
+
+      const Data& cdata = data;
+
+      CHECK_EQUAL(50, data.at(5));
+      CHECK_EQUAL(50, cdata.at(5));
+      CHECK_THROW(data.at(6), etl::btree_out_of_bounds);
+      CHECK_THROW(cdata.at(6), etl::btree_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.insert(Data::value_type(1, 10));
+      CHECK(result.second);
+      CHECK_EQUAL(1,  result.first->first);
+      CHECK_EQUAL(10, result.first->second);
+
+      result = data.insert(Data::value_type(1, 20));
+      CHECK(!result.second);
+      CHECK_EQUAL(10, result.first->second);
+
+      Data::iterator itr = data.insert(data.cbegin(), Data::value_type(2, 20));
+      CHECK_EQUAL(2, itr->first);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_returns_position_across_splits)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const int key = scatter(i);
+
+        std::pair<Data::iterator, bool> result = data.insert(Data::value_type(key, i));
+
+        CHECK(result.second);
+        CHECK_EQUAL(key, result.first->first);
+        CHECK_EQUAL(i,   result.first->second);
+      }
+
+      CHECK(data.full());
+      CHECK(data.depth() > 1);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(Data::value_type(i, i));
+      }
+
+      CHECK_THROW(data.insert(Data::value_type(-1, 0)), etl::btree_full);
+
+      // An existing key does not need room.
+      CHECK(!data.insert(Data::value_type(0, 0)).second);
+    }
+
+    //*************************************************************************
+    TEST(test_non_default_constructible_values)
+    {
+      DataNDC data;
+      Compare_DataNDC compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const std::string key = make_key(scatter(i));
+
+        data.insert(DataNDC::value_type(key, NDC(key)));
+        compare.insert(Compare_DataNDC::value_type(key, NDC(key)));
+      }
+
+      CHECK(Check_Same(data, compare));
+
+      for (int i = 0; i < int(SIZE); i += 3)
+      {
+        const std::string key = make_key(scatter(i));
+
+        CHECK_EQUAL(1U, data.erase(key));
+        compare.erase(key);
+      }
+
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); i += 2)
+      {
+        data[i] = i * 10;
+      }
+
+      const Data& cdata = data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        if ((i % 2) == 0)
+        {
+          CHECK_EQUAL(i * 10, data.find(i)->second);
+          CHECK_EQUAL(i * 10, cdata.find(i)->second);
+        }
+        else
+        {
+          CHECK(data.find(i) == data.end());
+          CHECK(cdata.find(i) == cdata.end());
+        }
+      }
+
+      CHECK(data.find(-1) == data.end());
+      CHECK(data.find(int(SIZE)) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_count)
+    {
+      Data data;
+      data[1] = 1;
+
+      CHECK_EQUAL(1U, data.count(1));
+      CHECK_EQUAL(0U, data.count(2));
+    }
+
+    //*************************************************************************
+    TEST(test_lower_and_upper_bound)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); i += 4)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      const Data& cdata = data;
+
+      for (int i = -2; i < int(SIZE) + 2; ++i)
+      {
+        Compare_Data::iterator lower = compare.lower_bound(i);
+        Compare_Data::iterator upper = compare.upper_bound(i);
+
+        CHECK_EQUAL(std::distance(compare.begin(), lower), std::distance(data.begin(), data.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare.begin(), upper), std::distance(data.begin(), data.upper_bound(i)));
+        CHECK_EQUAL(std::distance(compare.begin(), lower), std::distance(cdata.begin(), cdata.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare.begin(), upper), std::distance(cdata.begin(), cdata.upper_bound(i)));
+
+        std::pair<Data::iterator, Data::iterator> range = data.equal_range(i);
+        CHECK_EQUAL(compare.count(i), size_t(std::distance(range.first, range.second)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[scatter(i)]    = i;
+        compare[scatter(i)] = i;
+      }
+
+      // Erase in a different scattered order, so leaves borrow and merge
+      // on both sides, until the tree collapses.
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const int key = int((size_t(i) * 617U) % SIZE);
+
+        CHECK_EQUAL(1U, data.erase(key));
+        CHECK_EQUAL(0U, data.erase(key));
+        compare.erase(key);
+
+        if ((i % 50) == 0)
+        {
+          CHECK(Check_Same(data, compare));
+        }
+      }
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.depth());
+      CHECK(data.begin() == data.end());
+
+      // The nodes were all released.
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator_while_iterating)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      Data::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        if ((itr->first % 3) != 0)
+        {
+          compare.erase(itr->first);
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      Data::iterator result = data.erase(data.find(100), data.find(700));
+      compare.erase(compare.find(100), compare.find(700));
+
+      CHECK_EQUAL(700, result->first);
+      CHECK(Check_Same(data, compare));
+
+      result = data.erase(data.find(800), data.end());
+      compare.erase(compare.find(800), compare.end());
+
+      CHECK(result == data.end());
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      DataNDC data;
+      int current_count = NDC::get_instance_count();
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(DataNDC::value_type(make_key(i), NDC("A")));
+      }
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(DataNDC::value_type(make_key(i), NDC("B")));
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[scatter(i)]    = i;
+        compare[scatter(i)] = i;
+      }
+
+      const Data& cdata = data;
+
+      CHECK(std::equal(data.begin(),   data.end(),   compare.begin()));
+      CHECK(std::equal(cdata.cbegin(), cdata.cend(), compare.begin()));
+      CHECK(std::equal(data.rbegin(),  data.rend(),  compare.rbegin()));
+      CHECK(std::equal(cdata.crbegin(), cdata.crend(), compare.rbegin()));
+
+      // Backwards from the end, crossing every leaf.
+      Data::iterator itr = data.end();
+      Compare_Data::iterator citr = compare.end();
+
+      while (itr != data.begin())
+      {
+        --itr;
+        --citr;
+        CHECK_EQUAL(citr->first, itr->first);
+      }
+
+      // Values can be changed through an iterator.
+      data.begin()->second = 1234;
+      CHECK_EQUAL(1234, data[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_compare_functor)
+    {
+      DataGreater data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[scatter(i)] = i;
+      }
+
+      int previous = int(SIZE);
+
+      for (DataGreater::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK(itr->first < previous);
+        previous = itr->first;
+      }
+
+      CHECK_EQUAL(int(SIZE) - 1, data.begin()->first);
+      CHECK_EQUAL(10, data.lower_bound(10)->first);
+      CHECK_EQUAL(9,  data.upper_bound(10)->first);
+    }
+
+    //*************************************************************************
+    TEST(test_equal)
+    {
+      Data data1;
+      Data data2;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data1[i]       = i;
+        data2[99 - i]  = 99 - i;
+      }
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+      CHECK(!(data1 < data2));
+
+      data2[50] = 0;
+
+      CHECK(data1 != data2);
+      CHECK(data2 < data1);
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructible_small)
+    {
+      DataDC data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data[i] = DC("A");
+      }
+
+      CHECK(data.full());
+
+      int i = 0;
+
+      for (DataDC::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(i++, itr->first);
+      }
+    }
+  };
+}
@@ -0,0 +1,205 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <vector>
+
+#include "btree_multimap.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::btree_multimap<int, int, SIZE> Data;
+  typedef etl::ibtree_multimap<int, int>      IData;
+  typedef std::multimap<int, int>             Compare_Data;
+
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Same(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_btree_multimap)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_keeps_insertion_order_of_equal_keys)
+    {
+      Data data;
+      Compare_Data compare;
+
+      // Runs of equal keys much longer than a leaf.
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const int key = (i * 13) % 7;
+
+        Data::iterator itr = data.insert(Data::value_type(key, i));
+
+        CHECK_EQUAL(key, itr->first);
+        CHECK_EQUAL(i,   itr->second);
+
+        compare.insert(Compare_Data::value_type(key, i));
+      }
+
+      CHECK(data.full());
+      CHECK(Check_Same(data, compare));
+      CHECK_THROW(data.insert(Data::value_type(0, 0)), etl::btree_full);
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range_and_count)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const int key = ((i * 31) % 50) * 2;
+
+        data.insert(Data::value_type(key, i));
+        compare.insert(Compare_Data::value_type(key, i));
+      }
+
+      const Data& cdata = data;
+
+      for (int key = -1; key < 102; ++key)
+      {
+        std::pair<Data::iterator, Data::iterator>             range  = data.equal_range(key);
+        std::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(key);
+        std::pair<Compare_Data::iterator, Compare_Data::iterator> expected = compare.equal_range(key);
+
+        CHECK_EQUAL(compare.count(key), data.count(key));
+        CHECK(std::equal(range.first, range.second, expected.first));
+        CHECK(std::equal(crange.first, crange.second, expected.first));
+        CHECK_EQUAL(std::distance(compare.begin(), expected.first), std::distance(data.begin(), range.first));
+
+        if (expected.first != expected.second)
+        {
+          CHECK(data.find(key) == range.first);
+        }
+        else
+        {
+          CHECK(data.find(key) == data.end());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const int key = (i * 31) % 40;
+
+        data.insert(Data::value_type(key, i));
+        compare.insert(Compare_Data::value_type(key, i));
+      }
+
+      for (int key = 0; key < 40; key += 3)
+      {
+        CHECK_EQUAL(compare.erase(key), data.erase(key));
+        CHECK(Check_Same(data, compare));
+      }
+
+      CHECK_EQUAL(0U, data.erase(0));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(Data::value_type(i % 10, i));
+        compare.insert(Compare_Data::value_type(i % 10, i));
+      }
+
+      Data::iterator itr = data.begin();
+      Compare_Data::iterator citr = compare.begin();
+
+      while (itr != data.end())
+      {
+        if ((itr->second % 4) != 0)
+        {
+          itr = data.erase(itr);
+          compare.erase(citr++);
+        }
+        else
+        {
+          ++itr;
+          ++citr;
+        }
+      }
+
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(Data::value_type(i % 5, i));
+      }
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data other;
+      IData& iother = other;
+      iother = data;
+      CHECK(other == data);
+
+      other.insert(Data::value_type(0, 0));
+      CHECK(other != data);
+    }
+  };
+}
@@ -0,0 +1,241 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "btree_set.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::btree_set<int, SIZE>                     Data;
+  typedef etl::ibtree_set<int>                          IData;
+  typedef etl::btree_set<std::string, SIZE>             DataString;
+  typedef etl::btree_set<int, SIZE, std::greater<int> > DataGreater;
+
+  typedef std::set<int>         Compare_Data;
+  typedef std::set<std::string> Compare_DataString;
+
+  //*************************************************************************
+  // A scattered order for 0 to SIZE - 1.
+  int scatter(int i)
+  {
+    return int((size_t(i) * 7919U) % SIZE);
+  }
+
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Same(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_btree_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_assignment)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        values.push_back(scatter(i));
+      }
+
+      Data data(values.begin(), values.end());
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK(data.full());
+      CHECK(Check_Same(data, compare));
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data other;
+      other.insert(5);
+      IData& iother = other;
+      iother = data;
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_insert)
+    {
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.insert(3);
+      CHECK(result.second);
+      CHECK_EQUAL(3, *result.first);
+
+      result = data.insert(3);
+      CHECK(!result.second);
+      CHECK_EQUAL(3, *result.first);
+      CHECK_EQUAL(1U, data.size());
+
+      for (int i = 0; i < int(SIZE) - 1; ++i)
+      {
+        data.insert(int(SIZE) + i);
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(-1), etl::btree_full);
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      DataString data;
+      Compare_DataString compare;
+
+      for (int i = 0; i < int(SIZE); i += 2)
+      {
+        char text[64];
+        sprintf(text, "a_string_long_enough_for_the_heap_%06d", scatter(i));
+        data.insert(text);
+        compare.insert(text);
+      }
+
+      CHECK(Check_Same(data, compare));
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        char text[64];
+        sprintf(text, "a_string_long_enough_for_the_heap_%06d", i);
+        const std::string key(text);
+
+        CHECK_EQUAL(compare.count(key), data.count(key));
+        CHECK_EQUAL(compare.find(key) == compare.end(), data.find(key) == data.end());
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(i);
+        compare.insert(i);
+      }
+
+      // From the front, the back and the middle.
+      for (int i = 0; i < 200; ++i)
+      {
+        data.erase(i);
+        compare.erase(i);
+        data.erase(int(SIZE) - 1 - i);
+        compare.erase(int(SIZE) - 1 - i);
+        data.erase(400 + i);
+        compare.erase(400 + i);
+      }
+
+      CHECK(Check_Same(data, compare));
+
+      Data::iterator itr = data.erase(data.find(300));
+      CHECK_EQUAL(301, *itr);
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.depth());
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_iterators)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(scatter(i));
+      }
+
+      int expected = int(SIZE) - 1;
+
+      for (Data::const_reverse_iterator itr = data.crbegin(); itr != data.crend(); ++itr)
+      {
+        CHECK_EQUAL(expected--, *itr);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compare_functor)
+    {
+      DataGreater data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(scatter(i));
+      }
+
+      CHECK_EQUAL(int(SIZE) - 1, *data.begin());
+      CHECK_EQUAL(0, *data.rbegin());
+      CHECK(data.lower_bound(-1) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_comparison_operators)
+    {
+      Data data1;
+      Data data2;
+
+      data1.insert(1);
+      data1.insert(2);
+      data2.insert(2);
+      data2.insert(1);
+
+      CHECK(data1 == data2);
+
+      data2.insert(3);
+
+      CHECK(data1 != data2);
+      CHECK(data1 < data2);
+    }
+  };
+}
@@ -139,6 +139,37 @@ namespace
       uint32_t hash3 = etl::checksum<uint32_t>(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_range_contiguous)
+    {
+      std::vector<uint8_t> data(70000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(0xFF - ((i * 37) + (i >> 3)));
+      }
+
+      // Every length and alignment up to a few blocks of the largest block size.
+      for (size_t offset = 0; offset < 16; ++offset)
+      {
+        for (size_t length = 0; length < 300; ++length)
+        {
+          CHECK_EQUAL(int(etl::checksum<uint8_t>(data.begin() + offset, data.begin() + offset + length)),
+                      int(etl::checksum<uint8_t>(&data[offset], &data[offset] + length)));
+          CHECK_EQUAL(etl::checksum<uint16_t>(data.begin() + offset, data.begin() + offset + length),
+                      etl::checksum<uint16_t>(&data[offset], &data[offset] + length));
+          CHECK_EQUAL(etl::checksum<uint32_t>(data.begin() + offset, data.begin() + offset + length),
+                      etl::checksum<uint32_t>(&data[offset], &data[offset] + length));
+          CHECK_EQUAL(etl::checksum<uint64_t>(data.begin() + offset, data.begin() + offset + length),
+                      etl::checksum<uint64_t>(&data[offset], &data[offset] + length));
+        }
+      }
+
+      // Long enough to overflow any intermediate accumulators.
+      CHECK_EQUAL(etl::checksum<uint64_t>(data.begin(), data.end()),
+                  etl::checksum<uint64_t>(data.data(), data.data() + data.size()));
+    }
   };
 }
 
@@ -0,0 +1,218 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <set>
+#include <vector>
+
+#include "const_map.h"
+
+#if ETL_CPP14_SUPPORTED
+
+namespace
+{
+  enum class Colour
+  {
+    Red,
+    Green,
+    Blue
+  };
+
+  typedef etl::const_map<int, char, 5>               IntMap;
+  typedef etl::const_map<etl::string_view, int, 6>   KeywordMap;
+  typedef etl::const_map<Colour, const char*, 3>     ColourMap;
+
+  constexpr IntMap int_map({ { 10, 'a' }, { 20, 'b' }, { 30, 'c' }, { 40, 'd' }, { 50, 'e' } });
+
+  constexpr KeywordMap keywords({ { "if", 1 }, { "else", 2 }, { "while", 3 }, { "for", 4 }, { "return", 5 }, { "break", 6 } });
+
+  constexpr ColourMap colours({ { Colour::Red, "red" }, { Colour::Green, "green" }, { Colour::Blue, "blue" } });
+
+  // The lookups can be made at compile time.
+  static_assert(int_map.find(30)->second == 'c', "Compile time lookup");
+  static_assert(int_map.find(35) == int_map.end(), "Compile time miss");
+  static_assert(keywords.find("while")->second == 3, "Compile time string lookup");
+  static_assert(keywords.count("whilst") == 0, "Compile time string miss");
+
+  // A constexpr map near the size that fits the default constexpr limits.
+  typedef etl::const_map<int, int, 1000> LargeMap;
+
+  struct LargeValues
+  {
+    LargeMap::value_type values[LargeMap::SIZE];
+  };
+
+  constexpr LargeValues make_large_values()
+  {
+    LargeValues large_values{};
+
+    for (size_t i = 0; i < LargeMap::SIZE; ++i)
+    {
+      large_values.values[i].first  = int(i * 7919U);
+      large_values.values[i].second = int(i);
+    }
+
+    return large_values;
+  }
+
+  constexpr LargeValues large_values = make_large_values();
+
+  constexpr LargeMap large_map(large_values.values);
+
+  static_assert(large_map.find(int(999 * 7919U))->second == 999, "Compile time lookup in a large map");
+
+  SUITE(test_const_map)
+  {
+    //*************************************************************************
+    TEST(test_find_integral_keys)
+    {
+      CHECK_EQUAL(5U, int_map.size());
+      CHECK(!int_map.empty());
+
+      CHECK_EQUAL('a', int_map.find(10)->second);
+      CHECK_EQUAL('b', int_map.find(20)->second);
+      CHECK_EQUAL('c', int_map.find(30)->second);
+      CHECK_EQUAL('d', int_map.find(40)->second);
+      CHECK_EQUAL('e', int_map.find(50)->second);
+
+      for (int i = -100; i < 100; ++i)
+      {
+        CHECK_EQUAL(((i % 10) == 0) && (i >= 10) && (i <= 50) ? 1U : 0U, int_map.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_string_view_keys)
+    {
+      CHECK_EQUAL(1, keywords.at("if"));
+      CHECK_EQUAL(2, keywords.at("else"));
+      CHECK_EQUAL(3, keywords.at("while"));
+      CHECK_EQUAL(4, keywords.at("for"));
+      CHECK_EQUAL(5, keywords.at("return"));
+      CHECK_EQUAL(6, keywords.at("break"));
+
+      const char text[] = "for(;;)";
+      CHECK_EQUAL(4, keywords.at(etl::string_view(text, 3)));
+
+      CHECK(keywords.find("") == keywords.end());
+      CHECK(keywords.find("fo") == keywords.end());
+      CHECK_THROW(keywords.at("continue"), etl::const_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_find_enum_keys)
+    {
+      CHECK_EQUAL(std::string("red"),   std::string(colours.at(Colour::Red)));
+      CHECK_EQUAL(std::string("green"), std::string(colours.at(Colour::Green)));
+      CHECK_EQUAL(std::string("blue"),  std::string(colours.at(Colour::Blue)));
+    }
+
+    //*************************************************************************
+    TEST(test_iteration)
+    {
+      std::set<int> keys;
+
+      for (IntMap::const_iterator itr = int_map.begin(); itr != int_map.end(); ++itr)
+      {
+        keys.insert(itr->first);
+        CHECK_EQUAL(char('a' + (itr->first / 10) - 1), itr->second);
+      }
+
+      CHECK_EQUAL(5U, keys.size());
+    }
+
+    //*************************************************************************
+    TEST(test_build_at_run_time)
+    {
+      typedef etl::const_map<int, int, 1000> Map;
+
+      std::vector<Map::value_type> values(Map::SIZE);
+
+      for (size_t i = 0; i < Map::SIZE; ++i)
+      {
+        values[i].first  = int(i * 7919U);
+        values[i].second = int(i);
+      }
+
+      const Map& map = *new Map(reinterpret_cast<const Map::value_type(&)[Map::SIZE]>(values[0]));
+
+      for (size_t i = 0; i < Map::SIZE; ++i)
+      {
+        Map::const_iterator itr = map.find(int(i * 7919U));
+
+        CHECK(itr != map.end());
+        CHECK_EQUAL(int(i), itr->second);
+        CHECK(map.find(int(i * 7919U) + 1) == map.end());
+      }
+
+      delete &map;
+    }
+
+    //*************************************************************************
+    TEST(test_find_in_large_constexpr_map)
+    {
+      for (size_t i = 0; i < LargeMap::SIZE; ++i)
+      {
+        LargeMap::const_iterator itr = large_map.find(int(i * 7919U));
+
+        CHECK(itr != large_map.end());
+        CHECK_EQUAL(int(i), itr->second);
+        CHECK(large_map.find(int(i * 7919U) + 1) == large_map.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_keys_with_equal_low_hash_bits)
+    {
+      // 'alpha' and 'beta' share a bucket, and their hashes are equal modulo 4.
+      typedef etl::const_map<etl::string_view, int, 4> Map;
+
+      const Map::value_type values[] = { { "alpha", 1 }, { "beta", 2 }, { "gamma", 3 }, { "delta", 4 } };
+
+      Map map(values);
+
+      CHECK_EQUAL(1, map.at("alpha"));
+      CHECK_EQUAL(2, map.at("beta"));
+      CHECK_EQUAL(3, map.at("gamma"));
+      CHECK_EQUAL(4, map.at("delta"));
+    }
+
+    //*************************************************************************
+    TEST(test_repeated_key)
+    {
+      typedef etl::const_map<int, int, 3> Map;
+
+      const Map::value_type values[] = { { 1, 1 }, { 2, 2 }, { 1, 3 } };
+
+      CHECK_THROW(Map map(values), etl::const_map_invalid_keys);
+    }
+  };
+}
+
+#endif
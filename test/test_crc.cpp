@@ -29,19 +29,110 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <iterator>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <stdint.h>
 
+#include "crc.h"
+#include "crc_parallel.h"
 #include "crc8_ccitt.h"
 #include "crc16.h"
 #include "crc16_ccitt.h"
 #include "crc16_kermit.h"
 #include "crc32.h"
+#include "crc32_c.h"
 #include "crc64_ecma.h"
 
 namespace
 {
+  //***************************************************************************
+  /// Checks a CRC against its catalogue check value for "123456789", and
+  /// that the contiguous and iterator paths agree over a range of lengths.
+  //***************************************************************************
+  template <typename TCrc>
+  bool check_crc_type(typename TCrc::value_type expected)
+  {
+    std::string check("123456789");
+
+    if (typename TCrc::value_type(TCrc(check.begin(), check.end())) != expected)
+    {
+      return false;
+    }
+
+    std::vector<uint8_t> data(100);
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 97) + 13);
+    }
+
+    for (size_t length = 0; length <= data.size(); ++length)
+    {
+      typename TCrc::value_type crc1 = TCrc(data.begin(), data.begin() + length);
+      typename TCrc::value_type crc2 = TCrc(data.data(), data.data() + length);
+
+      if (crc1 != crc2)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Checks that combining the CRCs of every split of a range gives the CRC
+  /// of the whole range.
+  //***************************************************************************
+  template <typename TCrc>
+  bool check_crc_combine()
+  {
+    std::vector<uint8_t> data(300);
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 61) + 7);
+    }
+
+    for (size_t length = 0; length <= data.size(); length += 23)
+    {
+      typename TCrc::value_type expected = TCrc(data.data(), data.data() + length);
+
+      for (size_t split = 0; split <= length; ++split)
+      {
+        typename TCrc::value_type crc1 = TCrc(data.data(), data.data() + split);
+        typename TCrc::value_type crc2 = TCrc(data.data() + split, data.data() + length);
+
+        if (etl::crc_combine<TCrc>(crc1, crc2, length - split) != expected)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// A selection of CRCs from the catalogue.
+  //***************************************************************************
+  template <const size_t TABLE_SIZE>
+  void check_crc_catalogue()
+  {
+    CHECK((check_crc_type<etl::crc_type<8,  0x07,       0x00,       0x00,       false, TABLE_SIZE> >(0xF4)));       // CRC-8/SMBUS
+    CHECK((check_crc_type<etl::crc_type<8,  0x31,       0x00,       0x00,       true,  TABLE_SIZE> >(0xA1)));       // CRC-8/MAXIM
+    CHECK((check_crc_type<etl::crc_type<12, 0x80F,      0x000,      0x000,      false, TABLE_SIZE> >(0xF5B)));      // CRC-12/DECT
+    CHECK((check_crc_type<etl::crc_type<16, 0x1021,     0xFFFF,     0xFFFF,     true,  TABLE_SIZE> >(0x906E)));     // CRC-16/X-25
+    CHECK((check_crc_type<etl::crc_type<16, 0x1021,     0xB2AA,     0x0000,     true,  TABLE_SIZE> >(0x63D0)));     // CRC-16/RIELLO
+    CHECK((check_crc_type<etl::crc_type<16, 0x8BB7,     0x0000,     0x0000,     false, TABLE_SIZE> >(0xD0DB)));     // CRC-16/T10-DIF
+    CHECK((check_crc_type<etl::crc_type<24, 0x864CFB,   0xB704CE,   0x000000,   false, TABLE_SIZE> >(0x21CF02)));   // CRC-24/OPENPGP
+    CHECK((check_crc_type<etl::crc_type<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false, TABLE_SIZE> >(0xFC891918))); // CRC-32/BZIP2
+    CHECK((check_crc_type<etl::crc_type<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true,  TABLE_SIZE> >(0xCBF43926))); // CRC-32
+    CHECK((check_crc_type<etl::crc_type<40, 0x0004820009ULL, 0x0000000000ULL, 0xFFFFFFFFFFULL, false, TABLE_SIZE> >(0xD4164FC646ULL))); // CRC-40/GSM
+    CHECK((check_crc_type<etl::crc_type<64, 0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, true, TABLE_SIZE> >(0x995DC9BBDF1939FAULL))); // CRC-64/XZ
+  }
+
   SUITE(test_crc)
   {
     //*************************************************************************
@@ -325,6 +416,78 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc32_add_range_contiguous)
+    {
+      std::vector<uint8_t> data(1024);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37) + (i >> 3));
+      }
+
+      // Every length and alignment up to a few blocks of the largest block size.
+      for (size_t offset = 0; offset < 16; ++offset)
+      {
+        for (size_t length = 0; length < 300; ++length)
+        {
+          uint32_t expected = etl::crc32(data.begin() + offset, data.begin() + offset + length);
+          uint32_t actual   = etl::crc32(&data[offset], &data[offset] + length);
+          CHECK_EQUAL(expected, actual);
+        }
+      }
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+      uint32_t actual   = etl::crc32(data.data(), data.data() + data.size());
+      CHECK_EQUAL(expected, actual);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_add_range_pointer)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c(data.c_str(), data.c_str() + data.size());
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_add_range_contiguous)
+    {
+      std::vector<uint8_t> data(1024);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37) + (i >> 3));
+      }
+
+      // Every length and alignment up to a few blocks of the largest block size.
+      for (size_t offset = 0; offset < 16; ++offset)
+      {
+        for (size_t length = 0; length < 300; ++length)
+        {
+          uint32_t expected = etl::crc32_c(data.begin() + offset, data.begin() + offset + length);
+          uint32_t actual   = etl::crc32_c(&data[offset], &data[offset] + length);
+          CHECK_EQUAL(expected, actual);
+        }
+      }
+
+      uint32_t expected = etl::crc32_c(data.begin(), data.end());
+      uint32_t actual   = etl::crc32_c(data.data(), data.data() + data.size());
+      CHECK_EQUAL(expected, actual);
+    }
+
     //*************************************************************************
     TEST(test_crc64_ecma)
     {
@@ -380,6 +543,188 @@ namespace
       uint64_t crc3 = etl::crc64_ecma(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_add_range_contiguous)
+    {
+      std::vector<uint8_t> data(1024);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37) + (i >> 3));
+      }
+
+      // Every length and alignment up to a few blocks of the largest block size.
+      for (size_t offset = 0; offset < 16; ++offset)
+      {
+        for (size_t length = 0; length < 300; ++length)
+        {
+          uint64_t expected = etl::crc64_ecma(data.begin() + offset, data.begin() + offset + length);
+          uint64_t actual   = etl::crc64_ecma(&data[offset], &data[offset] + length);
+          CHECK_EQUAL(expected, actual);
+        }
+      }
+
+      uint64_t expected = etl::crc64_ecma(data.begin(), data.end());
+      uint64_t actual   = etl::crc64_ecma(data.data(), data.data() + data.size());
+      CHECK_EQUAL(expected, actual);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_type_nibble_table)
+    {
+      check_crc_catalogue<16>();
+    }
+
+    //*************************************************************************
+    TEST(test_crc_type_byte_table)
+    {
+      check_crc_catalogue<256>();
+    }
+
+    //*************************************************************************
+    TEST(test_crc_type_slice_by_4)
+    {
+      check_crc_catalogue<1024>();
+    }
+
+    //*************************************************************************
+    TEST(test_crc_type_slice_by_8)
+    {
+      check_crc_catalogue<2048>();
+    }
+
+    //*************************************************************************
+    TEST(test_crc_type_matches_predefined)
+    {
+      std::string data("123456789");
+
+      uint16_t crc16  = etl::crc_type<16, 0x8005, 0x0000, 0x0000, true, 16>(data.begin(), data.end());
+      uint16_t crc16k = etl::crc_type<16, 0x1021, 0x0000, 0x0000, true, 1024>(data.begin(), data.end());
+
+      CHECK_EQUAL(uint16_t(etl::crc16(data.begin(), data.end())), crc16);
+      CHECK_EQUAL(uint16_t(etl::crc16_kermit(data.begin(), data.end())), crc16k);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine)
+    {
+      CHECK(check_crc_combine<etl::crc8_ccitt>());
+      CHECK(check_crc_combine<etl::crc16>());
+      CHECK(check_crc_combine<etl::crc16_ccitt>());
+      CHECK(check_crc_combine<etl::crc16_kermit>());
+      CHECK(check_crc_combine<etl::crc32>());
+      CHECK(check_crc_combine<etl::crc32_c>());
+      CHECK(check_crc_combine<etl::crc64_ecma>());
+      CHECK((check_crc_combine<etl::crc_type<12, 0x80F,      0x000,      0x000,      false> >()));    // CRC-12/DECT
+      CHECK((check_crc_combine<etl::crc_type<16, 0x1021,     0xB2AA,     0x0000,     true> >()));     // CRC-16/RIELLO
+      CHECK((check_crc_combine<etl::crc_type<24, 0x864CFB,   0xB704CE,   0x000000,   false> >()));    // CRC-24/OPENPGP
+      CHECK((check_crc_combine<etl::crc_type<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false> >()));    // CRC-32/BZIP2
+      CHECK((check_crc_combine<etl::crc_type<64, 0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, true> >())); // CRC-64/XZ
+    }
+
+#if ETL_HAS_CRC_PARALLEL
+    //*************************************************************************
+    TEST(test_crc_parallel)
+    {
+      std::vector<uint8_t> data(10000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 131) + 5);
+      }
+
+      const size_t lengths[] = { 0, 1, 3, 17, 1000, 9999, 10000 };
+
+      for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); ++l)
+      {
+        const size_t length = lengths[l];
+
+        uint32_t crc32_expected = etl::crc32(data.data(), data.data() + length);
+        uint64_t crc64_expected = etl::crc64_ecma(data.begin(), data.begin() + length);
+
+        for (size_t threads = 0; threads <= ETL_CRC_PARALLEL_MAX_THREADS + 1; ++threads)
+        {
+          CHECK_EQUAL(crc32_expected, etl::crc_parallel<etl::crc32>(data.data(), data.data() + length, threads));
+          CHECK_EQUAL(crc64_expected, etl::crc_parallel<etl::crc64_ecma>(data.begin(), data.begin() + length, threads));
+        }
+      }
+    }
+
+#if defined(ETL_THROW_EXCEPTIONS)
+    //*************************************************************************
+    // An iterator that throws when the first element of the data is read.
+    //*************************************************************************
+    struct throwing_iterator
+    {
+      typedef std::forward_iterator_tag iterator_category;
+      typedef uint8_t                   value_type;
+      typedef ptrdiff_t                 difference_type;
+      typedef const uint8_t*            pointer;
+      typedef const uint8_t&            reference;
+
+      throwing_iterator()
+        : p(nullptr)
+        , p_throw(nullptr)
+      {
+      }
+
+      throwing_iterator(const uint8_t* p_, const uint8_t* p_throw_)
+        : p(p_)
+        , p_throw(p_throw_)
+      {
+      }
+
+      reference operator *() const
+      {
+        if (p == p_throw)
+        {
+          throw std::runtime_error("read");
+        }
+
+        return *p;
+      }
+
+      throwing_iterator& operator ++()
+      {
+        ++p;
+        return *this;
+      }
+
+      throwing_iterator operator ++(int)
+      {
+        throwing_iterator temp(*this);
+        ++p;
+        return temp;
+      }
+
+      bool operator ==(const throwing_iterator& other) const
+      {
+        return p == other.p;
+      }
+
+      bool operator !=(const throwing_iterator& other) const
+      {
+        return p != other.p;
+      }
+
+      const uint8_t* p;
+      const uint8_t* p_throw;
+    };
+
+    //*************************************************************************
+    TEST(test_crc_parallel_exception_joins_workers)
+    {
+      std::vector<uint8_t> data(10000, 0x5A);
+
+      // The calling thread's chunk throws while the workers are running.
+      throwing_iterator begin(data.data(), data.data());
+      throwing_iterator end(data.data() + data.size(), data.data());
+
+      CHECK_THROW(etl::crc_parallel<etl::crc32>(begin, end, 4), std::runtime_error);
+    }
+#endif
+#endif
   };
 }
 
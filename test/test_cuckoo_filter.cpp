@@ -0,0 +1,253 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <stdint.h>
+
+#include "cuckoo_filter.h"
+
+#include "fnv_1.h"
+#include "char_traits.h"
+
+namespace
+{
+  struct text_hash_t
+  {
+    typedef const char* argument_type;
+
+    size_t operator ()(argument_type text) const
+    {
+      return etl::fnv_1a_32(text, text + etl::char_traits<char>::length(text));
+    }
+  };
+
+  // Deliberately weak, to check that the filter mixes the hash.
+  struct int_hash_t
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(argument_type value) const
+    {
+      return value;
+    }
+  };
+
+  const char* exist_words[]     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
+  const char* not_exist_words[] = { "My", "hovercraft", "is", "full", "of", "eels" };
+
+  const size_t N_EXIST     = sizeof(exist_words) / sizeof(exist_words[0]);
+  const size_t N_NOT_EXIST = sizeof(not_exist_words) / sizeof(not_exist_words[0]);
+
+  SUITE(test_cuckoo_filter)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      typedef etl::cuckoo_filter<100, 12, text_hash_t> Filter;
+
+      Filter filter;
+
+      // 100 keys at 95% load need 27 buckets, rounded up to 32.
+      CHECK_EQUAL(32U, size_t(Filter::NUMBER_OF_BUCKETS));
+      CHECK_EQUAL(128U, filter.capacity());
+      CHECK_EQUAL(2U, sizeof(Filter::fingerprint_type));
+      CHECK_EQUAL(1U, sizeof(etl::cuckoo_filter<100, 8, text_hash_t>::fingerprint_type));
+
+      CHECK(filter.empty());
+      CHECK(!filter.full());
+      CHECK_EQUAL(0U, filter.size());
+      CHECK_CLOSE(0.0f, filter.load_factor(), 0.0001f);
+    }
+
+    //*************************************************************************
+    TEST(test_add_exists)
+    {
+      etl::cuckoo_filter<64, 16, text_hash_t> filter;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        CHECK(filter.add(exist_words[i]));
+      }
+
+      CHECK_EQUAL(N_EXIST, filter.size());
+      CHECK(!filter.empty());
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        all_exist = all_exist && filter.exists(exist_words[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0; i < N_NOT_EXIST; ++i)
+      {
+        any_exist = any_exist || filter.exists(not_exist_words[i]);
+      }
+
+      CHECK(!any_exist);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      etl::cuckoo_filter<64, 16, text_hash_t> filter;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        filter.add(exist_words[i]);
+      }
+
+      CHECK(filter.erase("rain"));
+      CHECK(!filter.exists("rain"));
+      CHECK(!filter.erase("rain"));
+      CHECK_EQUAL(N_EXIST - 1, filter.size());
+
+      // The others are unaffected.
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        if (etl::char_traits<char>::compare(exist_words[i], "rain", 5) != 0)
+        {
+          CHECK(filter.exists(exist_words[i]));
+        }
+      }
+
+      // Duplicates are counted and erased one at a time.
+      filter.add("plain");
+      CHECK(filter.erase("plain"));
+      CHECK(filter.exists("plain"));
+      CHECK(filter.erase("plain"));
+      CHECK(!filter.exists("plain"));
+    }
+
+    //*************************************************************************
+    TEST(test_fill_until_full)
+    {
+      typedef etl::cuckoo_filter<256, 16, int_hash_t> Filter;
+
+      Filter filter;
+
+      uint32_t key = 0;
+
+      while (filter.add(key))
+      {
+        ++key;
+      }
+
+      CHECK(filter.full());
+      CHECK_EQUAL(size_t(key), filter.size());
+      CHECK(filter.load_factor() > 0.9f);
+
+      // No false negatives, including for the fingerprint held aside when full.
+      bool all_exist = true;
+
+      for (uint32_t i = 0; i < key; ++i)
+      {
+        all_exist = all_exist && filter.exists(i);
+      }
+
+      CHECK(all_exist);
+
+      // Erasing makes room for the held fingerprint.
+      CHECK(filter.erase(0U));
+      CHECK(!filter.full());
+      CHECK_EQUAL(size_t(key - 1), filter.size());
+
+      all_exist = true;
+
+      for (uint32_t i = 1; i < key; ++i)
+      {
+        all_exist = all_exist && filter.exists(i);
+      }
+
+      CHECK(all_exist);
+
+      // Erase everything.
+      for (uint32_t i = 1; i < key; ++i)
+      {
+        CHECK(filter.erase(i));
+      }
+
+      CHECK(filter.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_false_positive_rate)
+    {
+      const uint32_t N_KEYS = 2000;
+
+      etl::cuckoo_filter<N_KEYS, 12, int_hash_t> filter;
+
+      for (uint32_t i = 0; i < N_KEYS; ++i)
+      {
+        CHECK(filter.add(i));
+      }
+
+      size_t false_positives = 0;
+
+      for (uint32_t i = N_KEYS; i < (N_KEYS + 100000); ++i)
+      {
+        false_positives += filter.exists(i) ? 1 : 0;
+      }
+
+      CHECK(false_positives < 1000); // Less than 1%
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::cuckoo_filter<64, 8, text_hash_t> filter;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        filter.add(exist_words[i]);
+      }
+
+      filter.clear();
+
+      CHECK(filter.empty());
+      CHECK_EQUAL(0U, filter.size());
+
+      bool any_exist = false;
+
+      for (size_t i = 0; i < N_EXIST; ++i)
+      {
+        any_exist = any_exist || filter.exists(exist_words[i]);
+      }
+
+      CHECK(!any_exist);
+    }
+  };
+}
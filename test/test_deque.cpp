@@ -35,10 +35,59 @@ SOFTWARE.
 
 #include <vector>
 #include <deque>
+#include <string>
 #include <algorithm>
 #include <iostream>
 #include <numeric>
 #include <cstring>
+#include <memory>
+
+namespace
+{
+  // A non-trivial class, declared trivially relocatable, that counts its instances.
+  struct Relocatable
+  {
+    Relocatable(int value_ = 0)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Relocatable(const Relocatable& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    ~Relocatable()
+    {
+      --instances;
+    }
+
+    Relocatable& operator =(const Relocatable& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    friend bool operator ==(const Relocatable& lhs, const Relocatable& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Relocatable::instances = 0;
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Relocatable> : etl::true_type {};
+}
 
 namespace
 {
@@ -1746,5 +1795,201 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST(test_insert_self)
+    {
+      // Inserting an element of the deque itself must use its value before the shift.
+      etl::deque<int, 10> data;
+      std::deque<int>     compare;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        data.push_back(i * 10);
+        compare.push_back(i * 10);
+      }
+
+      data.insert(data.begin() + 1, data[4]);
+      compare.insert(compare.begin() + 1, compare[4]);
+
+      data.insert(data.begin() + 5, data[0]);
+      compare.insert(compare.begin() + 5, compare[0]);
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      etl::deque<std::string, 10> text;
+      text.push_back("A");
+      text.push_back("B");
+      text.push_back("C");
+      text.push_back("D");
+
+      text.insert(text.begin() + 1, text[3]);
+      text.insert(text.begin() + 4, text[0]);
+
+      CHECK_EQUAL(std::string("A"), text[0]);
+      CHECK_EQUAL(std::string("D"), text[1]);
+      CHECK_EQUAL(std::string("B"), text[2]);
+      CHECK_EQUAL(std::string("C"), text[3]);
+      CHECK_EQUAL(std::string("A"), text[4]);
+      CHECK_EQUAL(std::string("D"), text[5]);
+
+      etl::deque<Relocatable, 10> relocatable;
+      relocatable.push_back(Relocatable(1));
+      relocatable.push_back(Relocatable(2));
+      relocatable.push_back(Relocatable(3));
+
+      relocatable.insert(relocatable.begin() + 1, relocatable[2]);
+
+      CHECK_EQUAL(3, relocatable[1].value);
+      CHECK_EQUAL(2, relocatable[2].value);
+    }
+
+    //*************************************************************************
+    TEST(test_relocatable_insert_erase)
+    {
+      {
+        etl::deque<Relocatable, SIZE> data;
+        std::deque<Relocatable>       compare_data;
+
+        // Start part way through the buffer so that the elements wrap around.
+        for (int i = 0; i < 6; ++i)
+        {
+          data.push_back(i);
+          data.pop_front();
+        }
+
+        for (int i = 0; i < int(SIZE) - 1; ++i)
+        {
+          size_t offset = (i * 7) % (compare_data.size() + 1);
+
+          data.insert(data.begin() + offset, Relocatable(i));
+          compare_data.insert(compare_data.begin() + offset, Relocatable(i));
+
+          CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+        }
+
+        CHECK_EQUAL(int(2 * (SIZE - 1)), Relocatable::instances);
+
+        data.emplace(data.begin() + 5, 99);
+        CHECK_EQUAL(int(2 * SIZE - 1), Relocatable::instances);
+        data.erase(data.begin() + 5);
+
+        for (int i = 0; i < 4; ++i)
+        {
+          size_t offset = (i * 5) % compare_data.size();
+
+          data.erase(data.begin() + offset);
+          compare_data.erase(compare_data.begin() + offset);
+
+          CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+        }
+
+        data.erase(data.begin() + 2, data.begin() + 5);
+        compare_data.erase(compare_data.begin() + 2, compare_data.begin() + 5);
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        data.erase(data.end() - 5, data.end() - 2);
+        compare_data.erase(compare_data.end() - 5, compare_data.end() - 2);
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK_EQUAL(int(2 * compare_data.size()), Relocatable::instances);
+      }
+
+      CHECK_EQUAL(0, Relocatable::instances);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_push_back_push_front_move)
+    {
+      etl::deque<std::unique_ptr<int>, SIZE> data;
+
+      std::unique_ptr<int> p1(new int(1));
+      std::unique_ptr<int> p2(new int(2));
+
+      data.push_back(std::move(p2));
+      data.push_front(std::move(p1));
+
+      CHECK(!p1);
+      CHECK(!p2);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, *data[0]);
+      CHECK_EQUAL(2, *data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      etl::deque<std::unique_ptr<int>, SIZE> data;
+
+      data.insert(data.end(), std::unique_ptr<int>(new int(4)));
+      data.insert(data.begin(), std::unique_ptr<int>(new int(1)));
+      data.insert(data.begin() + 1, std::unique_ptr<int>(new int(2)));
+      data.insert(data.begin() + 2, std::unique_ptr<int>(new int(3)));
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(1, *data[0]);
+      CHECK_EQUAL(2, *data[1]);
+      CHECK_EQUAL(3, *data[2]);
+      CHECK_EQUAL(4, *data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::deque<Five, SIZE> data;
+
+      data.emplace_back(1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+      data.emplace_front(2, 3, 4, 5, std::unique_ptr<int>(new int(6)));
+      data.emplace(data.begin() + 1, 0, 0, 0, 0, std::unique_ptr<int>(new int(1)));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(20, data[0].sum);
+      CHECK_EQUAL(1,  data[1].sum);
+      CHECK_EQUAL(15, data[2].sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::deque<std::unique_ptr<int>, SIZE> Data;
+
+      Data data1;
+      data1.push_back(std::unique_ptr<int>(new int(1)));
+      data1.push_back(std::unique_ptr<int>(new int(2)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(2, *data2[1]);
+
+      Data data3;
+      data3.push_back(std::unique_ptr<int>(new int(3)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(1, *data3[0]);
+
+      etl::ideque<std::unique_ptr<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+    }
+#endif
   };
 }
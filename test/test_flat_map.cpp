@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <memory>
 
 #include <iostream>
 
@@ -189,22 +190,6 @@ namespace
     return true;
   }
 
-  //*************************************************************************
-  std::ostream& operator <<(std::ostream& os, const DataNDC::iterator& itr)
-  {
-    os << itr->first;
-
-    return os;
-  }
-
-  //*************************************************************************
-  std::ostream& operator <<(std::ostream& os, const DataNDC::const_iterator& itr)
-  {
-    os << itr->first;
-
-    return os;
-  }
-
   SUITE(test_flat_map)
   {
     NDC N0 = NDC("A");
@@ -482,6 +467,55 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_inserts_out_of_order)
+    {
+      Compare_DataDC compare_data;
+      DataDC data;
+
+      data[5] = M5;
+      compare_data[5] = M5;
+      data[1] = M1;
+      compare_data[1] = M1;
+      data[3] = M3;
+      compare_data[3] = M3;
+      data[1] = M2;
+      compare_data[1] = M2;
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      etl::flat_map<std::string, int, SIZE> data;
+      std::map<std::string, int> compare_data;
+
+      const char* keys[] = { "E", "B", "H", "A", "J", "C", "G", "D", "I", "F" };
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        data.insert(std::make_pair(std::string(keys[i]), int(i)));
+        compare_data.insert(std::make_pair(std::string(keys[i]), int(i)));
+      }
+
+      data.erase("C");
+      compare_data.erase("C");
+      data.erase(data.find("A"), data.find("E"));
+      compare_data.erase(compare_data.find("A"), compare_data.find("E"));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(data.find("B") == data.end());
+      CHECK_EQUAL(compare_data["H"], data.at("H"));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_at)
     {
@@ -695,6 +729,70 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      // Out of order, with keys that are repeated and keys already in the map.
+      ElementNDC existing[] = { ElementNDC(7, N7), ElementNDC(3, N3), ElementNDC(5, N5) };
+      ElementNDC values[]   = { ElementNDC(9, N9), ElementNDC(3, N13), ElementNDC(0, N0), ElementNDC(6, N6), ElementNDC(2, N2),
+                                ElementNDC(0, N0), ElementNDC(8, N8), ElementNDC(1, N1), ElementNDC(4, N4), ElementNDC(7, N17) };
+
+      DataNDC data(std::begin(existing), std::end(existing));
+
+      data.insert_range(std::begin(values), std::end(values));
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      // Repeated keys do not use space.
+      CHECK_NO_THROW(data.insert_range(initial_data.rbegin(), initial_data.rend()));
+      CHECK_EQUAL(SIZE, data.size());
+
+      data.clear();
+
+      CHECK_THROW(data.insert_range(excess_data.rbegin(), excess_data.rend()), etl::flat_map_full);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_assign_unsorted)
+    {
+      typedef etl::flat_map<int, int, 1000> Data;
+
+      std::vector<std::pair<int, int> > values;
+      std::map<int, int> compare_data;
+
+      for (int i = 0; i < 1500; ++i)
+      {
+        int key = (i * 7919) % 1000;
+        values.push_back(std::make_pair(key, i));
+        compare_data.insert(std::make_pair(key, i));
+      }
+
+      Data data;
+      data.insert(std::make_pair(1001, 0));
+      data.assign_unsorted(values.begin(), values.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      Data::const_iterator itr = data.begin();
+
+      for (std::map<int, int>::const_iterator compare_itr = compare_data.begin(); compare_itr != compare_data.end(); ++compare_itr, ++itr)
+      {
+        CHECK_EQUAL(compare_itr->first, itr->first);
+        CHECK(itr->second % 1000 == compare_itr->second % 1000);
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -740,6 +838,24 @@ namespace
       CHECK(!result.second);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_emplace_existing_key_when_full)
+    {
+      DataInt data;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        data.emplace(int(i), int(i * 10));
+      }
+
+      std::pair<DataInt::iterator, bool> result = data.emplace(2, 0);
+      CHECK(!result.second);
+      CHECK_EQUAL(20, result.first->second);
+      CHECK_EQUAL(SIZE, data.size());
+
+      CHECK_THROW(data.emplace(int(SIZE), 0), etl::flat_map_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value2)
     {
@@ -1152,5 +1268,86 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef etl::flat_map<int, std::unique_ptr<int>, SIZE> Data;
+
+      Data data;
+
+      data.insert(Data::value_type(3, std::unique_ptr<int>(new int(30))));
+      data.insert(Data::value_type(1, std::unique_ptr<int>(new int(10))));
+      data.insert(data.begin(), Data::value_type(2, std::unique_ptr<int>(new int(20))));
+
+      Data::value_type duplicate(2, std::unique_ptr<int>(new int(0)));
+      std::pair<Data::iterator, bool> result = data.insert(std::move(duplicate));
+
+      CHECK(!result.second);
+      CHECK(duplicate.second); // Duplicate key, so not moved.
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, *data.at(1));
+      CHECK_EQUAL(20, *data.at(2));
+      CHECK_EQUAL(30, *data.at(3));
+
+      data.erase(1);
+      CHECK_EQUAL(20, *data.begin()->second);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::flat_map<int, Five, SIZE> data;
+
+      data.emplace(2, 1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+      data.emplace(1, 2, 3, 4, 5, std::unique_ptr<int>(new int(6)));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(20, data.at(1).sum);
+      CHECK_EQUAL(15, data.at(2).sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::flat_map<int, std::unique_ptr<int>, SIZE> Data;
+
+      Data data1;
+      data1.emplace(1, std::unique_ptr<int>(new int(10)));
+      data1.emplace(2, std::unique_ptr<int>(new int(20)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(20, *data2.at(2));
+
+      Data data3;
+      data3.emplace(3, std::unique_ptr<int>(new int(30)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK(data3.find(3) == data3.end());
+
+      etl::iflat_map<int, std::unique_ptr<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(10, *data2.at(1));
+    }
+#endif
   };
 }
@@ -549,6 +549,53 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 4);
+
+      data.insert_range(multi_data.rbegin(), multi_data.rbegin() + 6);
+
+      CHECK_EQUAL(multi_data.size(), data.size());
+
+      // The order of equal keys from the range is unspecified.
+      for (size_t i = 0; i < multi_data.size(); ++i)
+      {
+        std::pair<DataNDC::iterator, DataNDC::iterator> range = data.equal_range(multi_data[i].first);
+
+        bool found = false;
+
+        for (DataNDC::iterator itr = range.first; itr != range.second; ++itr)
+        {
+          found = found || (itr->second == multi_data[i].second);
+        }
+
+        CHECK(found);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 5);
+
+      CHECK_THROW(data.insert_range(multi_data.begin(), multi_data.end()), etl::flat_multimap_full);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(initial_data.rbegin(), initial_data.rend());
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -1014,5 +1061,89 @@ namespace
       CHECK_EQUAL(compare_data.count(4), data.count(4));
       CHECK_EQUAL(compare_data.count(5), data.count(5));
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_multimap<int, M, SIZE> Data;
+
+      Data data;
+
+      data.insert(Data::value_type(3, M(30)));
+      data.insert(data.begin(), Data::value_type(1, M(10)));
+
+      Data::value_type value(1, M(11));
+      data.insert(std::move(value));
+
+      CHECK(!value.second.valid);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(1));
+      CHECK_EQUAL(30, data.rbegin()->second.value);
+      CHECK(std::all_of(data.begin(), data.end(), [](const Data::value_type& v) { return v.second.valid; }));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_multimap<int, M, SIZE> Data;
+
+      Data data;
+
+      data.emplace(2, 20);
+      data.emplace(1, 10);
+      data.emplace(2, 21);
+      data.emplace(Data::value_type(3, M(30)));
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(2U, data.count(2));
+      CHECK_EQUAL(10, data.begin()->second.value);
+      CHECK_EQUAL(30, data.rbegin()->second.value);
+
+      while (!data.full())
+      {
+        data.emplace(0, 0);
+      }
+
+      CHECK_THROW(data.emplace(0, 0), etl::flat_multimap_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_multimap<int, M, SIZE> Data;
+
+      Data data1;
+      data1.emplace(1, 10);
+      data1.emplace(2, 20);
+      data1.emplace(2, 21);
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(2U, data2.count(2));
+
+      Data data3;
+      data3.emplace(3, 30);
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+      CHECK(data3.find(3) == data3.end());
+
+      etl::iflat_multimap<int, M>& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(10, data2.begin()->second.value);
+      CHECK(std::all_of(data2.begin(), data2.end(), [](const Data::value_type& v) { return v.second.valid; }));
+    }
+#endif
   };
 }
@@ -512,6 +512,43 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 4);
+
+      data.insert_range(multi_data.rbegin(), multi_data.rbegin() + 6);
+
+      Compare_DataNDC compare_data(multi_data.begin(), multi_data.begin() + 4);
+      compare_data.insert(multi_data.rbegin(), multi_data.rbegin() + 6);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 5);
+
+      CHECK_THROW(data.insert_range(multi_data.begin(), multi_data.end()), etl::flat_multiset_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(multi_data.begin(), multi_data.end());
+
+      Compare_DataNDC compare_data(multi_data.begin(), multi_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -972,5 +1009,83 @@ namespace
       CHECK_EQUAL(compare_data.count(N3), data.count(N3));
       CHECK_EQUAL(compare_data.count(N4), data.count(N4));
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef TestDataM<int> M;
+      etl::flat_multiset<M, SIZE> data;
+
+      data.insert(M(3));
+      data.insert(data.begin(), M(1));
+
+      M value(1);
+      data.insert(std::move(value));
+
+      CHECK(!value.valid);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(M(1)));
+      CHECK_EQUAL(3, data.rbegin()->value);
+      CHECK(std::all_of(data.begin(), data.end(), [](const M& m) { return m.valid; }));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      typedef TestDataM<int> M;
+      etl::flat_multiset<M, SIZE> data;
+
+      data.emplace(2);
+      data.emplace(1);
+      data.emplace(2);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(M(2)));
+      CHECK_EQUAL(1, data.begin()->value);
+
+      while (!data.full())
+      {
+        data.emplace(0);
+      }
+
+      CHECK_THROW(data.emplace(0), etl::flat_multiset_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_multiset<M, SIZE> Data;
+
+      Data data1;
+      data1.emplace(1);
+      data1.emplace(2);
+      data1.emplace(2);
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(2U, data2.count(M(2)));
+
+      Data data3;
+      data3.emplace(3);
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+      CHECK_EQUAL(0U, data3.count(M(3)));
+
+      etl::iflat_multiset<M>& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(1, data2.begin()->value);
+      CHECK(std::all_of(data2.begin(), data2.end(), [](const M& m) { return m.valid; }));
+    }
+#endif
   };
 }
@@ -520,6 +520,49 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      // Out of order, with values that are repeated and values already in the set.
+      NDC values[] = { N9, N3, N0, N6, N2, N0, N8, N1, N4, N7 };
+
+      DataNDC data(initial_data.begin() + 3, initial_data.begin() + 8);
+
+      data.insert_range(std::begin(values), std::end(values));
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      // Repeated values do not use space.
+      CHECK_NO_THROW(data.insert_range(initial_data.rbegin(), initial_data.rend()));
+      CHECK_EQUAL(SIZE, data.size());
+
+      data.clear();
+
+      CHECK_THROW(data.insert_range(excess_data.rbegin(), excess_data.rend()), etl::flat_set_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(initial_data.rbegin(), initial_data.rend());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), initial_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -906,5 +949,99 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_set<M, SIZE> Data;
+
+      Data data;
+
+      data.insert(M(3));
+      data.insert(data.begin(), M(1));
+
+      M value(2);
+      std::pair<Data::iterator, bool> result = data.insert(std::move(value));
+
+      CHECK(result.second);
+      CHECK(!value.valid);
+
+      M duplicate(2);
+      result = data.insert(std::move(duplicate));
+
+      CHECK(!result.second);
+      CHECK(duplicate.valid); // Already in the set, so not moved.
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.begin()->value);
+      CHECK_EQUAL(3, data.rbegin()->value);
+      CHECK(std::all_of(data.begin(), data.end(), [](const M& m) { return m.valid; }));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_set<M, SIZE> Data;
+
+      Data data;
+
+      data.emplace(2);
+      data.emplace(1);
+
+      std::pair<Data::iterator, bool> result = data.emplace(2);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->value);
+      CHECK_EQUAL(2U, data.size());
+
+      for (int i = 3; !data.full(); ++i)
+      {
+        data.emplace(i);
+      }
+
+      // Full, but the value is already there.
+      result = data.emplace(2);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->value);
+      CHECK_THROW(data.emplace(0), etl::flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::flat_set<M, SIZE> Data;
+
+      Data data1;
+      data1.emplace(1);
+      data1.emplace(2);
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, data2.begin()->value);
+
+      Data data3;
+      data3.emplace(3);
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK(data3.find(M(3)) == data3.end());
+
+      etl::iflat_set<M>& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(2, data2.rbegin()->value);
+      CHECK(std::all_of(data2.begin(), data2.end(), [](const M& m) { return m.valid; }));
+    }
+#endif
   };
 }
@@ -0,0 +1,636 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <map>
+#include <set>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+
+#include "data.h"
+
+#include "flat_unordered_map.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Sends every key to the same home slot, to give long probe runs.
+  struct collide_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 0;
+    }
+  };
+
+  //*************************************************************************
+  template <typename TMap>
+  bool Check_Same(const TMap& data, const std::map<typename TMap::key_type, typename TMap::mapped_type>& compare)
+  {
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    size_t visited = 0;
+
+    for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+    {
+      typename std::map<typename TMap::key_type, typename TMap::mapped_type>::const_iterator other = compare.find(itr->first);
+
+      if ((other == compare.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+
+      ++visited;
+    }
+
+    return visited == compare.size();
+  }
+
+  SUITE(test_flat_unordered_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef TestDataDC<std::string>  DC;
+    typedef TestDataNDC<std::string> NDC;
+
+    typedef std::pair<std::string, DC>  ElementDC;
+    typedef std::pair<std::string, NDC> ElementNDC;
+
+    typedef etl::flat_unordered_map<std::string, DC,  SIZE, simple_hash> DataDC;
+    typedef etl::flat_unordered_map<std::string, NDC, SIZE, simple_hash> DataNDC;
+    typedef etl::iflat_unordered_map<std::string, NDC, simple_hash> IDataNDC;
+
+    typedef etl::flat_unordered_map<int, int, 12, collide_hash> DataCollide;
+
+    NDC N0 = NDC("A");
+    NDC N1 = NDC("B");
+    NDC N2 = NDC("C");
+    NDC N3 = NDC("D");
+    NDC N4 = NDC("E");
+    NDC N5 = NDC("F");
+    NDC N6 = NDC("G");
+    NDC N7 = NDC("H");
+    NDC N8 = NDC("I");
+    NDC N9 = NDC("J");
+    NDC N10 = NDC("K");
+
+    DC M0 = DC("A");
+    DC M1 = DC("B");
+    DC M2 = DC("C");
+    DC M3 = DC("D");
+    DC M4 = DC("E");
+    DC M5 = DC("F");
+    DC M6 = DC("G");
+    DC M7 = DC("H");
+    DC M8 = DC("I");
+    DC M9 = DC("J");
+
+    const char* K0  = "FF";
+    const char* K1  = "FG";
+    const char* K2  = "FH";
+    const char* K3  = "FI";
+    const char* K4  = "FJ";
+    const char* K5  = "FK";
+    const char* K6  = "FL";
+    const char* K7  = "FM";
+    const char* K8  = "FN";
+    const char* K9  = "FO";
+    const char* K10 = "FP";
+
+    std::vector<ElementDC> initial_data_dc;
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9)
+        };
+
+        ElementNDC n2[] =
+        {
+          ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9),
+          ElementNDC(K10, N10)
+        };
+
+        ElementDC n3[] =
+        {
+          ElementDC(K0, M0), ElementDC(K1, M1), ElementDC(K2, M2), ElementDC(K3, M3), ElementDC(K4, M4),
+          ElementDC(K5, M5), ElementDC(K6, M6), ElementDC(K7, M7), ElementDC(K8, M8), ElementDC(K9, M9)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n2), std::end(n2));
+        initial_data_dc.assign(std::begin(n3), std::end(n3));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataDC data;
+
+      CHECK_EQUAL(data.size(), size_t(0));
+      CHECK(data.empty());
+      CHECK_EQUAL(data.max_size(), SIZE);
+      CHECK_EQUAL(16U, data.slot_count());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_slot_count)
+    {
+      CHECK_EQUAL(16U,  size_t(etl::flat_unordered_map<int, int, 14>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(32U,  size_t(etl::flat_unordered_map<int, int, 15>::NUMBER_OF_SLOTS));
+      CHECK_EQUAL(128U, size_t(etl::flat_unordered_map<int, int, 100>::NUMBER_OF_SLOTS));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataDC data(initial_data_dc.begin(), initial_data_dc.end());
+
+      CHECK(data.size() == SIZE);
+      CHECK(!data.empty());
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_destruct_via_iflat_unordered_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(initial_data.begin(), initial_data.end());
+      CHECK_EQUAL(int(current_count + SIZE), NDC::get_instance_count());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data;
+
+      other_data = data;
+
+      CHECK(data == other_data);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data(data);
+
+      other_data = other_data;
+
+      CHECK(data == other_data);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read_write)
+    {
+      DataDC data(initial_data_dc.begin(), initial_data_dc.end());
+
+      CHECK_EQUAL(M0, data[K0]);
+      CHECK_EQUAL(M5, data[K5]);
+      CHECK_EQUAL(M9, data[K9]);
+
+      data[K0] = M9;
+      data[K9] = M0;
+
+      CHECK_EQUAL(M9, data[K0]);
+      CHECK_EQUAL(M0, data[K9]);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_insert)
+    {
+      DataDC data;
+
+      data[K3] = M3;
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(M3, data.at(K3));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(N0, data.at(K0));
+      CHECK_EQUAL(N9, cdata.at(K9));
+
+      CHECK_THROW(data.at(K10), etl::flat_unordered_map_out_of_range);
+      CHECK_THROW(cdata.at(K10), etl::flat_unordered_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      std::pair<DataNDC::iterator, bool> result = data.insert(DataNDC::value_type(K0, N0));
+
+      CHECK(result.second);
+      CHECK_EQUAL(K0, result.first->first);
+      CHECK_EQUAL(N0, result.first->second);
+
+      // Inserting an existing key does not replace the value.
+      result = data.insert(DataNDC::value_type(K0, N1));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N0, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(std::make_pair(K10, N10)), etl::flat_unordered_map_full);
+
+      // An existing key is not an excess.
+      CHECK(!data.insert(std::make_pair(K5, N10)).second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_unordered_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_count)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      DataNDC::iterator itr = data.find(K3);
+      CHECK(itr != data.end());
+      CHECK_EQUAL(N3, itr->second);
+
+      DataNDC::const_iterator citr = cdata.find(K7);
+      CHECK(citr != cdata.end());
+      CHECK_EQUAL(N7, citr->second);
+
+      CHECK(data.find(K10) == data.end());
+      CHECK(cdata.find(K10) == cdata.end());
+
+      CHECK_EQUAL(1U, data.count(K3));
+      CHECK_EQUAL(0U, data.count(K10));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::pair<DataNDC::iterator, DataNDC::iterator> range = data.equal_range(K2);
+
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(N2, range.first->second);
+
+      range = data.equal_range(K10);
+
+      CHECK(range.first == data.end());
+      CHECK(range.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterate)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.begin(), data.end())));
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K5));
+      CHECK_EQUAL(0U, data.erase(K5));
+      CHECK_EQUAL(SIZE - 1, data.size());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+      compare.erase(K5);
+
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_while_iterating)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      // Erase every other element visited. Each element must be visited once.
+      size_t visited = 0;
+      bool   erase   = true;
+
+      DataNDC::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        ++visited;
+
+        if (erase)
+        {
+          compare.erase(itr->first);
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+
+        erase = !erase;
+      }
+
+      CHECK_EQUAL(SIZE, visited);
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator first = data.begin();
+      std::advance(first, 2);
+      DataNDC::iterator last = first;
+      std::advance(last, 5);
+
+      // The elements that iteration should carry on to.
+      std::set<std::string> following;
+
+      for (DataNDC::iterator itr = last; itr != data.end(); ++itr)
+      {
+        following.insert(itr->first);
+      }
+
+      for (DataNDC::iterator itr = first; itr != last; ++itr)
+      {
+        compare.erase(itr->first);
+      }
+
+      DataNDC::iterator result = data.erase(first, last);
+
+      std::set<std::string> visited;
+
+      for (DataNDC::iterator itr = result; itr != data.end(); ++itr)
+      {
+        visited.insert(itr->first);
+      }
+
+      CHECK(visited == following);
+      CHECK(Check_Same(data, compare));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range_all_positions)
+    {
+      typedef etl::flat_unordered_map<int, int, 28> Data;
+
+      for (int trial = 0; trial < 2; ++trial)
+      {
+        for (size_t offset = 0; offset <= 28; ++offset)
+        {
+          for (size_t length = 0; length <= (28 - offset); ++length)
+          {
+            Data data;
+            std::map<int, int> compare;
+
+            for (int i = 0; i < 28; ++i)
+            {
+              // Spread the keys differently on each trial.
+              int key = (trial == 0) ? i : i * 37;
+              data[key]    = i;
+              compare[key] = i;
+            }
+
+            Data::iterator first = data.begin();
+            std::advance(first, offset);
+            Data::iterator last = first;
+            std::advance(last, length);
+
+            std::set<int> following;
+
+            for (Data::iterator itr = last; itr != data.end(); ++itr)
+            {
+              following.insert(itr->first);
+            }
+
+            for (Data::iterator itr = first; itr != last; ++itr)
+            {
+              compare.erase(itr->first);
+            }
+
+            Data::iterator result = data.erase(first, last);
+
+            std::set<int> visited;
+
+            for (Data::iterator itr = result; itr != data.end(); ++itr)
+            {
+              visited.insert(itr->first);
+            }
+
+            CHECK(visited == following);
+            CHECK(Check_Same(data, compare));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(K0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      const DataNDC initial1(initial_data.begin(), initial_data.end());
+
+      // The same elements inserted in a different order.
+      std::vector<ElementNDC> reversed(initial_data.rbegin(), initial_data.rend());
+      const DataNDC initial2(reversed.begin(), reversed.end());
+
+      CHECK(initial1 == initial2);
+
+      DataNDC different(initial_data.begin(), initial_data.end());
+      different.at(K0) = N9;
+
+      CHECK(initial1 != different);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_load_factor)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_CLOSE(10.0f / 16.0f, data.load_factor(), 0.0001f);
+    }
+
+    //*************************************************************************
+    TEST(test_collisions)
+    {
+      // Every key has the same home, so every operation walks the probe run.
+      DataCollide data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < 12; ++i)
+      {
+        data[i] = i * 10;
+        compare[i] = i * 10;
+      }
+
+      CHECK(Check_Same(data, compare));
+
+      for (int i = 0; i < 12; i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+        compare.erase(i);
+
+        CHECK(Check_Same(data, compare));
+      }
+
+      for (int i = 0; i < 12; ++i)
+      {
+        CHECK_EQUAL(compare.count(i), data.count(i));
+      }
+
+      data[100] = 1000;
+      compare[100] = 1000;
+
+      CHECK(Check_Same(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      // Compare against std::map for a long mix of inserts and erases, with
+      // keys that cluster and wrap round the end of the slots.
+      etl::flat_unordered_map<int, int, 50> data;
+      std::map<int, int> compare;
+
+      uint32_t seed = 1;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245UL) + 12345UL;
+        const int key = int((seed >> 16) % 80);
+
+        if (((seed >> 8) & 1) == 0)
+        {
+          if (!data.full() || (data.count(key) != 0))
+          {
+            data[key] = i;
+            compare[key] = i;
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+
+        if ((i % 1000) == 0)
+        {
+          CHECK(Check_Same(data, compare));
+        }
+      }
+
+      CHECK(Check_Same(data, compare));
+    }
+  };
+}
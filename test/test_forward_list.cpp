@@ -39,6 +39,7 @@ SOFTWARE.
 #include <vector>
 #include <string>
 #include <list>
+#include <memory>
 
 namespace
 {
@@ -1215,5 +1216,82 @@ namespace
       CHECK(data1 < data3);
       CHECK(data3 > data1);
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_push_front_and_insert_after_move)
+    {
+      etl::forward_list<std::unique_ptr<int>, SIZE> data;
+
+      std::unique_ptr<int> p1(new int(1));
+
+      data.push_front(std::move(p1));
+      data.insert_after(data.begin(), std::unique_ptr<int>(new int(3)));
+      data.insert_after(data.begin(), std::unique_ptr<int>(new int(2)));
+
+      CHECK(!p1);
+      CHECK_EQUAL(3U, data.size());
+
+      etl::forward_list<std::unique_ptr<int>, SIZE>::iterator itr = data.begin();
+      CHECK_EQUAL(1, **itr++);
+      CHECK_EQUAL(2, **itr++);
+      CHECK_EQUAL(3, **itr++);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::forward_list<Five, SIZE> data;
+
+      data.emplace_front(1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+      data.emplace_after(data.begin(), 0, 0, 0, 0, std::unique_ptr<int>(new int(1)));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(15, data.front().sum);
+      CHECK_EQUAL(1,  (++data.begin())->sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::forward_list<std::unique_ptr<int>, SIZE> Data;
+
+      Data data1;
+      data1.push_front(std::unique_ptr<int>(new int(2)));
+      data1.push_front(std::unique_ptr<int>(new int(1)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, *data2.front());
+      CHECK_EQUAL(2, **(++data2.begin()));
+
+      Data data3;
+      data3.push_front(std::unique_ptr<int>(new int(3)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(1, *data3.front());
+
+      etl::iforward_list<std::unique_ptr<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+    }
+#endif
   };
 }
@@ -37,6 +37,7 @@ SOFTWARE.
 #include <array>
 #include <list>
 #include <vector>
+#include <memory>
 
 namespace
 {
@@ -1669,5 +1670,84 @@ namespace
 
       CHECK_THROW(data0.merge(data1), etl::list_unsorted);
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_push_and_insert_move)
+    {
+      etl::list<std::unique_ptr<int>, SIZE> data;
+
+      std::unique_ptr<int> p2(new int(2));
+      std::unique_ptr<int> p3(new int(3));
+
+      data.push_back(std::move(p3));
+      data.push_front(std::move(p2));
+      data.insert(data.begin(), std::unique_ptr<int>(new int(1)));
+
+      CHECK(!p2);
+      CHECK(!p3);
+      CHECK_EQUAL(3U, data.size());
+
+      etl::list<std::unique_ptr<int>, SIZE>::iterator itr = data.begin();
+      CHECK_EQUAL(1, **itr++);
+      CHECK_EQUAL(2, **itr++);
+      CHECK_EQUAL(3, **itr++);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::list<Five, SIZE> data;
+
+      data.emplace_back(1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+      data.emplace_front(2, 3, 4, 5, std::unique_ptr<int>(new int(6)));
+      data.emplace(data.end(), 0, 0, 0, 0, std::unique_ptr<int>(new int(1)));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(20, data.front().sum);
+      CHECK_EQUAL(1,  data.back().sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::list<std::unique_ptr<int>, SIZE> Data;
+
+      Data data1;
+      data1.push_back(std::unique_ptr<int>(new int(1)));
+      data1.push_back(std::unique_ptr<int>(new int(2)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(2, *data2.back());
+
+      Data data3;
+      data3.push_back(std::unique_ptr<int>(new int(3)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(1, *data3.front());
+
+      etl::ilist<std::unique_ptr<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+    }
+#endif
   };
 }
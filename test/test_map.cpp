@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <memory>
 
 #include "map.h"
 
@@ -1054,5 +1055,94 @@ namespace
 #endif
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef etl::map<int, std::unique_ptr<int>, MAX_SIZE> Data;
+
+      Data data;
+
+      std::pair<int, std::unique_ptr<int> > value1(1, std::unique_ptr<int>(new int(10)));
+      std::pair<const int, std::unique_ptr<int> > value2(1, std::unique_ptr<int>(new int(20)));
+
+      data.insert(Data::value_type(std::move(value1)));
+      std::pair<Data::iterator, bool> result = data.insert(std::move(value2));
+
+      CHECK(!value1.second);
+      CHECK(!result.second);
+      CHECK(value2.second); // Duplicate key, so not moved.
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(10, *data.at(1));
+
+      data.insert(data.begin(), Data::value_type(2, std::unique_ptr<int>(new int(20))));
+      CHECK_EQUAL(20, *data.at(2));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::map<int, std::unique_ptr<int>, MAX_SIZE> Data;
+
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.emplace(2, std::unique_ptr<int>(new int(20)));
+      CHECK(result.second);
+      CHECK_EQUAL(20, *result.first->second);
+
+      result = data.emplace(2, std::unique_ptr<int>(new int(30)));
+      CHECK(!result.second);
+      CHECK_EQUAL(20, *result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_existing_key_when_full)
+    {
+      typedef etl::map<int, std::unique_ptr<int>, 2> Data;
+
+      Data data;
+      data.emplace(1, std::unique_ptr<int>(new int(10)));
+      data.emplace(2, std::unique_ptr<int>(new int(20)));
+
+      std::pair<Data::iterator, bool> result = data.emplace(2, std::unique_ptr<int>(new int(30)));
+      CHECK(!result.second);
+      CHECK_EQUAL(20, *result.first->second);
+      CHECK_EQUAL(2U, data.size());
+
+      CHECK_THROW(data.emplace(3, std::unique_ptr<int>(new int(30))), etl::map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::map<int, std::unique_ptr<int>, MAX_SIZE> Data;
+
+      Data data1;
+      data1.emplace(1, std::unique_ptr<int>(new int(10)));
+      data1.emplace(2, std::unique_ptr<int>(new int(20)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(20, *data2.at(2));
+
+      Data data3;
+      data3.emplace(3, std::unique_ptr<int>(new int(30)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK(data3.find(3) == data3.end());
+
+      etl::imap<int, std::unique_ptr<int>, std::less<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(10, *data2.at(1));
+    }
+#endif
   };
 }
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <utility>
 #include <iterator>
 #include <string>
+#include <memory>
 
 #include "multimap.h"
 
@@ -1009,5 +1010,90 @@ namespace
 #endif
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef etl::multimap<int, std::unique_ptr<int>, MAX_SIZE> MoveData;
+
+      MoveData data;
+
+      data.insert(MoveData::value_type(3, std::unique_ptr<int>(new int(30))));
+      data.insert(MoveData::value_type(1, std::unique_ptr<int>(new int(10))));
+      data.insert(data.begin(), MoveData::value_type(2, std::unique_ptr<int>(new int(20))));
+
+      MoveData::value_type duplicate(2, std::unique_ptr<int>(new int(21)));
+      MoveData::iterator result = data.insert(std::move(duplicate));
+
+      CHECK(!duplicate.second);
+      CHECK_EQUAL(21, *result->second);
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(2U, data.count(2));
+
+      MoveData::const_iterator itr = data.begin();
+      CHECK_EQUAL(10, *(itr++)->second);
+      CHECK_EQUAL(20, *(itr++)->second);
+      CHECK_EQUAL(21, *(itr++)->second);
+      CHECK_EQUAL(30, *(itr++)->second);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::multimap<int, std::unique_ptr<int>, MAX_SIZE> MoveData;
+
+      MoveData data;
+
+      MoveData::iterator result = data.emplace(2, std::unique_ptr<int>(new int(20)));
+      CHECK_EQUAL(20, *result->second);
+
+      data.emplace(1, std::unique_ptr<int>(new int(10)));
+      data.emplace(2, std::unique_ptr<int>(new int(21)));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(2));
+      CHECK_EQUAL(10, *data.begin()->second);
+
+      for (size_t i = data.size(); i < MAX_SIZE; ++i)
+      {
+        data.emplace(0, std::unique_ptr<int>(new int(0)));
+      }
+
+      CHECK_THROW(data.emplace(0, std::unique_ptr<int>(new int(0))), etl::multimap_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::multimap<int, std::unique_ptr<int>, MAX_SIZE> MoveData;
+
+      MoveData data1;
+      data1.emplace(1, std::unique_ptr<int>(new int(10)));
+      data1.emplace(2, std::unique_ptr<int>(new int(20)));
+      data1.emplace(2, std::unique_ptr<int>(new int(21)));
+
+      MoveData data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(21, *data2.rbegin()->second);
+
+      MoveData data3;
+      data3.emplace(3, std::unique_ptr<int>(new int(30)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+      CHECK(data3.find(3) == data3.end());
+
+      etl::imultimap<int, std::unique_ptr<int>, std::less<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(10, *data2.find(1)->second);
+    }
+#endif
   };
 }
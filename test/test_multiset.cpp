@@ -34,6 +34,7 @@ SOFTWARE.
 #include <utility>
 #include <iterator>
 #include <string>
+#include <memory>
 
 #include "multiset.h"
 
@@ -967,5 +968,95 @@ namespace
 #endif
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    struct LessPointee
+    {
+      bool operator()(const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) const
+      {
+        return *lhs < *rhs;
+      }
+    };
+
+    typedef etl::multiset<std::unique_ptr<int>, MAX_SIZE, LessPointee>  MoveData;
+    typedef etl::imultiset<std::unique_ptr<int>, LessPointee>           IMoveData;
+
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      MoveData data;
+
+      data.insert(std::unique_ptr<int>(new int(3)));
+      data.insert(std::unique_ptr<int>(new int(1)));
+      data.insert(data.begin(), std::unique_ptr<int>(new int(2)));
+
+      std::unique_ptr<int> duplicate(new int(2));
+      MoveData::iterator result = data.insert(std::move(duplicate));
+
+      CHECK(!duplicate);
+      CHECK_EQUAL(2, **result);
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(2U, data.count(std::unique_ptr<int>(new int(2))));
+
+      MoveData::const_iterator itr = data.begin();
+      CHECK_EQUAL(1, **itr++);
+      CHECK_EQUAL(2, **itr++);
+      CHECK_EQUAL(2, **itr++);
+      CHECK_EQUAL(3, **itr++);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      MoveData data;
+
+      MoveData::iterator result = data.emplace(new int(2));
+      CHECK_EQUAL(2, **result);
+
+      data.emplace(new int(1));
+      data.emplace(new int(2));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, **data.begin());
+
+      for (size_t i = data.size(); i < MAX_SIZE; ++i)
+      {
+        data.emplace(new int(0));
+      }
+
+      CHECK_THROW(data.emplace(new int(0)), etl::multiset_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      MoveData data1;
+      data1.emplace(new int(1));
+      data1.emplace(new int(2));
+      data1.emplace(new int(2));
+
+      MoveData data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(1, **data2.begin());
+
+      MoveData data3;
+      data3.emplace(new int(3));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+      CHECK_EQUAL(2, **data3.rbegin());
+
+      IMoveData& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(1, **data2.begin());
+    }
+#endif
   };
 }
@@ -110,6 +110,139 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_range_contiguous)
+    {
+      std::vector<uint8_t> data(128);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(0xFF - ((i * 37) + (i >> 3)));
+      }
+
+      // Every length and alignment.
+      for (size_t offset = 0; offset < 8; ++offset)
+      {
+        for (size_t length = 0; length < 100; ++length)
+        {
+          uint32_t compare;
+          MurmurHash3_x86_32(&data[offset], int(length), 0, &compare);
+
+          CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(data.begin() + offset, data.begin() + offset + length)));
+          CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(&data[offset], &data[offset] + length)));
+        }
+      }
+
+      // Contiguous ranges added after a partial block.
+      for (size_t split = 0; split < 20; ++split)
+      {
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+
+        murmur3_32_calculator.add(data.begin(), data.begin() + split);
+        murmur3_32_calculator.add(&data[split], &data[split] + (data.size() - split));
+
+        uint32_t compare;
+        MurmurHash3_x86_32(&data[0], int(data.size()), 0, &compare);
+
+        CHECK_EQUAL(compare, uint32_t(murmur3_32_calculator));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_constructor)
+    {
+      std::string data("123456789");
+
+      etl::murmur3_x64_128::value_type hash = etl::murmur3_x64_128(data.begin(), data.end());
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.c_str(), int(data.size()), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_seed)
+    {
+      std::string data("123456789");
+
+      etl::murmur3_x64_128::value_type hash = etl::murmur3_x64_128(data.begin(), data.end(), 0x12345678);
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.c_str(), int(data.size()), 0x12345678, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_add_values)
+    {
+      std::string data("123456789");
+
+      etl::murmur3_x64_128 murmur3_128_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        murmur3_128_calculator.add(data[i]);
+      }
+
+      etl::murmur3_x64_128::value_type hash = murmur3_128_calculator;
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.c_str(), int(data.size()), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_add_range_contiguous)
+    {
+      std::vector<uint8_t> data(128);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(0xFF - ((i * 37) + (i >> 3)));
+      }
+
+      // Every length and alignment.
+      for (size_t offset = 0; offset < 8; ++offset)
+      {
+        for (size_t length = 0; length < 100; ++length)
+        {
+          uint64_t compare[2];
+          MurmurHash3_x64_128(&data[offset], int(length), 0, compare);
+
+          etl::murmur3_x64_128::value_type hash1 = etl::murmur3_x64_128(data.begin() + offset, data.begin() + offset + length);
+          etl::murmur3_x64_128::value_type hash2 = etl::murmur3_x64_128(&data[offset], &data[offset] + length);
+
+          CHECK_EQUAL(compare[0], hash1[0]);
+          CHECK_EQUAL(compare[1], hash1[1]);
+          CHECK_EQUAL(compare[0], hash2[0]);
+          CHECK_EQUAL(compare[1], hash2[1]);
+        }
+      }
+
+      // Contiguous ranges added after a partial block.
+      for (size_t split = 0; split < 40; ++split)
+      {
+        etl::murmur3_x64_128 murmur3_128_calculator;
+
+        murmur3_128_calculator.add(data.begin(), data.begin() + split);
+        murmur3_128_calculator.add(&data[split], &data[split] + (data.size() - split));
+
+        etl::murmur3_x64_128::value_type hash = murmur3_128_calculator;
+
+        uint64_t compare[2];
+        MurmurHash3_x64_128(&data[0], int(data.size()), 0, compare);
+
+        CHECK_EQUAL(compare[0], hash[0]);
+        CHECK_EQUAL(compare[1], hash[1]);
+      }
+    }
   };
 }
 
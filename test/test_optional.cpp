@@ -30,6 +30,7 @@ SOFTWARE.
 
 #include <string>
 #include <ostream>
+#include <memory>
 
 #include "optional.h"
 #include "vector.h"
@@ -406,5 +407,47 @@ namespace
       data.reset();
       CHECK(!bool(data));
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_move_construct_and_assign)
+    {
+      typedef etl::optional<std::unique_ptr<int> > Data;
+
+      Data data1(std::unique_ptr<int>(new int(1)));
+      CHECK_EQUAL(1, *data1.value());
+
+      Data data2(std::move(data1));
+      CHECK(bool(data2));
+      CHECK_EQUAL(1, *data2.value());
+
+      Data data3;
+      data3 = std::move(data2);
+      CHECK_EQUAL(1, *data3.value());
+      CHECK(!data2.value());
+
+      data3 = std::unique_ptr<int>(new int(2));
+      CHECK_EQUAL(2, *data3.value());
+
+      Data data4;
+      data4.swap(data3);
+      CHECK(!bool(data3));
+      CHECK_EQUAL(2, *data4.value());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      etl::optional<std::pair<int, std::unique_ptr<int> > > data;
+
+      data.emplace(1, std::unique_ptr<int>(new int(2)));
+      CHECK(bool(data));
+      CHECK_EQUAL(1, data.value().first);
+      CHECK_EQUAL(2, *data.value().second);
+
+      data.emplace(3, std::unique_ptr<int>(new int(4)));
+      CHECK_EQUAL(3, data.value().first);
+    }
+#endif
   };
 }
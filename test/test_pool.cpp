@@ -32,6 +32,7 @@ SOFTWARE.
 #include "data.h"
 
 #include <set>
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -337,6 +338,81 @@ namespace
       CHECK(pool.full());
     }
 
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      etl::pool<Test_Data, 4> pool;
+
+      Test_Data* items[4] = { nullptr, nullptr, nullptr, nullptr };
+
+      Test_Data** p_end = pool.allocate_n<Test_Data>(items, 3);
+
+      CHECK(p_end == (items + 3));
+      CHECK_EQUAL(3U, pool.size());
+      CHECK(items[3] == nullptr);
+
+      std::set<Test_Data*> allocated(items, items + 3);
+      CHECK_EQUAL(3U, allocated.size());
+
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(pool.is_in_pool(items[i]));
+      }
+
+      // All or none.
+      CHECK_THROW(pool.allocate_n<Test_Data>(items, 2), etl::pool_no_allocation);
+      CHECK_EQUAL(3U, pool.size());
+
+      Test_Data not_in_pool;
+      Test_Data* mixed[2] = { items[0], &not_in_pool };
+
+      CHECK_THROW(pool.release_n(mixed, mixed + 2), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(3U, pool.size());
+
+      CHECK_NO_THROW(pool.release_n(items, items + 3));
+      CHECK(pool.empty());
+
+      p_end = pool.allocate_n<Test_Data>(items, 4);
+
+      CHECK(p_end == (items + 4));
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_up_to)
+    {
+      etl::pool<Test_Data, 4> pool;
+
+      Test_Data* items[4] = { nullptr, nullptr, nullptr, nullptr };
+
+      Test_Data** p_end = pool.allocate_n<Test_Data>(items, 3);
+      CHECK(p_end == (items + 3));
+
+      // Takes only what is left.
+      Test_Data* more[2] = { nullptr, nullptr };
+
+      p_end = pool.allocate_up_to<Test_Data>(more, 2);
+
+      CHECK(p_end == (more + 1));
+      CHECK(more[1] == nullptr);
+      CHECK(pool.is_in_pool(more[0]));
+      CHECK(std::find(items, items + 3, more[0]) == (items + 3));
+      CHECK(pool.full());
+
+      // Nothing left is not an error.
+      CHECK_NO_THROW(p_end = pool.allocate_up_to<Test_Data>(more + 1, 1));
+      CHECK(p_end == (more + 1));
+
+      pool.release_n(items, items + 3);
+      pool.release_n(more, more + 1);
+      CHECK(pool.empty());
+
+      p_end = pool.allocate_up_to<Test_Data>(items, 4);
+
+      CHECK(p_end == (items + 4));
+      CHECK(pool.full());
+    }
+
     //*************************************************************************
     TEST(test_is_in_pool)
     {
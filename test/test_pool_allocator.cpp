@@ -0,0 +1,233 @@
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include <map>
+#include <list>
+#include <unordered_map>
+#include <string>
+#include <functional>
+
+#include "pool_allocator.h"
+
+namespace
+{
+  const size_t SIZE = 8;
+
+  typedef etl::pool_allocator<std::pair<const int, int>, SIZE> MapAllocator;
+  typedef std::map<int, int, std::less<int>, MapAllocator>     Map;
+
+  typedef etl::pool_allocator<std::string, SIZE>               ListAllocator;
+  typedef std::list<std::string, ListAllocator>                List;
+
+  typedef etl::pool_allocator<std::pair<const int, int>, SIZE + 1>                        HashAllocator;
+  typedef std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, HashAllocator> HashMap;
+
+  SUITE(test_pool_allocator)
+  {
+    //*************************************************************************
+    TEST(test_allocate_deallocate)
+    {
+      etl::pool_allocator<int, 4> allocator;
+      etl::pool_allocator<double, 4> other(allocator);
+
+      CHECK(allocator == other);
+      CHECK(!(allocator != other));
+
+      int* p1 = allocator.allocate(1);
+      int* p2 = allocator.allocate(1);
+
+      CHECK(allocator.get_pool().is_in_pool(p1));
+      CHECK(allocator.get_pool().is_in_pool(p2));
+      CHECK_EQUAL(2U, allocator.get_pool().size());
+
+      // Arrays do not come from the pool.
+      int* p3 = allocator.allocate(10);
+      CHECK(!allocator.get_pool().is_in_pool(p3));
+      CHECK_EQUAL(2U, allocator.get_pool().size());
+
+      allocator.deallocate(p3, 10);
+      allocator.deallocate(p2, 1);
+      allocator.deallocate(p1, 1);
+
+      CHECK(allocator.get_pool().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_std_map)
+    {
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        Map data;
+
+        // Some implementations also take a head node from the pool.
+        int n = 0;
+
+        try
+        {
+          while (n <= int(SIZE))
+          {
+            data[n] = n * 10;
+            ++n;
+          }
+        }
+        catch (etl::pool_no_allocation&)
+        {
+        }
+
+        CHECK((n > 0) && (n <= int(SIZE)));
+        CHECK_EQUAL(size_t(n), data.size());
+        CHECK_EQUAL((n - 1) * 10, data[n - 1]);
+
+        // Erased nodes go back to the pool.
+        data.erase(0);
+        data[100] = 1000;
+
+        CHECK_EQUAL(1000, data[100]);
+        CHECK_EQUAL(size_t(n), data.size());
+
+        // All nodes are back in the pool after the map is destroyed.
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_std_list)
+    {
+      List data;
+      List other;
+
+      data.push_back("1");
+      data.push_back("0");
+
+      // A list with the same node type shares the pool.
+      size_t n = 0;
+
+      try
+      {
+        while (n <= SIZE)
+        {
+          other.push_back("x");
+          ++n;
+        }
+      }
+      catch (etl::pool_no_allocation&)
+      {
+      }
+
+      CHECK(n <= (SIZE - 2));
+      CHECK_THROW(data.push_back("y"), etl::pool_no_allocation);
+
+      // Nodes may be spliced between lists that share the pool.
+      other.splice(other.begin(), data);
+
+      CHECK(data.empty());
+      CHECK_EQUAL(n + 2, other.size());
+      CHECK_EQUAL(std::string("1"), other.front());
+
+      other.clear();
+
+      for (size_t i = 0; i < (n + 2); ++i)
+      {
+        data.push_back("z");
+      }
+
+      CHECK_EQUAL(n + 2, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_std_unordered_map)
+    {
+      HashMap data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(5, data[5]);
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+#if ETL_POOL_MEMORY_RESOURCE_SUPPORTED
+    //*************************************************************************
+    TEST(test_memory_resource)
+    {
+      etl::pool_memory_resource<64, 16, 8> resource(std::pmr::null_memory_resource());
+
+      void* p1 = resource.allocate(64, 16);
+      void* p2 = resource.allocate(1, 1);
+
+      CHECK(resource.get_pool().is_in_pool(p1));
+      CHECK(resource.get_pool().is_in_pool(p2));
+      CHECK_EQUAL(2U, resource.get_pool().size());
+
+      // Too large or over aligned requests go upstream.
+      CHECK_THROW((void)resource.allocate(65, 1), std::bad_alloc);
+      CHECK_THROW((void)resource.allocate(8, 32), std::bad_alloc);
+
+      resource.deallocate(p1, 64, 16);
+      resource.deallocate(p2, 1, 1);
+
+      CHECK(resource.get_pool().empty());
+      CHECK(resource.is_equal(resource));
+    }
+
+    //*************************************************************************
+    TEST(test_memory_resource_pmr_containers)
+    {
+      etl::pool_memory_resource<64, 16, 16> resource;
+
+      {
+        std::pmr::map<int, int> data(&resource);
+
+        for (int i = 0; i < 20; ++i)
+        {
+          data[i] = i;
+        }
+
+        // The pool is used first, then upstream.
+        CHECK(resource.get_pool().full());
+        CHECK_EQUAL(20U, data.size());
+        CHECK_EQUAL(19, data[19]);
+
+        std::pmr::list<int> items(&resource);
+        items.push_back(1);
+        CHECK_EQUAL(1, items.front());
+      }
+
+      CHECK(resource.get_pool().empty());
+    }
+#endif
+  };
+}
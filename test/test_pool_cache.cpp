@@ -0,0 +1,290 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+#include "ExtraCheckMacros.h"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+
+#include "pool.h"
+#include "atomic_pool.h"
+#include "pool_cache.h"
+
+namespace
+{
+  struct Item
+  {
+    Item(int a_, const std::string& b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    int         a;
+    std::string b;
+  };
+
+  std::mutex pool_mutex;
+
+  // Guards a shared etl::pool.
+  struct MutexAccess
+  {
+    static void lock()
+    {
+      pool_mutex.lock();
+    }
+
+    static void unlock()
+    {
+      pool_mutex.unlock();
+    }
+  };
+
+  SUITE(test_pool_cache)
+  {
+    //*************************************************************************
+    TEST(test_refill_hit_miss)
+    {
+      etl::pool<int, 16> pool;
+      etl::pool_cache<int, 8> cache(pool);
+
+      CHECK_EQUAL(4U, cache.BATCH_SIZE);
+      CHECK_EQUAL(0U, cache.cached());
+
+      std::set<int*> allocated;
+
+      // Miss, then 3 hits from the batch of 4.
+      for (int i = 0; i < 4; ++i)
+      {
+        allocated.insert(cache.allocate<int>());
+      }
+
+      CHECK_EQUAL(1U, cache.misses());
+      CHECK_EQUAL(3U, cache.hits());
+      CHECK_EQUAL(1U, cache.refills());
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(0U, cache.cached());
+
+      // Another miss.
+      allocated.insert(cache.allocate<int>());
+
+      CHECK_EQUAL(2U, cache.misses());
+      CHECK_EQUAL(2U, cache.refills());
+      CHECK_EQUAL(8U, pool.size());
+      CHECK_EQUAL(3U, cache.cached());
+      CHECK_EQUAL(5U, allocated.size());
+
+      cache.clear_statistics();
+      CHECK_EQUAL(0U, cache.hits());
+      CHECK_EQUAL(0U, cache.misses());
+      CHECK_EQUAL(0U, cache.refills());
+    }
+
+    //*************************************************************************
+    TEST(test_release_drain_flush)
+    {
+      etl::pool<int, 16> pool;
+      etl::pool_cache<int, 4> cache(pool);
+
+      std::vector<int*> allocated;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        allocated.push_back(cache.allocate<int>());
+      }
+
+      CHECK_EQUAL(10U, pool.size());
+
+      // Released items stay in the cache until it is full.
+      for (int i = 0; i < 4; ++i)
+      {
+        cache.release(allocated[i]);
+      }
+
+      CHECK_EQUAL(4U, cache.cached());
+      CHECK_EQUAL(10U, pool.size());
+      CHECK_EQUAL(0U, cache.drains());
+
+      // A full cache returns half to the pool.
+      cache.release(allocated[4]);
+
+      CHECK_EQUAL(1U, cache.drains());
+      CHECK_EQUAL(3U, cache.cached());
+      CHECK_EQUAL(8U, pool.size());
+
+      // The most recently released is reused first.
+      CHECK(cache.allocate<int>() == allocated[4]);
+
+      int not_in_pool;
+      CHECK_THROW(cache.release(&not_in_pool), etl::pool_object_not_in_pool);
+
+      cache.flush();
+
+      CHECK_EQUAL(0U, cache.cached());
+      CHECK_EQUAL(6U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted)
+    {
+      etl::pool<int, 6> pool;
+
+      {
+        etl::pool_cache<int, 8> cache(pool);
+
+        std::vector<int*> allocated;
+
+        // The second refill takes only the 2 left in the pool.
+        for (int i = 0; i < 6; ++i)
+        {
+          allocated.push_back(cache.allocate<int>());
+          CHECK(allocated.back() != nullptr);
+        }
+
+        CHECK(pool.full());
+        CHECK_EQUAL(2U, cache.refills());
+        CHECK_THROW(cache.allocate<int>(), etl::pool_no_allocation);
+
+        for (size_t i = 0; i < allocated.size(); ++i)
+        {
+          cache.release(allocated[i]);
+        }
+
+        CHECK_EQUAL(6U, pool.size());
+      }
+
+      // The destructor returns the cached items.
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::atomic_pool<Item, 4> pool;
+      etl::pool_cache<Item, 2, etl::iatomic_pool> cache(pool);
+
+      Item* p = cache.create<Item>(1, "1");
+
+      CHECK_EQUAL(1, p->a);
+      CHECK_EQUAL(std::string("1"), p->b);
+
+      cache.destroy<Item>(p);
+
+      CHECK_EQUAL(1U, cache.cached());
+    }
+
+    //*************************************************************************
+    template <typename TCache, typename TPool>
+    void run_threads(TPool& pool)
+    {
+      const int THREADS = 4;
+      const int LOOPS   = 20000;
+      const int HELD    = 5;
+
+      struct Worker
+      {
+        static void run(TPool* p_pool, int id, bool* result)
+        {
+          TCache cache(*p_pool);
+          bool   good = true;
+
+          for (int i = 0; i < LOOPS; ++i)
+          {
+            uint64_t* items[HELD];
+
+            for (int j = 0; j < HELD; ++j)
+            {
+              items[j] = cache.template allocate<uint64_t>();
+              *items[j] = (uint64_t(id) << 32) | uint32_t(i * HELD + j);
+            }
+
+            // No other thread may have been given the same items.
+            for (int j = 0; j < HELD; ++j)
+            {
+              good = good && (*items[j] == ((uint64_t(id) << 32) | uint32_t(i * HELD + j)));
+              cache.release(items[j]);
+            }
+          }
+
+          *result = good && (cache.hits() > cache.misses());
+        }
+      };
+
+      bool ok[THREADS];
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < THREADS; ++t)
+      {
+        threads.push_back(std::thread(&Worker::run, &pool, t, &ok[t]));
+      }
+
+      for (int t = 0; t < THREADS; ++t)
+      {
+        threads[t].join();
+        CHECK(ok[t]);
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads_atomic_pool)
+    {
+      static etl::atomic_pool<uint64_t, 64> pool;
+
+      run_threads<etl::pool_cache<uint64_t, 8, etl::iatomic_pool> >(pool);
+    }
+
+    //*************************************************************************
+    TEST(test_threads_atomic_pool_partial_refills)
+    {
+      // Each thread holds at most 5 items and caches at most 8.
+      // A thread refills only with its cache empty and at most 4 held, so the
+      // other 3 can have at most 39 + 4 = 43 items out, and every refill finds
+      // at least one. Refills often find less than a batch, which other
+      // threads may be taking at the same time.
+      static etl::atomic_pool<uint64_t, 44> pool;
+
+      run_threads<etl::pool_cache<uint64_t, 8, etl::iatomic_pool> >(pool);
+    }
+
+    //*************************************************************************
+    TEST(test_threads_locked_pool)
+    {
+      static etl::pool<uint64_t, 64> pool;
+
+      run_threads<etl::pool_cache<uint64_t, 8, etl::ipool, MutexAccess> >(pool);
+    }
+  };
+}
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <queue>
+#include <memory>
 
 #include "priority_queue.h"
 
@@ -517,5 +518,59 @@ namespace
       CHECK_EQUAL(compare_priority_queue.size(), ipriority_queue.size());
       CHECK_EQUAL(compare_priority_queue.top(), ipriority_queue.top());
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    struct LessPointee
+    {
+      bool operator()(const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) const
+      {
+        return *lhs < *rhs;
+      }
+    };
+
+    typedef etl::priority_queue<std::unique_ptr<int>, 4, etl::vector<std::unique_ptr<int>, 4>, LessPointee> PointerQueue;
+
+    //*************************************************************************
+    TEST(test_push_move_and_emplace)
+    {
+      PointerQueue priority_queue;
+
+      std::unique_ptr<int> p1(new int(1));
+      priority_queue.push(std::move(p1));
+      priority_queue.push(std::unique_ptr<int>(new int(3)));
+      priority_queue.emplace(new int(2));
+
+      CHECK(!p1);
+      CHECK_EQUAL(3U, priority_queue.size());
+      CHECK_EQUAL(3, *priority_queue.top());
+
+      priority_queue.pop();
+      CHECK_EQUAL(2, *priority_queue.top());
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      PointerQueue priority_queue1;
+      priority_queue1.push(std::unique_ptr<int>(new int(1)));
+      priority_queue1.push(std::unique_ptr<int>(new int(2)));
+
+      PointerQueue priority_queue2(std::move(priority_queue1));
+
+      CHECK(priority_queue1.empty());
+      CHECK_EQUAL(2U, priority_queue2.size());
+      CHECK_EQUAL(2, *priority_queue2.top());
+
+      PointerQueue priority_queue3;
+      priority_queue3.push(std::unique_ptr<int>(new int(3)));
+
+      priority_queue3 = std::move(priority_queue2);
+
+      CHECK(priority_queue2.empty());
+      CHECK_EQUAL(2U, priority_queue3.size());
+      CHECK_EQUAL(2, *priority_queue3.top());
+    }
+#endif
   };
 }
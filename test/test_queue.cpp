@@ -29,6 +29,7 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <queue>
+#include <memory>
 
 #include "queue.h"
 
@@ -564,5 +565,78 @@ namespace
       CHECK_EQUAL(4, queue.front());
       queue.pop();
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_push_move_and_emplace)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::queue<std::unique_ptr<int>, 4> queue;
+
+      std::unique_ptr<int> p1(new int(1));
+      queue.push(std::move(p1));
+      queue.push(std::unique_ptr<int>(new int(2)));
+
+      CHECK(!p1);
+      CHECK_EQUAL(1, *queue.front());
+      CHECK_EQUAL(2, *queue.back());
+
+      etl::queue<Five, 4> fives;
+      fives.emplace(1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+
+      CHECK_EQUAL(15, fives.front().sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::queue<std::unique_ptr<int>, 4> Queue;
+
+      Queue queue1;
+
+      // Wrap the indexes around the end of the buffer.
+      queue1.push(std::unique_ptr<int>(new int(0)));
+      queue1.push(std::unique_ptr<int>(new int(0)));
+      queue1.push(std::unique_ptr<int>(new int(0)));
+      queue1.pop();
+      queue1.pop();
+      queue1.pop();
+
+      queue1.push(std::unique_ptr<int>(new int(1)));
+      queue1.push(std::unique_ptr<int>(new int(2)));
+      queue1.push(std::unique_ptr<int>(new int(3)));
+
+      Queue queue2(std::move(queue1));
+
+      CHECK(queue1.empty());
+      CHECK_EQUAL(3U, queue2.size());
+      CHECK_EQUAL(1, *queue2.front());
+      CHECK_EQUAL(3, *queue2.back());
+
+      Queue queue3;
+      queue3.push(std::unique_ptr<int>(new int(4)));
+
+      queue3 = std::move(queue2);
+
+      CHECK(queue2.empty());
+      CHECK_EQUAL(3U, queue3.size());
+      CHECK_EQUAL(1, *queue3.front());
+
+      etl::iqueue<std::unique_ptr<int> >& iqueue = queue2;
+      iqueue = std::move(queue3);
+
+      CHECK(queue3.empty());
+      CHECK_EQUAL(3U, queue2.size());
+    }
+#endif
   };
 }
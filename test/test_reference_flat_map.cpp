@@ -527,6 +527,53 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      // Out of order, with keys that are repeated and keys already in the map.
+      ElementNDC values[] = { ElementNDC(9, N9), ElementNDC(3, N13), ElementNDC(0, N0), ElementNDC(6, N6), ElementNDC(2, N2),
+                              ElementNDC(0, N0), ElementNDC(8, N8), ElementNDC(1, N1), ElementNDC(4, N4), ElementNDC(7, N17) };
+
+      DataNDC data(initial_data.begin() + 3, initial_data.begin() + 8);
+
+      data.insert_range(std::begin(values), std::end(values));
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(&*data.find(3) == &initial_data[3]);
+      CHECK(&*data.find(7) == &initial_data[7]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      // Repeated keys do not use space.
+      CHECK_NO_THROW(data.insert_range(initial_data.rbegin(), initial_data.rend()));
+      CHECK_EQUAL(SIZE, data.size());
+
+      data.clear();
+
+      CHECK_THROW(data.insert_range(excess_data.rbegin(), excess_data.rend()), etl::flat_map_full);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(initial_data.rbegin(), initial_data.rend());
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
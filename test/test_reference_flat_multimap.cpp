@@ -354,6 +354,57 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 4);
+
+      data.insert_range(multi_data.rbegin(), multi_data.rbegin() + 6);
+
+      CHECK_EQUAL(multi_data.size(), data.size());
+
+      // The order of equal keys from the range is unspecified.
+      for (size_t i = 0; i < multi_data.size(); ++i)
+      {
+        std::pair<DataNDC::iterator, DataNDC::iterator> range = data.equal_range(multi_data[i].first);
+
+        bool found = false;
+
+        for (DataNDC::iterator itr = range.first; itr != range.second; ++itr)
+        {
+          found = found || (itr->second == multi_data[i].second);
+        }
+
+        CHECK(found);
+      }
+
+      // The values from the range follow the equal keys already in the multimap.
+      CHECK(&*data.lower_bound(1) == &multi_data[3]);
+      CHECK(&*data.lower_bound(0) == &multi_data[0]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 5);
+
+      CHECK_THROW(data.insert_range(multi_data.begin(), multi_data.end()), etl::flat_multimap_full);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(initial_data.rbegin(), initial_data.rend());
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
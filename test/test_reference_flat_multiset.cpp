@@ -333,6 +333,47 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 4);
+
+      data.insert_range(multi_data.rbegin(), multi_data.rbegin() + 6);
+
+      Compare_DataNDC compare_data(multi_data.begin(), multi_data.begin() + 4);
+      compare_data.insert(multi_data.rbegin(), multi_data.rbegin() + 6);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      // The values from the range follow the equal values already in the multiset.
+      CHECK(&*data.lower_bound(N1) == &multi_data[2]);
+      CHECK(&*data.lower_bound(N2) == &multi_data[3]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(multi_data.begin(), multi_data.begin() + 5);
+
+      CHECK_THROW(data.insert_range(multi_data.begin(), multi_data.end()), etl::flat_multiset_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(multi_data.begin(), multi_data.end());
+
+      Compare_DataNDC compare_data(multi_data.begin(), multi_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
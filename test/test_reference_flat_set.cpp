@@ -341,6 +341,53 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk)
+    {
+      // Out of order, with values that are repeated and values already in the set.
+      NDC values[] = { N9, N3, N0, N6, N2, N0, N8, N1, N4, N7 };
+
+      DataNDC data(initial_data.begin() + 3, initial_data.begin() + 8);
+
+      data.insert_range(std::begin(values), std::end(values));
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      // The values already in the set are kept.
+      CHECK(&*data.find(N3) == &initial_data[3]);
+      CHECK(&*data.find(N0) == &values[2]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_bulk_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      // Repeated values do not use space.
+      CHECK_NO_THROW(data.insert_range(initial_data.rbegin(), initial_data.rend()));
+      CHECK_EQUAL(SIZE, data.size());
+
+      data.clear();
+
+      CHECK_THROW(data.insert_range(excess_data.rbegin(), excess_data.rend()), etl::flat_set_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_unsorted(initial_data.rbegin(), initial_data.rend());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), initial_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <memory>
 
 #include "set.h"
 
@@ -944,5 +945,104 @@ namespace
 #endif
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    struct LessPointee
+    {
+      bool operator()(const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) const
+      {
+        return *lhs < *rhs;
+      }
+    };
+
+    typedef etl::set<std::unique_ptr<int>, MAX_SIZE, LessPointee>  MoveData;
+    typedef etl::iset<std::unique_ptr<int>, LessPointee>           IMoveData;
+
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      MoveData data;
+
+      data.insert(std::unique_ptr<int>(new int(3)));
+      data.insert(std::unique_ptr<int>(new int(1)));
+      data.insert(data.begin(), std::unique_ptr<int>(new int(2)));
+
+      std::unique_ptr<int> duplicate(new int(2));
+      std::pair<MoveData::iterator, bool> result = data.insert(std::move(duplicate));
+
+      CHECK(!result.second);
+      CHECK(duplicate); // Already in the set, so not moved.
+      CHECK_EQUAL(3U, data.size());
+
+      MoveData::const_iterator itr = data.begin();
+      CHECK_EQUAL(1, **itr++);
+      CHECK_EQUAL(2, **itr++);
+      CHECK_EQUAL(3, **itr++);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      MoveData data;
+
+      std::pair<MoveData::iterator, bool> result = data.emplace(new int(2));
+      CHECK(result.second);
+      CHECK_EQUAL(2, **result.first);
+
+      data.emplace(new int(1));
+
+      result = data.emplace(new int(2));
+      CHECK(!result.second);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, **data.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_existing_value_when_full)
+    {
+      MoveData data;
+
+      for (int i = 0; i < int(MAX_SIZE); ++i)
+      {
+        data.emplace(new int(i));
+      }
+
+      std::pair<MoveData::iterator, bool> result = data.emplace(new int(5));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(5, **result.first);
+      CHECK_THROW(data.emplace(new int(int(MAX_SIZE))), etl::set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      MoveData data1;
+      data1.emplace(new int(1));
+      data1.emplace(new int(2));
+
+      MoveData data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, **data2.begin());
+
+      MoveData data3;
+      data3.emplace(new int(3));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(2, **data3.rbegin());
+
+      IMoveData& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, **data2.begin());
+    }
+#endif
   };
 }
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <stack>
+#include <memory>
 
 #include "data.h"
 
@@ -580,5 +581,66 @@ namespace
       stack.pop_into(i);
       CHECK_EQUAL(4, i);
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_push_move_and_emplace)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::stack<std::unique_ptr<int>, 4> stack;
+
+      std::unique_ptr<int> p1(new int(1));
+      stack.push(std::move(p1));
+      stack.push(std::unique_ptr<int>(new int(2)));
+
+      CHECK(!p1);
+      CHECK_EQUAL(2, *stack.top());
+
+      etl::stack<Five, 4> fives;
+      fives.emplace(1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+
+      CHECK_EQUAL(15, fives.top().sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::stack<std::unique_ptr<int>, 4> Stack;
+
+      Stack stack1;
+      stack1.push(std::unique_ptr<int>(new int(1)));
+      stack1.push(std::unique_ptr<int>(new int(2)));
+
+      Stack stack2(std::move(stack1));
+
+      CHECK(stack1.empty());
+      CHECK_EQUAL(2U, stack2.size());
+      CHECK_EQUAL(2, *stack2.top());
+
+      Stack stack3;
+      stack3.push(std::unique_ptr<int>(new int(3)));
+
+      stack3 = std::move(stack2);
+
+      CHECK(stack2.empty());
+      CHECK_EQUAL(2U, stack3.size());
+      CHECK_EQUAL(2, *stack3.top());
+
+      etl::istack<std::unique_ptr<int> >& istack = stack2;
+      istack = std::move(stack3);
+
+      CHECK(stack3.empty());
+      CHECK_EQUAL(2U, stack2.size());
+    }
+#endif
   };
 }
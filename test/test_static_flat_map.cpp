@@ -0,0 +1,285 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "data.h"
+
+#include "static_flat_map.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef etl::static_flat_map<int, int, SIZE>                     Data;
+  typedef etl::istatic_flat_map<int, int>                          IData;
+  typedef etl::static_flat_map<std::string, NDC, SIZE>             DataNDC;
+  typedef etl::istatic_flat_map<std::string, NDC>                  IDataNDC;
+  typedef etl::static_flat_map<int, int, SIZE, std::greater<int> > DataGreater;
+
+  typedef std::map<int, int>         Compare_Data;
+  typedef std::map<std::string, NDC> Compare_DataNDC;
+
+  //*************************************************************************
+  std::string make_key(int i)
+  {
+    // Long enough to defeat the small string optimisation, and sorted by i.
+    char text[64];
+    sprintf(text, "key_with_a_long_prefix_%06d", i);
+    return std::string(text);
+  }
+
+  //*************************************************************************
+  // A scattered order for 0 to SIZE - 1.
+  int scatter(int i)
+  {
+    return int((size_t(i) * 7919U) % SIZE);
+  }
+
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Same(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_static_flat_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_assignment)
+    {
+      std::vector<std::pair<int, int> > values;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        values.push_back(std::make_pair(scatter(i), i));
+      }
+
+      Data data(values.begin(), values.end());
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK(data.full());
+      CHECK(Check_Same(data, compare));
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data other(values.begin(), values.begin() + 1);
+      IData& iother = other;
+      iother = data;
+      CHECK(other == data);
+
+      Data sorted(compare.begin(), compare.end());
+      CHECK(sorted == data);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      Data data = { { 3, 30 }, { 1, 10 }, { 2, 20 } };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.begin()->first);
+      CHECK_EQUAL(20, data.at(2));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_destruct_via_istatic_flat_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      std::vector<std::pair<std::string, NDC> > values;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        values.push_back(std::make_pair(make_key(((i * 37) % 100) / 2), NDC("A")));
+      }
+
+      int values_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(values.begin(), values.end());
+
+      CHECK_EQUAL(size_t(50), pdata->size());
+      CHECK_EQUAL(values_count + 50, NDC::get_instance_count());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+
+      CHECK_EQUAL(values_count, NDC::get_instance_count());
+
+      values.clear();
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_at)
+    {
+      std::vector<std::pair<std::string, NDC> > values;
+
+      for (int i = 0; i < int(SIZE); i += 2)
+      {
+        char text[2] = { char('A' + (i % 26)), 0 };
+        values.push_back(std::make_pair(make_key(scatter(i)), NDC(text)));
+      }
+
+      DataNDC data(values.begin(), values.end());
+      Compare_DataNDC compare(values.begin(), values.end());
+
+      CHECK(Check_Same(data, compare));
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        const std::string key = make_key(i);
+        Compare_DataNDC::const_iterator i_compare = compare.find(key);
+
+        CHECK_EQUAL(compare.count(key), data.count(key));
+
+        if (i_compare == compare.end())
+        {
+          CHECK(data.find(key) == data.end());
+          CHECK_THROW(data.at(key), etl::static_flat_out_of_bounds);
+        }
+        else
+        {
+          CHECK(i_compare->second == data.at(key));
+          CHECK(data.find(key)->first == key);
+        }
+
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+      }
+
+      // The mapped values may be changed.
+      data.at(make_key(0)) = NDC("Z");
+      CHECK(NDC("Z") == data.find(make_key(0))->second);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds_for_every_size)
+    {
+      // Each size gives a different shape of the bottom level of the tree.
+      for (int n = 0; n < 70; ++n)
+      {
+        Compare_Data compare;
+
+        for (int i = 0; i < n; ++i)
+        {
+          compare[(scatter(i) * 2) + 1] = i;
+        }
+
+        Data data(compare.rbegin(), compare.rend());
+
+        CHECK(Check_Same(data, compare));
+
+        for (int key = -1; key <= int(SIZE * 2); ++key)
+        {
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      std::pair<int, int> values[] = { std::make_pair(4, 40), std::make_pair(2, 20), std::make_pair(6, 60) };
+
+      const Data data(values, values + 3);
+
+      std::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range(4);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(40, range.first->second);
+
+      range = data.equal_range(5);
+      CHECK(range.first == range.second);
+      CHECK_EQUAL(6, range.first->first);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      std::vector<std::pair<int, int> > values;
+
+      for (int i = 0; i < int(SIZE) + 1; ++i)
+      {
+        values.push_back(std::make_pair(int(SIZE) - i, i));
+      }
+
+      Data data;
+
+      CHECK_THROW(data.assign(values.begin(), values.end()), etl::static_flat_full);
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(int(SIZE), data.rbegin()->first);
+      CHECK(data.find(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_functor)
+    {
+      std::vector<std::pair<int, int> > values;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        values.push_back(std::make_pair(scatter(i), i));
+      }
+
+      DataGreater data(values.begin(), values.end());
+
+      CHECK_EQUAL(int(SIZE) - 1, data.begin()->first);
+      CHECK_EQUAL(0, data.rbegin()->first);
+      CHECK(data.lower_bound(-1) == data.end());
+      CHECK_EQUAL(10, data.upper_bound(11)->first);
+    }
+  };
+}
@@ -0,0 +1,242 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2016 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "static_flat_set.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::static_flat_set<int, SIZE>                     Data;
+  typedef etl::istatic_flat_set<int>                          IData;
+  typedef etl::static_flat_set<std::string, SIZE>             DataString;
+  typedef etl::static_flat_set<int, SIZE, std::greater<int> > DataGreater;
+
+  typedef std::set<int>         Compare_Data;
+  typedef std::set<std::string> Compare_DataString;
+
+  //*************************************************************************
+  // A scattered order for 0 to SIZE - 1.
+  int scatter(int i)
+  {
+    return int((size_t(i) * 7919U) % SIZE);
+  }
+
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Same(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_static_flat_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_assignment)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        values.push_back(scatter(i));
+      }
+
+      Data data(values.begin(), values.end());
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK(data.full());
+      CHECK(Check_Same(data, compare));
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      int one = 5;
+      Data other(&one, &one + 1);
+      IData& iother = other;
+      iother = data;
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds_for_every_size)
+    {
+      // Each size gives a different shape of the bottom level of the tree.
+      for (int n = 0; n < 70; ++n)
+      {
+        std::vector<int> values;
+
+        for (int i = 0; i < n; ++i)
+        {
+          values.push_back((i * 2) + 1);
+        }
+
+        std::reverse(values.begin(), values.end());
+
+        Data data(values.begin(), values.end());
+        Compare_Data compare(values.begin(), values.end());
+
+        CHECK(Check_Same(data, compare));
+
+        for (int key = 0; key <= (n * 2) + 1; ++key)
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_duplicates)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        values.push_back(scatter(i) / 4);
+      }
+
+      Data data(values.begin(), values.end());
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK(Check_Same(data, compare));
+      CHECK_EQUAL(SIZE / 4, data.size());
+
+      std::pair<Data::iterator, Data::iterator> range = data.equal_range(7);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(7, *range.first);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < int(SIZE) + 1; ++i)
+      {
+        values.push_back(i);
+      }
+
+      Data data;
+
+      CHECK_THROW(data.assign(values.begin(), values.end()), etl::static_flat_full);
+
+      // The elements that fitted are still searchable.
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(data.find(int(SIZE) - 1) != data.end());
+      CHECK(data.find(int(SIZE)) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      std::vector<std::string> values;
+
+      for (int i = 0; i < int(SIZE); i += 2)
+      {
+        char text[64];
+        sprintf(text, "a_string_long_enough_for_the_heap_%06d", scatter(i));
+        values.push_back(text);
+      }
+
+      DataString data(values.begin(), values.end());
+      Compare_DataString compare(values.begin(), values.end());
+
+      CHECK(Check_Same(data, compare));
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        char text[64];
+        sprintf(text, "a_string_long_enough_for_the_heap_%06d", i);
+        const std::string key(text);
+
+        CHECK_EQUAL(compare.count(key), data.count(key));
+        CHECK_EQUAL(compare.find(key) == compare.end(), data.find(key) == data.end());
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+      }
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_functor)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        values.push_back(scatter(i));
+      }
+
+      DataGreater data(values.begin(), values.end());
+
+      CHECK_EQUAL(int(SIZE) - 1, *data.begin());
+      CHECK_EQUAL(0, *data.rbegin());
+      CHECK(data.lower_bound(-1) == data.end());
+      CHECK_EQUAL(10, *data.upper_bound(11));
+    }
+
+    //*************************************************************************
+    TEST(test_comparison_operators)
+    {
+      int values1[] = { 1, 2 };
+      int values2[] = { 2, 1 };
+      int values3[] = { 3, 2, 1 };
+
+      Data data1(values1, values1 + 2);
+      Data data2(values2, values2 + 2);
+      Data data3(values3, values3 + 3);
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+    }
+  };
+}
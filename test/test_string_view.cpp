@@ -869,5 +869,50 @@ namespace
       CHECK_EQUAL(etl::hash<U16Text>()(u16text), etl::hash<U16View>()(u16view));
       CHECK_EQUAL(etl::hash<U32Text>()(u32text), etl::hash<U32View>()(u32view));
     }
+
+    //*************************************************************************
+    TEST(test_hash_heterogeneous)
+    {
+      typedef etl::string<11>  Text;
+      typedef etl::wstring<11> WText;
+      typedef etl::wstring_view WView;
+
+      Text  text("Hello World");
+      WText wtext(L"Hello World");
+      View  view(text.data());
+      WView wview(wtext.data());
+
+      // The string, its base, a view and a null terminated string all give the same hash.
+      etl::hash<Text> text_hash;
+
+      CHECK_EQUAL(text_hash(text), etl::hash<etl::istring>()(text));
+      CHECK_EQUAL(text_hash(text), text_hash(view));
+      CHECK_EQUAL(text_hash(text), text_hash("Hello World"));
+      CHECK_EQUAL(text_hash(text), etl::hash<View>()("Hello World"));
+      CHECK_EQUAL(etl::hash<WText>()(wtext), etl::hash<WText>()(wview));
+      CHECK_EQUAL(etl::hash<WText>()(wtext), etl::hash<etl::iwstring>()(L"Hello World"));
+
+      // Empty.
+      CHECK_EQUAL(etl::hash<Text>()(Text()), etl::hash<View>()(View()));
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_string)
+    {
+      etl::string<11> text("Hello World");
+      View view(text.data());
+
+      CHECK(view == text);
+      CHECK(text == view);
+      CHECK(!(view != text));
+      CHECK(!(text != view));
+
+      etl::string<11> other("Hello Worle");
+
+      CHECK(view != other);
+      CHECK(other != view);
+      CHECK(!(view == other));
+      CHECK(!(other == view));
+    }
   };
 }
@@ -40,6 +40,27 @@ namespace std
 
 #include "type_traits.h"
 #include <type_traits>
+#include <string>
+
+namespace
+{
+  // A class with a user defined copy constructor, declared trivially relocatable.
+  struct Relocatable
+  {
+    Relocatable(const Relocatable& other)
+      : a(other.a)
+    {
+    }
+
+    int a;
+  };
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Relocatable> : etl::true_type {};
+}
 
 namespace
 {
@@ -212,6 +233,15 @@ namespace
       CHECK(etl::is_array<int[10]>::value == std::is_array<int[10]>::value);
     }
 
+    //*************************************************************************
+    TEST(test_is_enum)
+    {
+      enum Enum { Value };
+
+      CHECK(etl::is_enum<Enum>::value == std::is_enum<Enum>::value);
+      CHECK(etl::is_enum<int>::value  == std::is_enum<int>::value);
+    }
+
     //*************************************************************************
     TEST(test_remove_pointer)
     {
@@ -715,6 +745,20 @@ namespace
       CHECK((std::is_same<const int*,       etl::types<const volatile int&>::const_pointer>::value));
       CHECK((std::is_same<const int* const, etl::types<const volatile int&>::const_pointer_const>::value));
     }
+
+    //*************************************************************************
+    TEST(test_is_trivially_relocatable)
+    {
+      CHECK(etl::is_trivially_relocatable<int>::value);
+      CHECK(etl::is_trivially_relocatable<int*>::value);
+      CHECK(etl::is_trivially_relocatable<Relocatable>::value);
+#if (ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED) && !defined(ETL_IN_UNIT_TEST)
+      CHECK(etl::is_trivially_relocatable<Test>::value);
+#else
+      CHECK(!etl::is_trivially_relocatable<Test>::value);
+#endif
+      CHECK(!etl::is_trivially_relocatable<std::string>::value);
+    }
   };
 
   //*************************************************************************
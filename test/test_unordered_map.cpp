@@ -36,10 +36,14 @@ SOFTWARE.
 #include <string>
 #include <vector>
 #include <numeric>
+#include <memory>
 
 #include "data.h"
 
 #include "unordered_map.h"
+#include "cstring.h"
+#include "string_view.h"
+#include "functional.h"
 
 namespace
 {
@@ -52,6 +56,29 @@ namespace
     }
   };
 
+  //*************************************************************************
+  struct identity_hash
+  {
+    size_t operator ()(int key) const
+    {
+      return size_t(key);
+    }
+  };
+
+  //*************************************************************************
+  struct counting_equal
+  {
+    bool operator ()(int lhs, int rhs) const
+    {
+      ++count;
+      return lhs == rhs;
+    }
+
+    static int count;
+  };
+
+  int counting_equal::count = 0;
+
   //*************************************************************************
   template <typename T1, typename T2>
   bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
@@ -70,6 +97,29 @@ namespace
     return true;
   }
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+  //*************************************************************************
+  // The range of elements with the key, found by a linear search.
+  //*************************************************************************
+  template <typename TIterator, typename TKey>
+  std::pair<TIterator, TIterator> Linear_Equal_Range(TIterator begin, TIterator end, const TKey& key)
+  {
+    while ((begin != end) && !(begin->first == key))
+    {
+      ++begin;
+    }
+
+    TIterator last = begin;
+
+    while ((last != end) && (last->first == key))
+    {
+      ++last;
+    }
+
+    return std::make_pair(begin, last);
+  }
+#endif
+
   SUITE(test_unordered_map)
   {
     static const size_t SIZE = 10;
@@ -509,12 +559,30 @@ namespace
       DataNDC::iterator idata_end = data.begin();
       std::advance(idata_end, 5);
       
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      std::vector<std::string> erased;
+
+      for (DataNDC::iterator itr = idata; itr != idata_end; ++itr)
+      {
+        erased.push_back(itr->first);
+      }
+#endif
+
       data.erase(idata, idata_end);
 
       CHECK_EQUAL(initial_data.size() - 3, data.size());
       CHECK(!data.full());
       CHECK(!data.empty());
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so only the keys that were
+      // in the erased range must be missing.
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        bool was_erased = std::find(erased.begin(), erased.end(), initial_data[i].first) != erased.end();
+        CHECK_EQUAL(was_erased, data.find(initial_data[i].first) == data.end());
+      }
+#else
       idata = data.find(K8);
       CHECK(idata != data.end());
 
@@ -547,6 +615,7 @@ namespace
 
       idata = data.find(K9);
       CHECK(idata != data.end());
+#endif
     }
 
     //*************************************************************************
@@ -578,6 +647,15 @@ namespace
 
       std::pair<DataNDC::iterator, DataNDC::iterator> result;
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so compare each range with
+      // a linear search of the container.
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        result = data.equal_range(initial_data[i].first);
+        CHECK(result == Linear_Equal_Range(data.begin(), data.end(), initial_data[i].first));
+      }
+#else
       result = data.equal_range(K0);
       CHECK(result.first  == data.begin());
       CHECK(result.second != data.end());
@@ -595,6 +673,7 @@ namespace
       CHECK(result.second == data.end());
       CHECK_EQUAL(std::distance(result.first, result.second), 1);
       CHECK_EQUAL(result.first->first, K9);
+#endif
     }
 
     //*************************************************************************
@@ -604,6 +683,15 @@ namespace
 
       std::pair<DataNDC::const_iterator, DataNDC::const_iterator> result;
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so compare each range with
+      // a linear search of the container.
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        result = data.equal_range(initial_data[i].first);
+        CHECK(result == Linear_Equal_Range(data.begin(), data.end(), initial_data[i].first));
+      }
+#else
       result = data.equal_range(K0);
       CHECK(result.first == data.begin());
       CHECK(result.second != data.end());
@@ -621,6 +709,7 @@ namespace
       CHECK(result.second == data.end());
       CHECK_EQUAL(std::distance(result.first, result.second), 1);
       CHECK_EQUAL(result.first->first, K9);
+#endif
     }
 
     //*************************************************************************
@@ -677,11 +766,19 @@ namespace
 
       // Half the buckets used.
       data.assign(initial_data.begin(), initial_data.begin() + (initial_data.size() / 4));
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      CHECK_CLOSE(0.25, data.load_factor(), 0.01); // 5 buckets are rounded up to 8.
+#else
       CHECK_CLOSE(0.4, data.load_factor(), 0.01);
+#endif
 
       // All of the buckets used.
       data.assign(initial_data.begin(), initial_data.end());
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      CHECK_CLOSE(1.25, data.load_factor(), 0.01);
+#else
       CHECK_CLOSE(2.0, data.load_factor(), 0.01);
+#endif
     }
 
     //*************************************************************************
@@ -689,5 +786,207 @@ namespace
     {
 
     }
+
+    //*************************************************************************
+    TEST(test_find_transparent)
+    {
+      typedef etl::string<8> Key;
+      typedef etl::unordered_map<Key, int, 8, 8, etl::hash<Key>, etl::equal_to<> > Data;
+
+      Data data;
+      data.insert(Data::value_type(Key("one"),   1));
+      data.insert(Data::value_type(Key("two"),   2));
+      data.insert(Data::value_type(Key("three"), 3));
+
+      const Data& cdata = data;
+
+      // Null terminated strings.
+      Data::iterator itr = data.find("two");
+      CHECK(itr != data.end());
+      CHECK_EQUAL(2, itr->second);
+      CHECK(data.find("four") == data.end());
+      CHECK(cdata.find("three") != cdata.end());
+      CHECK_EQUAL(3, cdata.find("three")->second);
+      CHECK_EQUAL(1U, data.count("one"));
+      CHECK_EQUAL(0U, data.count("four"));
+
+      // String views.
+      etl::string_view view("three");
+      CHECK_EQUAL(3, data.find(view)->second);
+      CHECK_EQUAL(1U, cdata.count(view));
+
+      std::pair<Data::iterator, Data::iterator> range = data.equal_range(view);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(3, range.first->second);
+
+      std::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(etl::string_view("four"));
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+
+      // The key type itself.
+      CHECK_EQUAL(1, data.find(Key("one"))->second);
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_with_empty_first_bucket)
+    {
+      typedef etl::unordered_map<int, int, 8, 4, identity_hash> Data;
+
+      Data data;
+      data[1] = 1;
+      data[2] = 2;
+      data[4] = 4;
+
+      CHECK_EQUAL(3, std::distance(data.begin(), data.end()));
+
+      // Empty the bucket that begin() started from.
+      data.erase(4);
+
+      CHECK_EQUAL(2, std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(2, std::distance(data.cbegin(), data.cend()));
+    }
+
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+    //*************************************************************************
+    TEST(test_power_of_2_buckets)
+    {
+      typedef etl::unordered_map<int, int, 64, 5> Data5;
+      typedef etl::unordered_map<int, int, 64, 16, identity_hash> Data16;
+
+      CHECK_EQUAL(8U, Data5().bucket_count());
+
+      // Keys that are multiples of the bucket count must still spread out.
+      Data16 data;
+      std::vector<bool> used(data.bucket_count(), false);
+
+      for (int i = 0; i < 64; ++i)
+      {
+        used[data.get_bucket_index(i * 16)] = true;
+      }
+
+      CHECK(std::count(used.begin(), used.end(), true) >= 12);
+    }
+#endif
+
+#if defined(ETL_UNORDERED_STORE_HASH)
+    //*************************************************************************
+    TEST(test_stored_hash_skips_key_compare)
+    {
+      // All of the keys share the one bucket.
+      typedef etl::unordered_map<int, int, 8, 1, identity_hash, counting_equal> Data;
+
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data[i] = i;
+      }
+
+      counting_equal::count = 0;
+
+      CHECK_EQUAL(7, data.find(7)->second);
+      CHECK(data.find(8) == data.end());
+
+      // Only the node with the matching hash is compared.
+      CHECK_EQUAL(1, counting_equal::count);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef etl::unordered_map<int, std::unique_ptr<int>, 10> Data;
+
+      Data data;
+
+      data.insert(Data::value_type(1, std::unique_ptr<int>(new int(10))));
+      data.insert(data.begin(), Data::value_type(2, std::unique_ptr<int>(new int(20))));
+
+      Data::value_type duplicate(2, std::unique_ptr<int>(new int(0)));
+      std::pair<Data::iterator, bool> result = data.insert(std::move(duplicate));
+
+      CHECK(!result.second);
+      CHECK(duplicate.second); // Duplicate key, so not moved.
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(10, *data.at(1));
+      CHECK_EQUAL(20, *data.at(2));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::unordered_map<int, std::unique_ptr<int>, 10> Data;
+
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.emplace(1, std::unique_ptr<int>(new int(10)));
+      CHECK(result.second);
+      CHECK_EQUAL(10, *result.first->second);
+
+      result = data.emplace(1, std::unique_ptr<int>(new int(20)));
+      CHECK(!result.second);
+      CHECK_EQUAL(10, *result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      result = data.emplace(11, std::unique_ptr<int>(new int(110)));
+      CHECK(result.second);
+      CHECK_EQUAL(110, *data.at(11));
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_existing_key_when_full)
+    {
+      typedef etl::unordered_map<int, std::unique_ptr<int>, 2> Data;
+
+      Data data;
+      data.emplace(1, std::unique_ptr<int>(new int(10)));
+      data.emplace(2, std::unique_ptr<int>(new int(20)));
+
+      std::pair<Data::iterator, bool> result = data.emplace(2, std::unique_ptr<int>(new int(30)));
+      CHECK(!result.second);
+      CHECK_EQUAL(20, *result.first->second);
+      CHECK_EQUAL(2U, data.size());
+
+      Data::value_type duplicate(1, std::unique_ptr<int>(new int(0)));
+      result = data.insert(std::move(duplicate));
+      CHECK(!result.second);
+      CHECK(duplicate.second);
+
+      CHECK_THROW(data.emplace(3, std::unique_ptr<int>(new int(30))), etl::unordered_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::unordered_map<int, std::unique_ptr<int>, 10> Data;
+
+      Data data1;
+      data1.emplace(1, std::unique_ptr<int>(new int(10)));
+      data1.emplace(2, std::unique_ptr<int>(new int(20)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(20, *data2.at(2));
+
+      Data data3;
+      data3.emplace(3, std::unique_ptr<int>(new int(30)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK(data3.find(3) == data3.end());
+
+      etl::iunordered_map<int, std::unique_ptr<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(10, *data2.at(1));
+    }
+#endif
   };
 }
@@ -70,6 +70,29 @@ namespace
     return true;
   }
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+  //*************************************************************************
+  // The range of elements with the key, found by a linear search.
+  //*************************************************************************
+  template <typename TIterator, typename TKey>
+  std::pair<TIterator, TIterator> Linear_Equal_Range(TIterator begin, TIterator end, const TKey& key)
+  {
+    while ((begin != end) && !(begin->first == key))
+    {
+      ++begin;
+    }
+
+    TIterator last = begin;
+
+    while ((last != end) && (last->first == key))
+    {
+      ++last;
+    }
+
+    return std::make_pair(begin, last);
+  }
+#endif
+
   SUITE(test_unordered_multimap)
   {
     static const size_t SIZE = 10;
@@ -424,12 +447,30 @@ namespace
       DataNDC::iterator idata_end = data.begin();
       std::advance(idata_end, 5);
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      std::vector<std::string> erased;
+
+      for (DataNDC::iterator itr = idata; itr != idata_end; ++itr)
+      {
+        erased.push_back(itr->first);
+      }
+#endif
+
       data.erase(idata, idata_end);
 
       CHECK_EQUAL(initial_data.size() - 3, data.size());
       CHECK(!data.full());
       CHECK(!data.empty());
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so only the keys that were
+      // in the erased range must be missing.
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        bool was_erased = std::find(erased.begin(), erased.end(), initial_data[i].first) != erased.end();
+        CHECK_EQUAL(was_erased, data.find(initial_data[i].first) == data.end());
+      }
+#else
       idata = data.find(K8);
       CHECK(idata != data.end());
 
@@ -462,6 +503,7 @@ namespace
 
       idata = data.find(K9);
       CHECK(idata != data.end());
+#endif
     }
 
     //*************************************************************************
@@ -506,6 +548,15 @@ namespace
 
       std::pair<DataNDC::iterator, DataNDC::iterator> result;
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so compare each range with
+      // a linear search of the container.
+      for (size_t i = 0UL; i < equal_data.size(); ++i)
+      {
+        result = data.equal_range(equal_data[i].first);
+        CHECK(result == Linear_Equal_Range(data.begin(), data.end(), equal_data[i].first));
+      }
+#else
       result = data.equal_range(K10);
       CHECK(result.first  == data.begin());
       CHECK(result.second != data.end());
@@ -523,6 +574,7 @@ namespace
       CHECK(result.second == data.end());
       CHECK_EQUAL(std::distance(result.first, result.second), 1);
       CHECK_EQUAL(result.first->first, K12);
+#endif
     }
 
     //*************************************************************************
@@ -532,6 +584,15 @@ namespace
 
       std::pair<DataNDC::const_iterator, DataNDC::const_iterator> result;
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so compare each range with
+      // a linear search of the container.
+      for (size_t i = 0UL; i < equal_data.size(); ++i)
+      {
+        result = data.equal_range(equal_data[i].first);
+        CHECK(result == Linear_Equal_Range(data.begin(), data.end(), equal_data[i].first));
+      }
+#else
       result = data.equal_range(K10);
       CHECK(result.first == data.begin());
       CHECK(result.second != data.end());
@@ -549,6 +610,7 @@ namespace
       CHECK(result.second == data.end());
       CHECK_EQUAL(std::distance(result.first, result.second), 1);
       CHECK_EQUAL(result.first->first, K12);
+#endif
     }
 
     //*************************************************************************
@@ -605,12 +667,103 @@ namespace
 
       // Half the buckets used.
       data.assign(initial_data.begin(), initial_data.begin() + (initial_data.size() / 4));
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      CHECK_CLOSE(0.25, data.load_factor(), 0.01); // 5 buckets are rounded up to 8.
+#else
       CHECK_CLOSE(0.4, data.load_factor(), 0.01);
+#endif
 
       // All of the buckets used.
       data.clear();
       data.assign(initial_data.begin(), initial_data.end());
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      CHECK_CLOSE(1.25, data.load_factor(), 0.01);
+#else
       CHECK_CLOSE(2.0, data.load_factor(), 0.01);
+#endif
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::unordered_multimap<int, M, SIZE> Data;
+
+      Data data;
+
+      data.insert(Data::value_type(1, M(10)));
+      data.insert(data.begin(), Data::value_type(3, M(30)));
+
+      Data::value_type value(1, M(11));
+      Data::iterator result = data.insert(std::move(value));
+
+      CHECK(!value.second.valid);
+      CHECK_EQUAL(11, result->second.value);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(1));
+      CHECK(std::all_of(data.begin(), data.end(), [](const Data::value_type& v) { return v.second.valid; }));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::unordered_multimap<int, M, SIZE> Data;
+
+      Data data;
+
+      Data::iterator result = data.emplace(2, M(20));
+      CHECK_EQUAL(20, result->second.value);
+
+      data.emplace(1, M(10));
+      data.emplace(2, M(21));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(2));
+
+      while (!data.full())
+      {
+        data.emplace(0, M(0));
+      }
+
+      CHECK_THROW(data.emplace(0, M(0)), etl::unordered_multimap_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::unordered_multimap<int, M, SIZE> Data;
+
+      Data data1;
+      data1.emplace(1, M(10));
+      data1.emplace(2, M(20));
+      data1.emplace(2, M(21));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(2U, data2.count(2));
+
+      Data data3;
+      data3.emplace(3, M(30));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+      CHECK(data3.find(3) == data3.end());
+
+      etl::iunordered_multimap<int, M>& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(10, data2.find(1)->second.value);
+      CHECK(std::all_of(data2.begin(), data2.end(), [](const Data::value_type& v) { return v.second.valid; }));
     }
+#endif
   };
 }
@@ -39,6 +39,9 @@ SOFTWARE.
 #include "data.h"
 
 #include "unordered_set.h"
+#include "cstring.h"
+#include "string_view.h"
+#include "functional.h"
 #include "checksum.h"
 
 namespace
@@ -329,12 +332,30 @@ namespace
       DataNDC::iterator idata_end = data.begin();
       std::advance(idata_end, 5);
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      std::vector<NDC> erased;
+
+      for (DataNDC::iterator itr = idata; itr != idata_end; ++itr)
+      {
+        erased.push_back(*itr);
+      }
+#endif
+
       data.erase(idata, idata_end);
 
       CHECK_EQUAL(initial_data.size() - 3, data.size());
       CHECK(!data.full());
       CHECK(!data.empty());
 
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      // The bucket order depends on the mixed hash, so only the keys that were
+      // in the erased range must be missing.
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        bool was_erased = std::find(erased.begin(), erased.end(), initial_data[i]) != erased.end();
+        CHECK_EQUAL(was_erased, data.find(initial_data[i]) == data.end());
+      }
+#else
       idata = data.find(N8);
       CHECK(idata != data.end());
 
@@ -367,6 +388,7 @@ namespace
 
       idata = data.find(N9);
       CHECK(idata != data.end());
+#endif
     }
 
     //*************************************************************************
@@ -444,12 +466,161 @@ namespace
 
       // Half the buckets used.
       data.assign(initial_data.begin(), initial_data.begin() + (initial_data.size() / 4));
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      CHECK_CLOSE(0.25, data.load_factor(), 0.01); // 5 buckets are rounded up to 8.
+#else
       CHECK_CLOSE(0.4, data.load_factor(), 0.01);
+#endif
 
       // All of the buckets used.
       data.clear();
       data.assign(initial_data.begin(), initial_data.end());
+#if defined(ETL_UNORDERED_POWER_OF_2_BUCKETS)
+      CHECK_CLOSE(1.25, data.load_factor(), 0.01);
+#else
       CHECK_CLOSE(2.0, data.load_factor(), 0.01);
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_find_transparent)
+    {
+      typedef etl::string<8> Key;
+      typedef etl::unordered_set<Key, 8, 8, etl::hash<Key>, etl::equal_to<> > Data;
+
+      Data data;
+      data.insert(Key("one"));
+      data.insert(Key("two"));
+      data.insert(Key("three"));
+
+      const Data& cdata = data;
+
+      // Null terminated strings.
+      Data::iterator itr = data.find("two");
+      CHECK(itr != data.end());
+      CHECK(*itr == "two");
+      CHECK(data.find("four") == data.end());
+      CHECK(cdata.find("three") != cdata.end());
+      CHECK_EQUAL(1U, data.count("one"));
+      CHECK_EQUAL(0U, data.count("four"));
+
+      // String views.
+      etl::string_view view("three");
+      CHECK(data.find(view) != data.end());
+      CHECK_EQUAL(1U, cdata.count(view));
+
+      std::pair<Data::iterator, Data::iterator> range = data.equal_range(view);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK(*range.first == "three");
+
+      std::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(etl::string_view("four"));
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+
+      // The key type itself.
+      CHECK(data.find(Key("one")) != data.end());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    struct move_hash
+    {
+      size_t operator ()(const TestDataM<int>& value) const
+      {
+        return size_t(value.value);
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::unordered_set<M, SIZE, SIZE, move_hash> Data;
+
+      Data data;
+
+      data.insert(M(1));
+      data.insert(data.begin(), M(3));
+
+      M value(2);
+      std::pair<Data::iterator, bool> result = data.insert(std::move(value));
+
+      CHECK(result.second);
+      CHECK(!value.valid);
+
+      M duplicate(2);
+      result = data.insert(std::move(duplicate));
+
+      CHECK(!result.second);
+      CHECK(duplicate.valid); // Already in the set, so not moved.
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.find(M(2)) != data.end());
+      CHECK(std::all_of(data.begin(), data.end(), [](const M& m) { return m.valid; }));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::unordered_set<M, SIZE, SIZE, move_hash> Data;
+
+      Data data;
+
+      data.emplace(2);
+      data.emplace(1);
+
+      std::pair<Data::iterator, bool> result = data.emplace(2);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->value);
+      CHECK_EQUAL(2U, data.size());
+
+      for (int i = 3; !data.full(); ++i)
+      {
+        data.emplace(i);
+      }
+
+      // Full, but the value is already there.
+      result = data.emplace(2);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->value);
+      CHECK_THROW(data.emplace(0), etl::unordered_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<int> M;
+      typedef etl::unordered_set<M, SIZE, SIZE, move_hash> Data;
+
+      Data data1;
+      data1.emplace(1);
+      data1.emplace(2);
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK(data2.find(M(1)) != data2.end());
+
+      Data data3;
+      data3.emplace(3);
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK(data3.find(M(3)) == data3.end());
+
+      etl::iunordered_set<M, move_hash>& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK(data2.find(M(2)) != data2.end());
+      CHECK(std::all_of(data2.begin(), data2.end(), [](const M& m) { return m.valid; }));
     }
+#endif
   };
 }
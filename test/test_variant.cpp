@@ -35,6 +35,7 @@ SOFTWARE.
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <memory>
 
 namespace
 {
@@ -791,5 +792,32 @@ namespace
       CHECK(variant.is_type<D4>());
       CHECK_EQUAL(D4("1", "2", "3", "4"), variant.get<D4>());
     }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_move_construct_and_assign)
+    {
+      typedef etl::variant<int, std::unique_ptr<int> > Variant;
+
+      Variant variant1(std::unique_ptr<int>(new int(1)));
+      CHECK(variant1.is_type<std::unique_ptr<int> >());
+
+      Variant variant2(std::move(variant1));
+      CHECK(variant2.is_type<std::unique_ptr<int> >());
+      CHECK_EQUAL(1, *variant2.get<std::unique_ptr<int> >());
+      CHECK(!variant1.get<std::unique_ptr<int> >());
+
+      Variant variant3(2);
+      variant3 = std::move(variant2);
+      CHECK_EQUAL(1, *variant3.get<std::unique_ptr<int> >());
+
+      variant3 = std::unique_ptr<int>(new int(3));
+      CHECK_EQUAL(3, *variant3.get<std::unique_ptr<int> >());
+
+      variant3 = 4;
+      CHECK(variant3.is_type<int>());
+      CHECK_EQUAL(4, variant3.get<int>());
+    }
+#endif
   };
 }
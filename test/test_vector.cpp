@@ -29,12 +29,61 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <vector>
+#include <string>
 #include <array>
 #include <algorithm>
 #include <cstring>
+#include <memory>
 
 #include "vector.h"
 
+namespace
+{
+  // A non-trivial class, declared trivially relocatable, that counts its instances.
+  struct Relocatable
+  {
+    Relocatable(int value_ = 0)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Relocatable(const Relocatable& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    ~Relocatable()
+    {
+      --instances;
+    }
+
+    Relocatable& operator =(const Relocatable& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    friend bool operator ==(const Relocatable& lhs, const Relocatable& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Relocatable::instances = 0;
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Relocatable> : etl::true_type {};
+}
+
 namespace
 {
   SUITE(test_vector)
@@ -608,6 +657,44 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_insert_position_self)
+    {
+      // Inserting an element of the vector itself must use its value before the shift.
+      etl::vector<int, 10> data;
+      std::vector<int>     compare;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        data.push_back(i * 10);
+        compare.push_back(i * 10);
+      }
+
+      data.insert(data.begin(), data[2]);
+      compare.insert(compare.begin(), compare[2]);
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      etl::vector<std::string, 10> text;
+      text.push_back("A");
+      text.push_back("B");
+      text.push_back("C");
+
+      text.insert(text.begin() + 1, text[2]);
+
+      CHECK_EQUAL(std::string("C"), text[1]);
+      CHECK_EQUAL(std::string("B"), text[2]);
+
+      etl::vector<Relocatable, 10> relocatable;
+      relocatable.push_back(Relocatable(1));
+      relocatable.push_back(Relocatable(2));
+
+      relocatable.insert(relocatable.begin(), relocatable[1]);
+
+      CHECK_EQUAL(2, relocatable[0].value);
+      CHECK_EQUAL(1, relocatable[1].value);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_position_value_excess)
     {
@@ -1033,5 +1120,131 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST(test_relocatable_insert_erase)
+    {
+      {
+        etl::vector<Relocatable, SIZE> data;
+        std::vector<Relocatable>       compare_data;
+
+        for (int i = 0; i < int(SIZE) - 1; ++i)
+        {
+          size_t offset = (i * 7) % (compare_data.size() + 1);
+
+          data.insert(data.begin() + offset, Relocatable(i));
+          compare_data.insert(compare_data.begin() + offset, Relocatable(i));
+
+          CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+        }
+
+        data.emplace(data.begin() + 3, 99);
+        compare_data.emplace(compare_data.begin() + 3, 99);
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+        CHECK_EQUAL(int(2 * SIZE), Relocatable::instances);
+
+        data.erase(data.begin() + 4);
+        compare_data.erase(compare_data.begin() + 4);
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        data.erase(data.begin() + 1, data.begin() + 4);
+        compare_data.erase(compare_data.begin() + 1, compare_data.begin() + 4);
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK_EQUAL(int(2 * compare_data.size()), Relocatable::instances);
+      }
+
+      CHECK_EQUAL(0, Relocatable::instances);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    TEST(test_push_back_move)
+    {
+      etl::vector<std::unique_ptr<int>, SIZE> data;
+
+      std::unique_ptr<int> p1(new int(1));
+      std::unique_ptr<int> p2(new int(2));
+
+      data.push_back(std::move(p1));
+      data.push_back(std::move(p2));
+
+      CHECK(!p1);
+      CHECK(!p2);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, *data[0]);
+      CHECK_EQUAL(2, *data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_move)
+    {
+      etl::vector<std::unique_ptr<int>, SIZE> data;
+
+      data.insert(data.end(), std::unique_ptr<int>(new int(3)));
+      data.insert(data.begin(), std::unique_ptr<int>(new int(1)));
+      data.insert(data.begin() + 1, std::unique_ptr<int>(new int(2)));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, *data[0]);
+      CHECK_EQUAL(2, *data[1]);
+      CHECK_EQUAL(3, *data[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      struct Five
+      {
+        Five(int a_, int b_, int c_, int d_, std::unique_ptr<int>&& e_)
+          : sum(a_ + b_ + c_ + d_ + *e_)
+        {
+        }
+
+        int sum;
+      };
+
+      etl::vector<Five, SIZE> data;
+
+      data.emplace_back(1, 2, 3, 4, std::unique_ptr<int>(new int(5)));
+      data.emplace(data.begin(), 2, 3, 4, 5, std::unique_ptr<int>(new int(6)));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(20, data[0].sum);
+      CHECK_EQUAL(15, data[1].sum);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::vector<std::unique_ptr<int>, SIZE> Data;
+
+      Data data1;
+      data1.push_back(std::unique_ptr<int>(new int(1)));
+      data1.push_back(std::unique_ptr<int>(new int(2)));
+
+      Data data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(2, *data2[1]);
+
+      Data data3;
+      data3.push_back(std::unique_ptr<int>(new int(3)));
+
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(1, *data3[0]);
+
+      etl::ivector<std::unique_ptr<int> >& idata = data2;
+      idata = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data2.size());
+    }
+#endif
   };
 }
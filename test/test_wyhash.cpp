@@ -0,0 +1,195 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <iterator>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "wyhash.h"
+#include "hash.h"
+
+namespace
+{
+  //***************************************************************************
+  /// The test vectors from the reference implementation.
+  //***************************************************************************
+  struct test_vector
+  {
+    const char* text;
+    uint64_t    seed;
+    uint64_t    hash;
+  };
+
+  const test_vector test_vectors[] =
+  {
+    { "",                                                                                 0, 0x93228A4DE0EEC5A2ULL },
+    { "a",                                                                                1, 0xC5BAC3DB178713C4ULL },
+    { "abc",                                                                              2, 0xA97F2F7B1D9B3314ULL },
+    { "message digest",                                                                   3, 0x786D1F1DF3801DF4ULL },
+    { "abcdefghijklmnopqrstuvwxyz",                                                       4, 0xDCA5A8138AD37C87ULL },
+    { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",                   5, 0xB9E734F117CFAF70ULL },
+    { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6, 0x6CC5EAB49A92D617ULL }
+  };
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_constructor)
+    {
+      for (size_t i = 0; i < sizeof(test_vectors) / sizeof(test_vectors[0]); ++i)
+      {
+        std::string data(test_vectors[i].text);
+
+        uint64_t hash = etl::wyhash(data.begin(), data.end(), test_vectors[i].seed);
+
+        CHECK_EQUAL(test_vectors[i].hash, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_constructor_contiguous)
+    {
+      for (size_t i = 0; i < sizeof(test_vectors) / sizeof(test_vectors[0]); ++i)
+      {
+        std::string data(test_vectors[i].text);
+
+        uint64_t hash = etl::wyhash(data.c_str(), data.c_str() + data.size(), test_vectors[i].seed);
+
+        CHECK_EQUAL(test_vectors[i].hash, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_values)
+    {
+      for (size_t i = 0; i < sizeof(test_vectors) / sizeof(test_vectors[0]); ++i)
+      {
+        std::string data(test_vectors[i].text);
+
+        etl::wyhash wyhash_calculator(test_vectors[i].seed);
+
+        for (size_t j = 0; j < data.size(); ++j)
+        {
+          wyhash_calculator.add(data[j]);
+        }
+
+        uint64_t hash = wyhash_calculator;
+
+        CHECK_EQUAL(test_vectors[i].hash, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_reset)
+    {
+      std::string data("message digest");
+
+      etl::wyhash wyhash_calculator(3);
+
+      wyhash_calculator.add(data.begin(), data.end());
+      wyhash_calculator.reset();
+      wyhash_calculator.add(data.begin(), data.end());
+
+      CHECK_EQUAL(0x786D1F1DF3801DF4ULL, wyhash_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_range_split)
+    {
+      std::vector<uint8_t> data(300);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(0xFF - ((i * 37) + (i >> 3)));
+      }
+
+      for (size_t length = 0; length < data.size(); length += 7)
+      {
+        uint64_t expected = etl::wyhash(data.begin(), data.begin() + length);
+
+        // Every split of the range in to a byte at a time part and a contiguous part.
+        for (size_t split = 0; split <= length; ++split)
+        {
+          etl::wyhash wyhash_calculator;
+
+          wyhash_calculator.add(data.begin(), data.begin() + split);
+          wyhash_calculator.add(&data[0] + split, &data[0] + length);
+
+          CHECK_EQUAL(expected, wyhash_calculator.value());
+
+          etl::wyhash wyhash_calculator2;
+
+          wyhash_calculator2.add(&data[0], &data[0] + split);
+          wyhash_calculator2.add(&data[0] + split, &data[0] + length);
+
+          CHECK_EQUAL(expected, wyhash_calculator2.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_value_then_add)
+    {
+      std::string data("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789");
+
+      etl::wyhash wyhash_calculator(5);
+
+      wyhash_calculator.add(data.begin(), data.begin() + 20);
+      uint64_t partial = wyhash_calculator.value();
+      wyhash_calculator.add(data.begin() + 20, data.end());
+
+      CHECK_EQUAL(uint64_t(etl::wyhash(data.begin(), data.begin() + 20, 5)), partial);
+      CHECK_EQUAL(0xB9E734F117CFAF70ULL, wyhash_calculator.value());
+    }
+
+#if defined(ETL_HASH_USE_WYHASH)
+    //*************************************************************************
+    TEST(test_wyhash_as_default_hash)
+    {
+      std::string data("message digest");
+
+      const uint8_t* begin = reinterpret_cast<const uint8_t*>(data.c_str());
+      const uint8_t* end   = begin + data.size();
+
+      uint64_t hash = etl::wyhash(begin, end);
+
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        CHECK_EQUAL(size_t(hash), etl::private_hash::generic_hash<size_t>(begin, end));
+      }
+      else if (sizeof(size_t) == sizeof(uint32_t))
+      {
+        CHECK_EQUAL(size_t(hash ^ (hash >> 32)), etl::private_hash::generic_hash<size_t>(begin, end));
+      }
+    }
+#endif
+  };
+}